@@ -24,6 +24,8 @@
 #ifdef __cplusplus //extern C guard
 extern "C" {
 #endif
+#include <TUIC/embedded_atlas.h>
+#include <TUIC/glyph_metrics.h>
 
 typedef TuiAtlas_s* TuiAtlas;
 typedef enum TuiResult_e TuiResult;
@@ -32,12 +34,50 @@ TuiResult tuiAtlasCreate(TuiAtlas* atlas, int width, int height, int pages, cons
 
 void tuiAtlasDestroy(TuiAtlas atlas);
 
+TuiResult tuiAtlasCreateFromPixels(TuiAtlas* atlas, int width, int height, int pages, int channel_count, const uint8_t* pixel_data, const float* stpqp_coordinates, int glyph_count);
+
+TuiResult tuiAtlasCreateGrid(TuiAtlas* atlas, int width, int height, int pages, const uint8_t* pixel_data, int columns, int rows);
+
+TuiResult tuiAtlasCreateGridFromImage(TuiAtlas* atlas, int image_width, int image_height, int channel_count, const uint8_t* image_pixels, int columns, int rows);
+
+TuiResult tuiAtlasCreateFromCache(TuiAtlas* atlas, TuiAtlasCache atlas_cache);
+
+TuiResult tuiAtlasCreateFromEmbedded(TuiAtlas* atlas, const TuiEmbeddedAtlas* embedded_atlas);
+
+TuiResult tuiAtlasCreateFromBitmapFont(TuiAtlas* atlas, TuiBitmapFont bitmap_font, int columns);
+
+TuiResult tuiAtlasCreateFromGlyphCache(TuiAtlas* atlas, TuiGlyphCache glyph_cache);
+
+TuiResult tuiAtlasUpdateFromGlyphCache(TuiAtlas atlas, TuiGlyphCache glyph_cache);
+
+TuiResult tuiAtlasSetDistanceField(TuiAtlas atlas, TuiBoolean distance_field);
+
+TuiBoolean tuiAtlasIsDistanceField(TuiAtlas atlas);
+
+TuiResult tuiAtlasSetLabel(TuiAtlas atlas, const char* label);
+
+const char* tuiAtlasGetLabel(TuiAtlas atlas);
+
 TuiResult tuiAtlasSetData(TuiAtlas atlas, int width, int height, int pages, const uint8_t* pixel_data, float* stpqp_coordinates, int glyph_count);
 
 void tuiAtlasGetDimensions(TuiAtlas atlas, int* width, int* height, int* pages);
 
 int tuiAtlasGetGlyphCount(TuiAtlas atlas);
 
+void tuiAtlasGetGridDimensions(TuiAtlas atlas, int* columns, int* rows);
+
+TuiResult tuiAtlasSetGlyphMetrics(TuiAtlas atlas, const TuiGlyphMetrics* glyph_metrics);
+
+const TuiGlyphMetrics* tuiAtlasGetGlyphMetrics(TuiAtlas atlas);
+
+void tuiAtlasGetGlyphMetric(TuiAtlas atlas, uint16_t glyph, TuiGlyphMetrics* glyph_metrics);
+
+TuiResult tuiAtlasSetKerningPairs(TuiAtlas atlas, const TuiKerningPair* kerning_pairs, int kerning_pair_count);
+
+int tuiAtlasGetKerning(TuiAtlas atlas, uint16_t left_glyph, uint16_t right_glyph);
+
+int tuiAtlasMeasureGlyphs(TuiAtlas atlas, const uint16_t* glyphs, int glyph_count);
+
 size_t tuiGetAtlasCount();
 
 #ifdef __cplusplus //extern C guard
@@ -0,0 +1,184 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file atlas_builder.h
+ */
+#ifndef TUIC_ATLAS_BUILDER_H //header guard
+#define TUIC_ATLAS_BUILDER_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+
+/*!
+ * @brief The amount of floats each glyph has in an stpqp coordinate array. They are the left s, top t, right p and bottom q texture coordinates of the glyph, followed by the page it is on.
+ */
+#define TUI_STPQP_COORDINATES_PER_GLYPH 5
+/*!
+ * @brief The amount of packing orders @ref tuiAtlasBuilderPack tries, each of which can run on its own thread.
+ */
+#define TUI_ATLAS_BUILDER_PACKING_ORDER_COUNT 4
+
+
+/*! @name Atlas Builder Functions
+ *
+ * Functions for packing glyph images of different sizes into the pages of a @ref TuiAtlas.
+ *  @{ */
+/*!
+ * @brief Create an empty @ref TuiAtlasBuilder.
+ *
+ * @param atlas_builder Pointer to where the created @ref TuiAtlasBuilder is stored.
+ * @param page_width The width in pixels of every page.
+ * @param page_height The height in pixels of every page.
+ * @param channel_count The amount of 8 bit channels of each pixel, from 1 for coverage to 4 for RGBA.
+ * @param padding The amount of empty pixels kept around every glyph so they do not bleed into each other when sampled.
+ *
+ * @returns @ref TUI_RESULT_OK if the builder was created.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if a page dimension is less than 1, channel_count is not from 1 to 4, or padding is negative, or @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the builder could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiResult tuiAtlasBuilderCreate(TuiAtlasBuilder* atlas_builder, const int page_width, const int page_height, const int channel_count, const int padding);
+/*!
+ * @brief Destroy a @ref TuiAtlasBuilder and free its glyphs and packed pages.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder to destroy.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiAtlasBuilder passed to it, so it is thread safe as long as that @ref TuiAtlasBuilder is not used by another thread at the same time.
+ */
+void tuiAtlasBuilderDestroy(TuiAtlasBuilder atlas_builder);
+/*!
+ * @brief Copy a glyph image into a @ref TuiAtlasBuilder. Glyphs are numbered in the order they are added, and adding a glyph discards the previously packed pages.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder.
+ * @param width The width of the glyph in pixels.
+ * @param height The height of the glyph in pixels.
+ * @param pixels The width * height pixels of the glyph in rows from top to bottom, with the channel count of the builder.
+ *
+ * @returns @ref TUI_RESULT_OK if the glyph was added.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if a dimension is less than 1 or the glyph and its padding do not fit on a page, or @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the glyph could not be copied.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiAtlasBuilder passed to it, so it is thread safe as long as that @ref TuiAtlasBuilder is not used by another thread at the same time.
+ */
+TuiResult tuiAtlasBuilderAddGlyph(TuiAtlasBuilder atlas_builder, const int width, const int height, const uint8_t* pixels);
+/*!
+ * @brief Get the amount of glyphs added to a @ref TuiAtlasBuilder.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder.
+ *
+ * @returns The amount of glyphs.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasBuilder passed to it, so it is thread safe as long as that @ref TuiAtlasBuilder is not modified by another thread at the same time.
+ */
+int tuiAtlasBuilderGetGlyphCount(TuiAtlasBuilder atlas_builder);
+/*!
+ * @brief Pack the glyphs of a @ref TuiAtlasBuilder onto as few pages as it can with a bottom left skyline packer, then draw the pages and generate the stpqp coordinates of every glyph. The skyline packer is run with @ref TUI_ATLAS_BUILDER_PACKING_ORDER_COUNT different glyph orders in parallel and the order that uses the fewest pages is kept, and the glyphs are then copied onto the pages in parallel. The result only depends on the glyphs and settings of the builder, never on the thread count, so it can be cached.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder.
+ * @param thread_count The most threads to use, including the calling thread. If it is less than 1 every hardware thread is used.
+ *
+ * @returns @ref TUI_RESULT_OK if the glyphs were packed.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if the builder has no glyphs, or @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the packing scratch memory or the pages could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiAtlasBuilder passed to it, so it is thread safe as long as that @ref TuiAtlasBuilder is not used by another thread at the same time.
+ */
+TuiResult tuiAtlasBuilderPack(TuiAtlasBuilder atlas_builder, const int thread_count);
+/*!
+ * @brief Get the dimensions of the packed pages of a @ref TuiAtlasBuilder.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder.
+ * @param width Pointer to where the page width is stored. Can be @ref TUI_NULL.
+ * @param height Pointer to where the page height is stored. Can be @ref TUI_NULL.
+ * @param pages Pointer to where the amount of packed pages is stored, which is 0 if the glyphs are not packed. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasBuilder passed to it, so it is thread safe as long as that @ref TuiAtlasBuilder is not modified by another thread at the same time.
+ */
+void tuiAtlasBuilderGetDimensions(TuiAtlasBuilder atlas_builder, int* width, int* height, int* pages);
+/*!
+ * @brief Get the packed pages of a @ref TuiAtlasBuilder, one after another with rows from top to bottom.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder.
+ *
+ * @returns Pointer to the pixels of every page, or @ref TUI_NULL if the glyphs are not packed. It stays valid until a glyph is added, the glyphs are packed again, or the builder is destroyed.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasBuilder passed to it, so it is thread safe as long as that @ref TuiAtlasBuilder is not modified by another thread at the same time.
+ */
+const uint8_t* tuiAtlasBuilderGetPixelData(TuiAtlasBuilder atlas_builder);
+/*!
+ * @brief Get the stpqp coordinates of the packed glyphs of a @ref TuiAtlasBuilder, with @ref TUI_STPQP_COORDINATES_PER_GLYPH floats for each glyph in the order they were added.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder.
+ *
+ * @returns Pointer to the coordinates, or @ref TUI_NULL if the glyphs are not packed. It stays valid until a glyph is added, the glyphs are packed again, or the builder is destroyed.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasBuilder passed to it, so it is thread safe as long as that @ref TuiAtlasBuilder is not modified by another thread at the same time.
+ */
+const float* tuiAtlasBuilderGetStpqpCoordinates(TuiAtlasBuilder atlas_builder);
+/*!
+ * @brief Create a @ref TuiAtlas from the packed pages and stpqp coordinates of a @ref TuiAtlasBuilder.
+ *
+ * @param atlas_builder The @ref TuiAtlasBuilder.
+ * @param atlas Pointer to where the created @ref TuiAtlas is stored.
+ *
+ * @returns @ref TUI_RESULT_OK if the atlas was created.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if the glyphs are not packed, or any error of @ref tuiAtlasCreate.
+ *
+ * @requirements This function must be called only while TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access and to prevent graphics context errors.
+ */
+TuiResult tuiAtlasBuilderCreateAtlas(TuiAtlasBuilder atlas_builder, TuiAtlas* atlas);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,200 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file atlas_cache.h
+ */
+#ifndef TUIC_ATLAS_CACHE_H //header guard
+#define TUIC_ATLAS_CACHE_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <stddef.h>
+
+/*!
+ * @brief The version of the atlas cache file format. Files written with another version are treated as stale.
+ */
+#define TUI_ATLAS_CACHE_VERSION 1
+
+/*!
+ * @brief Callback type used by @ref tuiAtlasCacheOpenOrBuild to rebuild a missing or stale atlas cache file, usually by decoding the source images and calling @ref tuiAtlasCacheWrite.
+ *
+ * @param user_data The user data given to @ref tuiAtlasCacheOpenOrBuild.
+ * @param path The path of the atlas cache file to write.
+ * @param source_hash The source hash to write into the file.
+ *
+ * @returns The @ref TuiResult of writing the file. @ref TUI_RESULT_OK must be returned if the file was written.
+ */
+typedef TuiResult (* tuiAtlasCacheBuildFunction)(void* user_data, const char* path, uint64_t source_hash);
+
+/*! @name Atlas Cache Functions
+ *
+ * Functions for baking the pages and stpqp coordinates of a @ref TuiAtlas into a file once, then memory mapping that file on later runs so the pages are uploaded straight from the mapping without decoding images or copying pixels.
+ *
+ * Every file stores a source hash, usually the @ref tuiAtlasCacheHash of the files the atlas was made from, and a file is only opened if its source hash matches the one expected, so a cache made from old sources is detected as stale.
+ *  @{ */
+/*!
+ * @brief Hash an array of bytes into a 64 bit hash, for computing the source hash of an atlas cache file.
+ *
+ * @param data The bytes to hash. Can be @ref TUI_NULL if size is 0.
+ * @param size The amount of bytes.
+ * @param seed The seed of the hash. The hash of a previous array can be used as the seed to hash several arrays together.
+ *
+ * @returns The hash of the bytes, which is the same on every run and device with the same byte order.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+uint64_t tuiAtlasCacheHash(const void* data, size_t size, uint64_t seed);
+/*!
+ * @brief Write an atlas cache file with pages and stpqp coordinates in the layout given to @ref tuiAtlasCreate.
+ *
+ * @param path The path of the file to write. It is replaced if it exists.
+ * @param source_hash The source hash to store in the file.
+ * @param width The width in pixels of every page.
+ * @param height The height in pixels of every page.
+ * @param pages The amount of pages.
+ * @param channel_count The amount of 8 bit channels of each pixel, from 1 for coverage to 4 for RGBA.
+ * @param pixel_data The pixels of every page one after another.
+ * @param stpqp_coordinates @ref TUI_STPQP_COORDINATES_PER_GLYPH floats for every glyph.
+ * @param glyph_count The amount of glyphs.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if a dimension or glyph_count is less than 1 or channel_count is not from 1 to 4. Returns @ref TUI_RESULT_ERROR_FILE_CREATION_FAILURE if the file could not be created, or @ref TUI_RESULT_ERROR_FILE_WRITE_FAILURE if it could not be written.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe as long as no other thread uses the same file.
+ */
+TuiResult tuiAtlasCacheWrite(const char* path, uint64_t source_hash, int width, int height, int pages, int channel_count, const uint8_t* pixel_data, const float* stpqp_coordinates, int glyph_count);
+/*!
+ * @brief Memory map an atlas cache file as a @ref TuiAtlasCache.
+ *
+ * @param atlas_cache Pointer to where the opened @ref TuiAtlasCache is stored.
+ * @param path The path of the file.
+ * @param source_hash The source hash the file must have.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_FILE_NOT_FOUND if the file could not be opened, or @ref TUI_RESULT_ERROR_FILE_READ_FAILURE if it could not be mapped, is not an atlas cache file, is from another format version, is truncated, or has another source hash. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+TuiResult tuiAtlasCacheOpen(TuiAtlasCache* atlas_cache, const char* path, uint64_t source_hash);
+/*!
+ * @brief Memory map an atlas cache file as a @ref TuiAtlasCache, and first rebuild it with a callback if it is missing or stale.
+ *
+ * @param atlas_cache Pointer to where the opened @ref TuiAtlasCache is stored.
+ * @param path The path of the file.
+ * @param source_hash The source hash the file must have.
+ * @param build_function The @ref tuiAtlasCacheBuildFunction that writes the file when it can not be opened.
+ * @param user_data User data passed to build_function.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns the error of build_function if it fails, or any error of @ref tuiAtlasCacheOpen if the rebuilt file can still not be opened.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe as long as no other thread uses the same file.
+ */
+TuiResult tuiAtlasCacheOpenOrBuild(TuiAtlasCache* atlas_cache, const char* path, uint64_t source_hash, tuiAtlasCacheBuildFunction build_function, void* user_data);
+/*!
+ * @brief Unmap and close a @ref TuiAtlasCache.
+ *
+ * @param atlas_cache The @ref TuiAtlasCache.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiAtlasCache passed to it, so it is thread safe as long as that @ref TuiAtlasCache is not used by another thread at the same time.
+ */
+void tuiAtlasCacheClose(TuiAtlasCache atlas_cache);
+/*!
+ * @brief Get the page dimensions of a @ref TuiAtlasCache.
+ *
+ * @param atlas_cache The @ref TuiAtlasCache.
+ * @param width Pointer to where the width in pixels of every page is stored. Can be @ref TUI_NULL.
+ * @param height Pointer to where the height in pixels of every page is stored. Can be @ref TUI_NULL.
+ * @param pages Pointer to where the amount of pages is stored. Can be @ref TUI_NULL.
+ * @param channel_count Pointer to where the amount of channels of each pixel is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasCache passed to it, so it is thread safe.
+ */
+void tuiAtlasCacheGetDimensions(TuiAtlasCache atlas_cache, int* width, int* height, int* pages, int* channel_count);
+/*!
+ * @brief Get the amount of glyphs of a @ref TuiAtlasCache.
+ *
+ * @param atlas_cache The @ref TuiAtlasCache.
+ *
+ * @returns The amount of glyphs.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasCache passed to it, so it is thread safe.
+ */
+int tuiAtlasCacheGetGlyphCount(TuiAtlasCache atlas_cache);
+/*!
+ * @brief Get the pixels of every page of a @ref TuiAtlasCache, which point straight into the mapped file.
+ *
+ * @param atlas_cache The @ref TuiAtlasCache.
+ *
+ * @returns Pointer to the pixels. It stays valid until the @ref TuiAtlasCache is closed.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasCache passed to it, so it is thread safe.
+ */
+const uint8_t* tuiAtlasCacheGetPixelData(TuiAtlasCache atlas_cache);
+/*!
+ * @brief Get the stpqp coordinates of a @ref TuiAtlasCache, which point straight into the mapped file.
+ *
+ * @param atlas_cache The @ref TuiAtlasCache.
+ *
+ * @returns Pointer to @ref TUI_STPQP_COORDINATES_PER_GLYPH floats for every glyph. It stays valid until the @ref TuiAtlasCache is closed.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiAtlasCache passed to it, so it is thread safe.
+ */
+const float* tuiAtlasCacheGetStpqpCoordinates(TuiAtlasCache atlas_cache);
+/*! @} */
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
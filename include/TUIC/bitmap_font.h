@@ -0,0 +1,160 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file bitmap_font.h
+ */
+#ifndef TUIC_BITMAP_FONT_H //header guard
+#define TUIC_BITMAP_FONT_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <stddef.h>
+
+/*! @name Bitmap Font Functions
+ *
+ * Functions for parsing PSF1, PSF2 and BDF bitmap fonts with their Unicode tables, and expanding their 1 bit glyphs straight into the cells of an atlas page.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiBitmapFont from the contents of a PSF1 or PSF2 Linux console font. Single codepoints of the Unicode table are mapped to their glyphs and sequences are skipped. A font with no Unicode table maps every glyph to the codepoint equal to its index.
+ *
+ * @param font Pointer to where the created @ref TuiBitmapFont is stored.
+ * @param data The contents of the font file. It is copied, so it can be freed after this call.
+ * @param size The size in bytes of data.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if data is not a PSF1 or PSF2 font or is truncated. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+TuiResult tuiBitmapFontCreatePsf(TuiBitmapFont* font, const uint8_t* data, size_t size);
+/*!
+ * @brief Create a @ref TuiBitmapFont from the text of a BDF font. Every glyph is placed in a cell the size of the font bounding box by its own bounding box, and glyphs with an ENCODING of -1 are kept but not mapped.
+ *
+ * @param font Pointer to where the created @ref TuiBitmapFont is stored.
+ * @param text The text of the font file, which does not need to be null terminated.
+ * @param size The size in bytes of text.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if text is not a BDF font, has no glyphs, or has a glyph with no bitmap. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+TuiResult tuiBitmapFontCreateBdf(TuiBitmapFont* font, const char* text, size_t size);
+/*!
+ * @brief Create a @ref TuiBitmapFont from a PSF1, PSF2 or BDF font file, detecting the format from its first bytes.
+ *
+ * @param font Pointer to where the created @ref TuiBitmapFont is stored.
+ * @param path The path of the font file.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_FILE_NOT_FOUND if the file could not be opened, or @ref TUI_RESULT_ERROR_FILE_READ_FAILURE if it could not be read. Returns any error of @ref tuiBitmapFontCreatePsf or @ref tuiBitmapFontCreateBdf if the contents can not be parsed.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+TuiResult tuiBitmapFontLoad(TuiBitmapFont* font, const char* path);
+/*!
+ * @brief Destroy a @ref TuiBitmapFont and free its memory.
+ *
+ * @param font The @ref TuiBitmapFont.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiBitmapFont passed to it, so it is thread safe as long as that @ref TuiBitmapFont is not used by another thread at the same time.
+ */
+void tuiBitmapFontDestroy(TuiBitmapFont font);
+/*!
+ * @brief Get the glyph size and glyph count of a @ref TuiBitmapFont.
+ *
+ * @param font The @ref TuiBitmapFont.
+ * @param glyph_width Pointer to where the width in pixels of every glyph is stored. Can be @ref TUI_NULL.
+ * @param glyph_height Pointer to where the height in pixels of every glyph is stored. Can be @ref TUI_NULL.
+ * @param glyph_count Pointer to where the amount of glyphs is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiBitmapFont passed to it, so it is thread safe as long as that @ref TuiBitmapFont is not modified by another thread at the same time.
+ */
+void tuiBitmapFontGetDimensions(TuiBitmapFont font, int* glyph_width, int* glyph_height, int* glyph_count);
+/*!
+ * @brief Get the glyph a codepoint is mapped to with a binary search of the mappings.
+ *
+ * @param font The @ref TuiBitmapFont.
+ * @param codepoint The Unicode codepoint.
+ *
+ * @returns The index of the glyph, or -1 if the codepoint is not mapped.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiBitmapFont passed to it, so it is thread safe as long as that @ref TuiBitmapFont is not modified by another thread at the same time.
+ */
+int tuiBitmapFontGetGlyph(TuiBitmapFont font, uint32_t codepoint);
+/*!
+ * @brief Get every codepoint to glyph mapping of a @ref TuiBitmapFont, sorted by codepoint with no codepoint mapped twice.
+ *
+ * @param font The @ref TuiBitmapFont.
+ * @param codepoints Pointer to where the array of mapped codepoints is stored. It stays valid until the font is destroyed.
+ * @param glyphs Pointer to where the array of the glyph index of each codepoint is stored. It stays valid until the font is destroyed.
+ *
+ * @returns The amount of mappings.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiBitmapFont passed to it, so it is thread safe as long as that @ref TuiBitmapFont is not modified by another thread at the same time.
+ */
+int tuiBitmapFontGetMappings(TuiBitmapFont font, const uint32_t** codepoints, const int** glyphs);
+/*!
+ * @brief Expand the 1 bit glyphs of a @ref TuiBitmapFont into a grid atlas page, 8 pixels at a time. Glyph i is drawn in column i % columns and row i / columns, and set bits are white with full alpha in the channel layout of @ref tuiTrueTypeFontRasterizeGlyph.
+ *
+ * @param font The @ref TuiBitmapFont.
+ * @param columns The amount of glyph columns of the page.
+ * @param channel_count The amount of 8 bit channels of each pixel, from 1 to 4.
+ * @param pixels Array of (columns * glyph_width) * (ceil(glyph_count / columns) * glyph_height) pixels with channel_count channels. Every pixel is written.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiBitmapFont passed to it and only writes pixels, so it is thread safe as long as that @ref TuiBitmapFont is not modified and pixels is not accessed by another thread at the same time.
+ */
+void tuiBitmapFontExpandGlyphs(TuiBitmapFont font, int columns, int channel_count, uint8_t* pixels);
+/*! @} */
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -73,6 +73,18 @@ TuiBoolean tuiCircleItDone(const TuiCircleIt it);
  * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
  */
 void tuiCircleItStepForward(TuiCircleIt* const it);
+/*!
+ * @brief Step a @ref TuiCircleIt to the start of the next @ref TuiSpan, skipping the rest of the current one.
+ *
+ * @param it The @ref TuiCircleIt to step.
+ *
+ * @errors This function can have the error @ref TUI_ERROR_NULL_GRID_SHAPE_ITERATOR and immediatly return.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+void tuiCircleItStepSpan(TuiCircleIt* const it);
 /*!
  * @brief Set the position of a @ref TuiCircleIt to its start position.
  *
@@ -113,6 +125,20 @@ TuiCircle tuiCircleItGetCircle(const TuiCircleIt it);
  * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
  */
 TuiPoint2 tuiCircleItGetPoint2(const TuiCircleIt it);
+/*!
+ * @brief Get the @ref TuiSpan from the current position of a @ref TuiCircleIt to the right end of its row.
+ *
+ * @param it The @ref TuiCircleIt to get the span from.
+ *
+ * @returns The @ref TuiSpan at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiSpan tuiCircleItGetSpan(const TuiCircleIt it);
 /*! @} */
 
 
@@ -131,6 +157,17 @@ TuiPoint2 tuiCircleItGetPoint2(const TuiCircleIt it);
  * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
  */
 #define TUI_CIRCLE_ITERATE(circle, iterator) for(TuiCircleIt iterator = tuiCircleIt(circle); !tuiCircleItDone(iterator); tuiCircleItStepForward(&iterator))
+/*!
+ * @brief Macro function for easily constructing a circle iterator for loop over each @ref TuiSpan without body. Use @ref tuiCircleItGetSpan to get the span in the loop body.
+ *
+ * @param circle The @ref TuiCircle to iterate over. Can pass in a function that returns a @ref TuiCircle.
+ * @param iterator The name of the variable that will store the @ref TuiCircleIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+#define TUI_CIRCLE_ITERATE_SPANS(circle, iterator) for(TuiCircleIt iterator = tuiCircleIt(circle); !tuiCircleItDone(iterator); tuiCircleItStepSpan(&iterator))
 /*! @} */
 
 
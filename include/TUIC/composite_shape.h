@@ -0,0 +1,115 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file composite_shape.h
+ */
+#ifndef TUIC_COMPOSITE_SHAPE_H //header guard
+#define TUIC_COMPOSITE_SHAPE_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+
+/*! @name Composite Shape Functions
+ *
+ * Functions for manipulating @ref TuiCompositeShape.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiCompositeShape. The arrays are not copied, so they must stay alive for as long as the @ref TuiCompositeShape is used.
+ *
+ * @param shapes The shapes to combine in order.
+ * @param operations The operations that combine each shape after the first into the result. operations[i] combines shapes[i + 1]. Must have shape_count - 1 elements.
+ * @param shape_count The amount of shapes.
+ *
+ * @returns The created @ref TuiCompositeShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiCompositeShape tuiCompositeShape(const TuiShape* const shapes, const TuiShapeOperation* const operations, const int shape_count);
+/*!
+ * @brief Get the top y coordinate of the rows a @ref TuiCompositeShape can cover.
+ *
+ * @param composite_shape The @ref TuiCompositeShape.
+ *
+ * @returns The top y coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+int tuiCompositeShapeGetTopY(const TuiCompositeShape composite_shape);
+/*!
+ * @brief Get the bottom y coordinate of the rows a @ref TuiCompositeShape can cover.
+ *
+ * @param composite_shape The @ref TuiCompositeShape.
+ *
+ * @returns The bottom y coordinate. It is less than the top y coordinate if no row can be covered.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+int tuiCompositeShapeGetBottomY(const TuiCompositeShape composite_shape);
+/*!
+ * @brief Get if a @ref TuiCompositeShape has no shapes to combine.
+ *
+ * @param composite_shape The @ref TuiCompositeShape.
+ *
+ * @returns If the @ref TuiCompositeShape is degenerate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+TuiBoolean tuiCompositeShapeIsDegenerate(const TuiCompositeShape composite_shape);
+/*!
+ * @brief Get if a @ref TuiCompositeShape contains a tile. Only the row of the tile is evaluated.
+ *
+ * @param composite_shape The @ref TuiCompositeShape.
+ * @param point2 The @ref TuiPoint2 of the tile.
+ *
+ * @returns If the @ref TuiCompositeShape contains the tile.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+TuiBoolean tuiCompositeShapeContainsPoint2(const TuiCompositeShape composite_shape, const TuiPoint2 point2);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
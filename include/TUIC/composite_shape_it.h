@@ -0,0 +1,177 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file composite_shape_it.h
+ */
+#ifndef TUIC_COMPOSITE_SHAPE_IT_H //header guard
+#define TUIC_COMPOSITE_SHAPE_IT_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+
+/*! @name CompositeShape Iterator Functions
+ *
+ * Functions for manipulating @ref TuiCompositeShapeIt.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiCompositeShapeIt to iterate over the points within a @ref TuiCompositeShape.
+ *
+ * @param composite_shape The @ref TuiCompositeShape to iterate.
+ *
+ * @returns The created @ref TuiCompositeShapeIt.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+TuiCompositeShapeIt tuiCompositeShapeIt(const TuiCompositeShape composite_shape);
+/*!
+ * @brief Get if a @ref TuiCompositeShapeIt position is out of its @ref TuiCompositeShape.
+ *
+ * @param it The @ref TuiCompositeShapeIt to check.
+ *
+ * @returns If the iterator's position is out of the composite shape.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiCompositeShapeItDone(const TuiCompositeShapeIt it);
+/*!
+ * @brief Step a @ref TuiCompositeShapeIt forward.
+ *
+ * @param it The @ref TuiCompositeShapeIt to step.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+void tuiCompositeShapeItStepForward(TuiCompositeShapeIt* const it);
+/*!
+ * @brief Step a @ref TuiCompositeShapeIt forward to the first point of the next @ref TuiSpan, skipping the rest of the current @ref TuiSpan.
+ *
+ * @param it The @ref TuiCompositeShapeIt to step.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+void tuiCompositeShapeItStepSpan(TuiCompositeShapeIt* const it);
+/*!
+ * @brief Set the position of a @ref TuiCompositeShapeIt to its start position.
+ *
+ * @param it The @ref TuiCompositeShapeIt to set the position to start.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+void tuiCompositeShapeItSetStart(TuiCompositeShapeIt* const it);
+/*!
+ * @brief Get the @ref TuiCompositeShape being iterated over by a @ref TuiCompositeShapeIt.
+ *
+ * @param it The @ref TuiCompositeShapeIt to get the composite shape from.
+ *
+ * @returns The @ref TuiCompositeShape the iterator is iterating over.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiCompositeShape tuiCompositeShapeItGetCompositeShape(const TuiCompositeShapeIt it);
+/*!
+ * @brief Get the @ref TuiPoint2 at the current position of a @ref TuiCompositeShapeIt.
+ *
+ * @param it The @ref TuiCompositeShapeIt to get the point from.
+ *
+ * @returns The @ref TuiPoint2 at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiCompositeShapeItGetPoint2(const TuiCompositeShapeIt it);
+/*!
+ * @brief Get the @ref TuiSpan from the current position of a @ref TuiCompositeShapeIt to the end of its current row span.
+ *
+ * @param it The @ref TuiCompositeShapeIt to get the span from.
+ *
+ * @returns The @ref TuiSpan at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiSpan tuiCompositeShapeItGetSpan(const TuiCompositeShapeIt it);
+/*! @} */
+
+
+/*! @name CompositeShape Iterator Macro Functions
+ *
+ * Macros for easily writing @ref TuiCompositeShapeIt loops.
+ *  @{ */
+/*!
+ * @brief Macro function for easily constructing a composite shape iterator for loop without body.
+ *
+ * @param composite_shape The @ref TuiCompositeShape to iterate over. Can pass in a function that returns a @ref TuiCompositeShape.
+ * @param iterator The name of the variable that will store the @ref TuiCompositeShapeIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+#define TUI_COMPOSITE_SHAPE_ITERATE(composite_shape, iterator) for(TuiCompositeShapeIt iterator = tuiCompositeShapeIt(composite_shape); !tuiCompositeShapeItDone(iterator); tuiCompositeShapeItStepForward(&iterator))
+/*!
+ * @brief Macro function for easily constructing a composite shape iterator for loop over each @ref TuiSpan without body. Use @ref tuiCompositeShapeItGetSpan to get the span in the loop body.
+ *
+ * @param composite_shape The @ref TuiCompositeShape to iterate over. Can pass in a function that returns a @ref TuiCompositeShape.
+ * @param iterator The name of the variable that will store the @ref TuiCompositeShapeIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the caller owned shape and operation arrays, so it is thread safe as long as those arrays are not modified at the same time.
+ */
+#define TUI_COMPOSITE_SHAPE_ITERATE_SPANS(composite_shape, iterator) for(TuiCompositeShapeIt iterator = tuiCompositeShapeIt(composite_shape); !tuiCompositeShapeItDone(iterator); tuiCompositeShapeItStepSpan(&iterator))
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
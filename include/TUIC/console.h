@@ -47,6 +47,10 @@ void tuiConsoleDestroy(TuiConsole console);
 
 float tuiConsoleGetPixelScale(TuiConsole console);
 
+TuiResult tuiConsoleSetLabel(TuiConsole console, const char* label);
+
+const char* tuiConsoleGetLabel(TuiConsole console);
+
 void tuiConsoleGetTileGridDimensions(TuiConsole console, int* tiles_wide, int* tiles_tall);
 
 void tuiConsoleGetPixelDimensions(TuiConsole console, int* pixel_width, int* pixel_height);
@@ -71,6 +75,8 @@ TuiResult tuiConsolePushTileFree(TuiConsole console, TuiGlyph glyph, int screen_
 
 TuiResult tuiConsolePushTileFreeSized(TuiConsole console, TuiGlyph glyph, int screen_pixel_x, int screen_pixel_y, int tile_pixel_width, int tile_pixel_height, uint8_t fg_r, uint8_t fg_g, uint8_t fg_b, uint8_t fg_a, uint8_t bg_r, uint8_t bg_g, uint8_t bg_b, uint8_t bg_a);
 
+TuiResult tuiConsolePushTextRun(TuiConsole console, TuiAtlas atlas, const TuiGlyph* glyphs, int glyph_count, int screen_pixel_x, int baseline_pixel_y, uint8_t fg_r, uint8_t fg_g, uint8_t fg_b, uint8_t fg_a, uint8_t bg_r, uint8_t bg_g, uint8_t bg_b, uint8_t bg_a);
+
 size_t tuiGetConsoleCount();
 
 #ifdef __cplusplus //extern C guard
@@ -0,0 +1,61 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file distance_field.h
+ */
+#ifndef TUIC_DISTANCE_FIELD_H //header guard
+#define TUIC_DISTANCE_FIELD_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+
+
+/*! @name Distance Field Functions
+ *
+ * Functions for generating signed distance field glyphs, which a distance field @ref TuiAtlas draws with crisp edges at any scale.
+ *  @{ */
+/*!
+ * @brief Generate a signed distance field from high resolution coverage. The distance from every coverage pixel to the glyph edge is computed exactly with @ref tuiDistanceTransformEuclidean, and each block of downscale * downscale pixels is averaged into one distance field pixel.
+ *
+ * @param coverage Array of coverage_width * coverage_height 8 bit coverage values in rows from top to bottom. Pixels of 128 or more are inside the glyph.
+ * @param coverage_width The width in pixels of coverage. It must be a multiple of downscale.
+ * @param coverage_height The height in pixels of coverage. It must be a multiple of downscale.
+ * @param downscale The width and height in coverage pixels of each distance field pixel.
+ * @param spread The distance in distance field pixels from the edge at which distances stop changing.
+ * @param distances Array of (coverage_width / downscale) * (coverage_height / downscale) pixels the result is written to. The edge is 128, inside is above it and outside is below it, and values reach 255 and 0 at spread distance field pixels from the edge.
+ * @param thread_count The most threads to use, including the calling thread. If it is less than 1 every hardware thread is used.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if a coverage dimension or downscale is less than 1, a coverage dimension is not a multiple of downscale, or spread is not above 0. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the scratch memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads coverage and only writes distances, so it is thread safe as long as no other thread writes coverage or accesses distances at the same time.
+ */
+TuiResult tuiDistanceFieldGenerate(const uint8_t* coverage, const int coverage_width, const int coverage_height, const int downscale, const float spread, uint8_t* distances, const int thread_count);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
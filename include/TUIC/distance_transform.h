@@ -0,0 +1,70 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file distance_transform.h
+ */
+#ifndef TUIC_DISTANCE_TRANSFORM_H //header guard
+#define TUIC_DISTANCE_TRANSFORM_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+
+
+/*! @name Distance Transform Functions
+ *
+ * Functions for computing the distance from every tile of a grid to the nearest set tile of a source @ref TuiGridMask in time linear in the amount of tiles, no matter how many sources there are.
+ *  @{ */
+/*!
+ * @brief Compute the exact Euclidean distance from every tile to the nearest source tile. Columns are scanned first and rows are then solved with the lower envelope of parabolas of Felzenszwalb and Huttenlocher, and both passes are split over threads.
+ *
+ * @param source_mask The @ref TuiGridMask of source tiles.
+ * @param distances Array of width * height distances the result is written to, in rows from top to bottom and measured in tiles. If the mask has no source tiles every distance is INFINITY.
+ * @param thread_count The most threads to use, including the calling thread. If it is less than 1 every hardware thread is used.
+ *
+ * @returns @ref TUI_RESULT_OK if the distances were computed.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the scratch memory of the threads could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads source_mask and only writes distances, so it is thread safe as long as no other thread writes source_mask or accesses distances at the same time.
+ */
+TuiResult tuiDistanceTransformEuclidean(TuiGridMask source_mask, float* distances, const int thread_count);
+/*!
+ * @brief Compute an approximate Euclidean distance from every tile to the nearest source tile with two chamfer passes, where orthogonal steps cost 1 and diagonal steps cost the square root of 2. Distances along rows, columns and diagonals are exact, and other distances are at most about 8% too large. It runs on the calling thread and does not allocate.
+ *
+ * @param source_mask The @ref TuiGridMask of source tiles.
+ * @param distances Array of width * height distances the result is written to, in rows from top to bottom and measured in tiles. If the mask has no source tiles every distance is INFINITY.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads source_mask and only writes distances, so it is thread safe as long as no other thread writes source_mask or accesses distances at the same time.
+ */
+void tuiDistanceTransformChamfer(TuiGridMask source_mask, float* distances);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,192 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file draw_list.h
+ */
+#ifndef TUIC_DRAW_LIST_H //header guard
+#define TUIC_DRAW_LIST_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+
+
+/*! @name Draw List Functions
+ *
+ * Functions for recording draws to panels and submitting them later, instead of drawing them immediately like @ref tuiPanelDrawConsole.
+ *
+ * When a list is submitted its draws are grouped by the panel they draw to, so each panel framebuffer is bound once per group instead of once per draw. Grouped draws are not merged into fewer draw calls: each draw is still drawn on its own, and only the graphics state it shares with the draw before it, like the framebuffer, program and blending, is not set again. Draws to the same panel keep the order they were recorded in. A draw that reads a panel is never moved before an earlier draw to that panel, or after a later one. Consoles, atlases, textures, panels and windows are read when the list is submitted, not when a draw is recorded, so they must stay valid and unchanged until then.
+ *
+ * Recording does not touch the graphics API, so a list can be recorded on any thread and submitted on the thread on which TUIC was initialized.
+ *  @{ */
+/*!
+ * @brief Create an empty @ref TuiDrawList.
+ *
+ * @param draw_list Pointer to where the created @ref TuiDrawList is stored.
+ * @param command_capacity The amount of draws the list can hold before it grows.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if command_capacity is less than 1. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+TuiResult tuiDrawListCreate(TuiDrawList* draw_list, int command_capacity);
+/*!
+ * @brief Destroy a @ref TuiDrawList and free its memory.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiDrawList passed to it, so it is thread safe as long as that @ref TuiDrawList is not used by another thread at the same time.
+ */
+void tuiDrawListDestroy(TuiDrawList draw_list);
+/*!
+ * @brief Remove every draw from a @ref TuiDrawList to start recording a new list of draws.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiDrawList passed to it, so it is thread safe as long as that @ref TuiDrawList is not used by another thread at the same time.
+ */
+void tuiDrawListBegin(TuiDrawList draw_list);
+/*!
+ * @brief Record a draw of a @ref TuiConsole to a rectangle of a @ref TuiPanel, like @ref tuiPanelDrawConsoleTransformed.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ * @param panel The @ref TuiPanel to draw to.
+ * @param atlas The @ref TuiAtlas of the glyphs of the console.
+ * @param console The @ref TuiConsole to draw.
+ * @param left_x The left edge in pixels of the rectangle of the panel to draw to.
+ * @param right_x The right edge in pixels of the rectangle.
+ * @param top_y The top edge in pixels of the rectangle.
+ * @param bottom_y The bottom edge in pixels of the rectangle.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the list could not grow.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiDrawList passed to it, so it is thread safe as long as that @ref TuiDrawList is not used by another thread at the same time.
+ */
+TuiResult tuiDrawListRecordConsole(TuiDrawList draw_list, TuiPanel panel, TuiAtlas atlas, TuiConsole console, int left_x, int right_x, int top_y, int bottom_y);
+/*!
+ * @brief Record a draw of a @ref TuiPanel to a rectangle of another @ref TuiPanel, like @ref tuiPanelDrawPanelTransformed.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ * @param panel The @ref TuiPanel to draw to.
+ * @param subject_panel The @ref TuiPanel to draw.
+ * @param left_x The left edge in pixels of the rectangle of the panel to draw to.
+ * @param right_x The right edge in pixels of the rectangle.
+ * @param top_y The top edge in pixels of the rectangle.
+ * @param bottom_y The bottom edge in pixels of the rectangle.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if subject_panel is panel. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the list could not grow.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiDrawList passed to it, so it is thread safe as long as that @ref TuiDrawList is not used by another thread at the same time.
+ */
+TuiResult tuiDrawListRecordPanel(TuiDrawList draw_list, TuiPanel panel, TuiPanel subject_panel, int left_x, int right_x, int top_y, int bottom_y);
+/*!
+ * @brief Record a draw of a @ref TuiTexture to a rectangle of a @ref TuiPanel, like @ref tuiPanelDrawTextureTransformed.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ * @param panel The @ref TuiPanel to draw to.
+ * @param texture The @ref TuiTexture to draw.
+ * @param left_x The left edge in pixels of the rectangle of the panel to draw to.
+ * @param right_x The right edge in pixels of the rectangle.
+ * @param top_y The top edge in pixels of the rectangle.
+ * @param bottom_y The bottom edge in pixels of the rectangle.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the list could not grow.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiDrawList passed to it, so it is thread safe as long as that @ref TuiDrawList is not used by another thread at the same time.
+ */
+TuiResult tuiDrawListRecordTexture(TuiDrawList draw_list, TuiPanel panel, TuiTexture texture, int left_x, int right_x, int top_y, int bottom_y);
+/*!
+ * @brief Record a draw of the framebuffer of a @ref TuiWindow to a rectangle of a @ref TuiPanel, like @ref tuiPanelDrawWindowTransformed.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ * @param panel The @ref TuiPanel to draw to.
+ * @param window The @ref TuiWindow to draw.
+ * @param left_x The left edge in pixels of the rectangle of the panel to draw to.
+ * @param right_x The right edge in pixels of the rectangle.
+ * @param top_y The top edge in pixels of the rectangle.
+ * @param bottom_y The bottom edge in pixels of the rectangle.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the list could not grow.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiDrawList passed to it, so it is thread safe as long as that @ref TuiDrawList is not used by another thread at the same time.
+ */
+TuiResult tuiDrawListRecordWindow(TuiDrawList draw_list, TuiPanel panel, TuiWindow window, int left_x, int right_x, int top_y, int bottom_y);
+/*!
+ * @brief Get the amount of draws recorded in a @ref TuiDrawList since it last began.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ *
+ * @returns The amount of draws.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiDrawList passed to it, so it is thread safe as long as that @ref TuiDrawList is not modified by another thread at the same time.
+ */
+int tuiDrawListGetCommandCount(TuiDrawList draw_list);
+/*!
+ * @brief Draw every draw recorded in a @ref TuiDrawList, grouped by the panel they draw to. The draws stay recorded, so a list that does not change can be submitted every frame.
+ *
+ * @param draw_list The @ref TuiDrawList.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_NOT_INITIALIZED if TUIC is not initialized. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated. Returns @ref TUI_RESULT_ERROR_GRAPHICS_BACKEND if a draw failed, in which case the draws after it are not drawn.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiDrawListSubmit(TuiDrawList draw_list);
+/*! @} */
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
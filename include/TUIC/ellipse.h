@@ -0,0 +1,361 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file ellipse.h
+ */
+#ifndef TUIC_ELLIPSE_H //header guard
+#define TUIC_ELLIPSE_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+
+/*! @name 2D Ellipse Functions
+ *
+ * Functions for manipulating @ref TuiEllipse.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiEllipse.
+ *
+ * @param center_x The x position of the ellipse center point.
+ * @param center_y The y position of the ellipse center point.
+ * @param radius_x The horizontal radius of the ellipse.
+ * @param radius_y The vertical radius of the ellipse.
+ *
+ * @returns The created @ref TuiEllipse.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiEllipse tuiEllipse(const int center_x, const int center_y, const float radius_x, const float radius_y);
+/*!
+ * @brief Get the center @ref TuiPoint2 of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The center @ref TuiPoint2
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiEllipseGetCenterPoint2(const TuiEllipse ellipse);
+/*!
+ * @brief Get the left x coordinate of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The left x coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+int tuiEllipseGetLeftX(const TuiEllipse ellipse);
+/*!
+ * @brief Get the right x coordinate of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The right x coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+int tuiEllipseGetRightX(const TuiEllipse ellipse);
+/*!
+ * @brief Get the top y coordinate of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The top y coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+int tuiEllipseGetTopY(const TuiEllipse ellipse);
+/*!
+ * @brief Get the bottom y coordinate of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The bottom y coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+int tuiEllipseGetBottomY(const TuiEllipse ellipse);
+/*!
+ * @brief Get the width in tiles of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The width in tiles.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+int tuiEllipseGetTileWidth(const TuiEllipse ellipse);
+/*!
+ * @brief Get the height in tiles of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The height in tiles.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+int tuiEllipseGetTileHeight(const TuiEllipse ellipse);
+/*!
+ * @brief Get the bounding @ref TuiRect of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The bounding @ref TuiRect.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiRect tuiEllipseGetBoundingRect(const TuiEllipse ellipse);
+/*!
+ * @brief Get the leftmost @ref TuiPoint2 of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The leftmost @ref TuiPoint2
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiEllipseGetLeftPoint2(const TuiEllipse ellipse);
+/*!
+ * @brief Get the rightmost @ref TuiPoint2 of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The rightmost @ref TuiPoint2
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiEllipseGetRightPoint2(const TuiEllipse ellipse);
+/*!
+ * @brief Get the topmost @ref TuiPoint2 of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The topmost @ref TuiPoint2
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiEllipseGetTopPoint2(const TuiEllipse ellipse);
+/*!
+ * @brief Get the bottommost @ref TuiPoint2 of a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns The bottommost @ref TuiPoint2
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiEllipseGetBottomPoint2(const TuiEllipse ellipse);
+/*!
+ * @brief Get if a @ref TuiEllipse is degenerate. A degenerate @ref TuiEllipse has a horizontal or vertical radius greater than -0.5f and less than 0.5f.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ *
+ * @returns if the @ref TuiEllipse is degenerate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseIsDegenerate(const TuiEllipse ellipse);
+/*!
+ * @brief Get if a @ref TuiEllipse contains a @ref TuiPoint2.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ * @param point2 The @ref TuiPoint2
+ *
+ * @returns if the @ref TuiEllipse contains the @ref TuiPoint2.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseContainsPoint2(const TuiEllipse ellipse, const TuiPoint2 point2);
+/*!
+ * @brief Get if a @ref TuiEllipse contains a @ref TuiLine.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ * @param line The @ref TuiLine
+ *
+ * @returns if the @ref TuiEllipse contains the @ref TuiLine.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseContainsLine(const TuiEllipse ellipse, const TuiLine line);
+/*!
+ * @brief Get if a @ref TuiEllipse contains a @ref TuiRect.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ * @param rect The @ref TuiRect
+ *
+ * @returns if the @ref TuiEllipse contains the @ref TuiRect.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseContainsRect(const TuiEllipse ellipse, const TuiRect rect);
+/*!
+ * @brief Get if a @ref TuiEllipse intersects a @ref TuiLine.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ * @param line The @ref TuiLine
+ *
+ * @returns if the @ref TuiEllipse intersects the @ref TuiLine.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseIntersectsLine(const TuiEllipse ellipse, const TuiLine line);
+/*!
+ * @brief Get if a @ref TuiEllipse intersects a @ref TuiRect.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ * @param rect The @ref TuiRect
+ *
+ * @returns if the @ref TuiEllipse intersects the @ref TuiRect.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseIntersectsRect(const TuiEllipse ellipse, const TuiRect rect);
+/*!
+ * @brief Get if a @ref TuiEllipse intersects a @ref TuiCircle.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ * @param circle The @ref TuiCircle
+ *
+ * @returns if the @ref TuiEllipse intersects the @ref TuiCircle.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseIntersectsCircle(const TuiEllipse ellipse, const TuiCircle circle);
+/*!
+ * @brief Get if a @ref TuiEllipse intersects a @ref TuiEllipse.
+ *
+ * @param ellipse_1 The first @ref TuiEllipse.
+ * @param ellipse_2 The second @ref TuiEllipse.
+ *
+ * @returns if the @ref TuiEllipse intersects the @ref TuiEllipse.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseIntersectsEllipse(const TuiEllipse ellipse_1, const TuiEllipse ellipse_2);
+/*!
+ * @brief Get if a @ref TuiEllipse intersects a @ref TuiPolygon.
+ *
+ * @param ellipse The @ref TuiEllipse.
+ * @param polygon The @ref TuiPolygon
+ *
+ * @returns if the @ref TuiEllipse intersects the @ref TuiPolygon.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiEllipseIntersectsPolygon(const TuiEllipse ellipse, const TuiPolygon polygon);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
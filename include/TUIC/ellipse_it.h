@@ -0,0 +1,177 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file ellipse_it.h
+ */
+#ifndef TUIC_ELLIPSE_IT_H //header guard
+#define TUIC_ELLIPSE_IT_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+
+/*! @name Ellipse Iterator Functions
+ *
+ * Functions for manipulating @ref TuiEllipseIt.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiEllipseIt to iterate over the points within a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse to iterate.
+ *
+ * @returns The created @ref TuiEllipseIt.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiEllipseIt tuiEllipseIt(const TuiEllipse ellipse);
+/*!
+ * @brief Get if a @ref TuiEllipseIt position is out of its @ref TuiEllipse.
+ *
+ * @param it The @ref TuiEllipseIt to check.
+ *
+ * @returns If the iterator's position is out of the ellipse.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiEllipseItDone(const TuiEllipseIt it);
+/*!
+ * @brief Step a @ref TuiEllipseIt forward.
+ *
+ * @param it The @ref TuiEllipseIt to step.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+void tuiEllipseItStepForward(TuiEllipseIt* const it);
+/*!
+ * @brief Step a @ref TuiEllipseIt forward to the first point of the next @ref TuiSpan, skipping the rest of the current @ref TuiSpan.
+ *
+ * @param it The @ref TuiEllipseIt to step.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+void tuiEllipseItStepSpan(TuiEllipseIt* const it);
+/*!
+ * @brief Set the position of a @ref TuiEllipseIt to its start position.
+ *
+ * @param it The @ref TuiEllipseIt to set the position to start.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+void tuiEllipseItSetStart(TuiEllipseIt* const it);
+/*!
+ * @brief Get the @ref TuiEllipse being iterated over by a @ref TuiEllipseIt.
+ *
+ * @param it The @ref TuiEllipseIt to get the ellipse from.
+ *
+ * @returns The @ref TuiEllipse the iterator is iterating over.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiEllipse tuiEllipseItGetEllipse(const TuiEllipseIt it);
+/*!
+ * @brief Get the @ref TuiPoint2 at the current position of a @ref TuiEllipseIt.
+ *
+ * @param it The @ref TuiEllipseIt to get the point from.
+ *
+ * @returns The @ref TuiPoint2 at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiEllipseItGetPoint2(const TuiEllipseIt it);
+/*!
+ * @brief Get the @ref TuiSpan from the current position of a @ref TuiEllipseIt to the end of its current row span.
+ *
+ * @param it The @ref TuiEllipseIt to get the span from.
+ *
+ * @returns The @ref TuiSpan at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiSpan tuiEllipseItGetSpan(const TuiEllipseIt it);
+/*! @} */
+
+
+/*! @name Ellipse Iterator Macro Functions
+ *
+ * Macros for easily writing @ref TuiEllipseIt loops.
+ *  @{ */
+/*!
+ * @brief Macro function for easily constructing an ellipse iterator for loop without body.
+ *
+ * @param ellipse The @ref TuiEllipse to iterate over. Can pass in a function that returns a @ref TuiEllipse.
+ * @param iterator The name of the variable that will store the @ref TuiEllipseIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+#define TUI_ELLIPSE_ITERATE(ellipse, iterator) for(TuiEllipseIt iterator = tuiEllipseIt(ellipse); !tuiEllipseItDone(iterator); tuiEllipseItStepForward(&iterator))
+/*!
+ * @brief Macro function for easily constructing an ellipse iterator for loop over each @ref TuiSpan without body. Use @ref tuiEllipseItGetSpan to get the span in the loop body.
+ *
+ * @param ellipse The @ref TuiEllipse to iterate over. Can pass in a function that returns a @ref TuiEllipse.
+ * @param iterator The name of the variable that will store the @ref TuiEllipseIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+#define TUI_ELLIPSE_ITERATE_SPANS(ellipse, iterator) for(TuiEllipseIt iterator = tuiEllipseIt(ellipse); !tuiEllipseItDone(iterator); tuiEllipseItStepSpan(&iterator))
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file embedded_atlas.h
+ */
+#ifndef TUIC_EMBEDDED_ATLAS_H //header guard
+#define TUIC_EMBEDDED_ATLAS_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <stdint.h>
+
+/*!
+ * \brief Pre-decoded atlas pages and glyph coordinates compiled into a binary with the tuic_embed_atlas CMake function, so a @ref TuiAtlas can be created without file I/O or image decoding.
+ */
+typedef struct TuiEmbeddedAtlas
+{
+	/*!
+	 * \brief The width in pixels of every page.
+	 */
+	int width;
+	/*!
+	 * \brief The height in pixels of every page.
+	 */
+	int height;
+	/*!
+	 * \brief The amount of pages.
+	 */
+	int pages;
+	/*!
+	 * \brief The amount of 8 bit channels of every pixel, from 1 to 4.
+	 */
+	int channel_count;
+	/*!
+	 * \brief The amount of glyphs.
+	 */
+	int glyph_count;
+	/*!
+	 * \brief The amount of cell columns of every page of a uniform grid atlas, or 0 if the atlas has stpqp coordinates.
+	 */
+	int grid_columns;
+	/*!
+	 * \brief The amount of cell rows of every page of a uniform grid atlas, or 0 if the atlas has stpqp coordinates.
+	 */
+	int grid_rows;
+	/*!
+	 * \brief The pixels of every page one after another.
+	 */
+	const uint8_t* pixel_data;
+	/*!
+	 * \brief @ref TUI_STPQP_COORDINATES_PER_GLYPH floats for every glyph, or @ref TUI_NULL for a uniform grid atlas.
+	 */
+	const float* stpqp_coordinates;
+} TuiEmbeddedAtlas;
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file field_of_view.h
+ */
+#ifndef TUIC_FIELD_OF_VIEW_H //header guard
+#define TUIC_FIELD_OF_VIEW_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <TUIC/grid_shape_types.h>
+
+
+/*! @name Field Of View Functions
+ *
+ * Functions for computing what tiles can be seen from a position on a @ref TuiGridMask.
+ *  @{ */
+/*!
+ * @brief Compute the tiles visible from the center of a @ref TuiCircle with symmetric shadowcasting, and set them in a visible @ref TuiGridMask. Visibility is symmetric between floor tiles, and visible blocking tiles are set as well so the walls around a room are revealed.
+ *
+ * @param blocking_mask The @ref TuiGridMask of tiles that block sight. Tiles outside of the mask block sight.
+ * @param view_circle The viewer is at the center of the circle, and only tiles within its radius of the center can be visible.
+ * @param visible_mask The @ref TuiGridMask the visible tiles are set in. It must have the same dimensions as blocking_mask. Tiles that are not visible are left unchanged, so the mask should be cleared first unless the results of several viewers are being combined.
+ *
+ * @returns @ref TUI_RESULT_OK if the field of view was computed.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if the masks have different dimensions, or are the same mask.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads blocking_mask and only writes visible_mask, so it is thread safe as long as no other thread writes blocking_mask or accesses visible_mask at the same time.
+ */
+TuiResult tuiFieldOfViewCompute(TuiGridMask blocking_mask, const TuiCircle view_circle, TuiGridMask visible_mask);
+/*!
+ * @brief Compute the fields of view of many viewers at once, spread over several threads. Each viewer is computed exactly like @ref tuiFieldOfViewCompute.
+ *
+ * @param blocking_mask The @ref TuiGridMask of tiles that block sight, shared by every viewer.
+ * @param view_circles Array of view_count @ref TuiCircle, one for each viewer.
+ * @param visible_masks Array of view_count distinct @ref TuiGridMask, one for each viewer. Each must have the same dimensions as blocking_mask.
+ * @param view_count The amount of viewers.
+ * @param thread_count The most threads to use, including the calling thread. If it is less than 1 every hardware thread is used.
+ *
+ * @returns @ref TUI_RESULT_OK if every field of view was computed.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE without computing anything if view_count is negative, an array is @ref TUI_NULL while view_count is positive, or a visible mask has different dimensions than blocking_mask.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads blocking_mask and only writes the visible masks, so it is thread safe as long as no other thread writes blocking_mask or accesses the visible masks at the same time.
+ */
+TuiResult tuiFieldOfViewComputeMany(TuiGridMask blocking_mask, const TuiCircle* view_circles, TuiGridMask* visible_masks, const int view_count, const int thread_count);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,208 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file frame_stats.h
+ */
+#ifndef TUIC_FRAME_STATS_H //header guard
+#define TUIC_FRAME_STATS_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <TUIC/boolean.h>
+#include <stdint.h>
+
+/*!
+ * @brief What a timed draw drew.
+ */
+typedef enum TuiDrawTimingType_e
+{
+	TUI_DRAW_TIMING_INVALID = 0,
+	/*! A console was drawn to a panel or window. */
+	TUI_DRAW_TIMING_CONSOLE,
+	/*! A panel was drawn to a panel or window. */
+	TUI_DRAW_TIMING_PANEL,
+	/*! A texture or an atlas was drawn to a panel or window. */
+	TUI_DRAW_TIMING_TEXTURE,
+	/*! A window was drawn to a panel or window. */
+	TUI_DRAW_TIMING_WINDOW,
+	/*! A window was presented by @ref tuiWindowFrame. */
+	TUI_DRAW_TIMING_PRESENT,
+	TUI_DRAW_TIMING_FIRST = TUI_DRAW_TIMING_CONSOLE,
+	TUI_DRAW_TIMING_LAST = TUI_DRAW_TIMING_PRESENT
+} TuiDrawTimingType;
+
+/*!
+ * @brief The timing of a single draw, passed to the @ref tuiDrawTimingFunction.
+ */
+typedef struct TuiDrawTiming
+{
+	/*!
+	 * \brief The frame in which the draw was made.
+	 */
+	uint64_t frame;
+	/*!
+	 * \brief The @ref TuiDrawTimingType.
+	 */
+	TuiDrawTimingType type;
+	/*!
+	 * \brief The panel drawn to, or @ref TUI_NULL. It only identifies the panel, which may have been destroyed since.
+	 */
+	TuiPanel target_panel;
+	/*!
+	 * \brief The window drawn to or presented, or @ref TUI_NULL. It only identifies the window, which may have been destroyed since.
+	 */
+	TuiWindow target_window;
+	/*!
+	 * \brief Time spent on the CPU making the draw, including uploading console tiles.
+	 */
+	double cpu_milliseconds;
+	/*!
+	 * \brief Time the GPU spent on the draw.
+	 */
+	double gpu_milliseconds;
+} TuiDrawTiming;
+
+/*!
+ * @brief The timings of a whole frame, returned by @ref tuiGetFrameStats. A frame ends each time the first window presented after timing was enabled is presented with @ref tuiWindowFrame, so a frame that presents several windows is counted once.
+ */
+typedef struct TuiFrameStats
+{
+	/*!
+	 * \brief The frame the timings belong to. GPU times are read without waiting, so this is two frames behind the current one.
+	 */
+	uint64_t frame;
+	/*!
+	 * \brief The number of timed draws in the frame, not counting the present.
+	 */
+	int draw_count;
+	/*!
+	 * \brief Time spent on the CPU making draws, including uploads.
+	 */
+	double cpu_draw_milliseconds;
+	/*!
+	 * \brief Time spent on the CPU uploading console tiles to the GPU.
+	 */
+	double cpu_upload_milliseconds;
+	/*!
+	 * \brief Time spent on the CPU presenting every window of the frame.
+	 */
+	double cpu_present_milliseconds;
+	/*!
+	 * \brief Time the GPU spent drawing consoles.
+	 */
+	double gpu_console_milliseconds;
+	/*!
+	 * \brief Time the GPU spent drawing panels.
+	 */
+	double gpu_panel_milliseconds;
+	/*!
+	 * \brief Time the GPU spent drawing textures and atlases.
+	 */
+	double gpu_texture_milliseconds;
+	/*!
+	 * \brief Time the GPU spent drawing windows.
+	 */
+	double gpu_window_milliseconds;
+	/*!
+	 * \brief Time the GPU spent presenting the window that ended the frame. It is 0 if its query was not ready yet.
+	 */
+	double gpu_present_milliseconds;
+	/*!
+	 * \brief The sum of all GPU times of the frame.
+	 */
+	double gpu_total_milliseconds;
+	/*!
+	 * \brief The number of frames since timing was enabled whose GPU times were not ready in time and were dropped instead of waited on.
+	 */
+	uint64_t dropped_frame_count;
+} TuiFrameStats;
+
+/*!
+ * @brief Callback type called with the timing of every draw of a frame once its GPU times are known, set with @ref tuiSetDrawTimingCallback.
+ *
+ * @param timing The @ref TuiDrawTiming. It is only valid for the duration of the callback.
+ */
+typedef void (* tuiDrawTimingFunction)(const TuiDrawTiming* timing);
+
+/*! @name Frame Timing Functions
+ *
+ * Functions for measuring where the time of a frame goes.
+ *
+ * While timing is enabled, every draw to a panel or window and every present is timed on the CPU and, with a GPU timer query, on the GPU. The queries of each frame are read two frames later, when the GPU has usually finished them, and are never waited on: a frame whose queries are not ready yet is dropped.
+ *  @{ */
+/*!
+ * @brief Enable or disable frame timing. It is disabled by default, since the timer queries add a little work to every draw.
+ *
+ * @param enabled @ref TUI_TRUE to enable timing, or @ref TUI_FALSE to disable it.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_NOT_INITIALIZED if TUIC is not initialized. Returns @ref TUI_RESULT_ERROR_UNSUPPORTED_OPERATION with @ref TUI_GRAPHICS_BACKEND_SOFTWARE, which has no GPU to time.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiSetFrameTimingEnabled(TuiBoolean enabled);
+/*!
+ * @brief Get whether frame timing is enabled.
+ *
+ * @returns @ref TUI_TRUE if timing is enabled, otherwise @ref TUI_FALSE.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiBoolean tuiIsFrameTimingEnabled();
+/*!
+ * @brief Get the timings of the most recent frame whose GPU times are known.
+ *
+ * @param stats Pointer to where the @ref TuiFrameStats are stored.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_NOT_INITIALIZED if TUIC is not initialized. Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if no frame has been timed yet, in which case stats is left unchanged. Returns @ref TUI_RESULT_ERROR_UNSUPPORTED_OPERATION with @ref TUI_GRAPHICS_BACKEND_SOFTWARE.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiGetFrameStats(TuiFrameStats* stats);
+/*!
+ * @brief Set the function called with the timing of every draw and present, or @ref TUI_NULL for none.
+ *
+ * @param callback The @ref tuiDrawTimingFunction. It is called from within @ref tuiWindowFrame.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+void tuiSetDrawTimingCallback(tuiDrawTimingFunction callback);
+/*! @} */
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,221 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file glyph_cache.h
+ */
+#ifndef TUIC_GLYPH_CACHE_H //header guard
+#define TUIC_GLYPH_CACHE_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <TUIC/boolean.h>
+#include <stddef.h>
+
+
+/*!
+ * @brief Callback type used to rasterize a glyph when it is missing from a @ref TuiGlyphCache.
+ *
+ * @param user_data The user data given to the glyph cache.
+ * @param codepoint The Unicode codepoint to rasterize.
+ * @param max_width The width of a glyph cell in pixels.
+ * @param max_height The height of a glyph cell in pixels.
+ * @param channel_count The amount of 8 bit channels of each pixel: 1 for coverage, 2 for coverage and a foreground mask, 3 for RGB or 4 for RGBA.
+ * @param pixels Array of max_width * max_height pixels with channel_count channels in rows from top to bottom to draw the glyph into, starting from the top left. Every channel starts at 0.
+ * @param width Pointer to where the width of the drawn glyph is stored, at most max_width. Glyphs with a width or height of 0 are empty and share one blank slot.
+ * @param height Pointer to where the height of the drawn glyph is stored, at most max_height.
+ *
+ * @returns If the glyph was rasterized. Return @ref TUI_FALSE for codepoints the rasterizer does not have.
+ */
+typedef TuiBoolean (* tuiGlyphRasterizeFunction)(void* user_data, uint32_t codepoint, int max_width, int max_height, int channel_count, uint8_t* pixels, int* width, int* height);
+
+/*! @name Glyph Cache Functions
+ *
+ * Functions for caching glyphs that are rasterized on demand in the cells of the pages of a @ref TuiAtlas.
+ *
+ * Every cell of a page is a slot that holds one glyph, and the glyph index of a slot in the atlas never changes. When every slot is full the least recently used glyph is evicted, except for glyphs used since the last time the dirty glyphs were cleared, so every glyph index handed out for a frame stays valid until it is drawn. Only the slots that changed are dirty and need to be uploaded, which @ref tuiAtlasUpdateFromGlyphCache does.
+ *  @{ */
+/*!
+ * @brief Create an empty @ref TuiGlyphCache.
+ *
+ * @param glyph_cache Pointer to where the created @ref TuiGlyphCache is stored.
+ * @param page_width The width in pixels of every page.
+ * @param page_height The height in pixels of every page.
+ * @param page_count The amount of pages.
+ * @param cell_width The width in pixels of a glyph cell. Pages are split into as many whole cells as fit.
+ * @param cell_height The height in pixels of a glyph cell.
+ * @param channel_count The amount of 8 bit channels of each pixel. 1 channel coverage takes a quarter of the memory of RGBA and is drawn tinted by the tile foreground, which suits most fonts.
+ * @param rasterize_function The @ref tuiGlyphRasterizeFunction used to rasterize missing glyphs.
+ * @param user_data Pointer passed to every call of rasterize_function. Can be @ref TUI_NULL.
+ *
+ * @returns @ref TUI_RESULT_OK if the cache was created.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if a dimension or page_count is less than 1, a cell is larger than a page, channel_count is not 1 to 4, or rasterize_function is @ref TUI_NULL, or @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the cache could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiResult tuiGlyphCacheCreate(TuiGlyphCache* glyph_cache, const int page_width, const int page_height, const int page_count, const int cell_width, const int cell_height, const int channel_count, tuiGlyphRasterizeFunction rasterize_function, void* user_data);
+/*!
+ * @brief Destroy a @ref TuiGlyphCache.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache to destroy.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not used by another thread at the same time.
+ */
+void tuiGlyphCacheDestroy(TuiGlyphCache glyph_cache);
+/*!
+ * @brief Get the atlas glyph index of a codepoint, rasterizing it into a slot if it is not cached. Every empty glyph gets the index of the same blank slot.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ * @param codepoint The Unicode codepoint.
+ *
+ * @returns The glyph index of the codepoint in an atlas updated from the cache, or -1 if the rasterizer does not have the codepoint, every slot holds a glyph used since the dirty glyphs were last cleared, or memory for the dirty glyph could not be allocated.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not used by another thread at the same time.
+ */
+int tuiGlyphCacheGetGlyph(TuiGlyphCache glyph_cache, uint32_t codepoint);
+/*!
+ * @brief Get the page dimensions of a @ref TuiGlyphCache.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ * @param page_width Pointer to where the page width is stored. Can be @ref TUI_NULL.
+ * @param page_height Pointer to where the page height is stored. Can be @ref TUI_NULL.
+ * @param page_count Pointer to where the amount of pages is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not modified by another thread at the same time.
+ */
+void tuiGlyphCacheGetDimensions(TuiGlyphCache glyph_cache, int* page_width, int* page_height, int* page_count);
+/*!
+ * @brief Get the amount of glyph slots of a @ref TuiGlyphCache, which is also the glyph count of an atlas created from it.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ *
+ * @returns The amount of slots.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not modified by another thread at the same time.
+ */
+int tuiGlyphCacheGetSlotCount(TuiGlyphCache glyph_cache);
+/*!
+ * @brief Get the glyph indices of the slots of a @ref TuiGlyphCache that changed since the dirty glyphs were last cleared.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ * @param dirty_count Pointer to where the amount of dirty glyphs is stored.
+ *
+ * @returns Pointer to the dirty glyph indices. It stays valid until the next call to @ref tuiGlyphCacheGetGlyph or @ref tuiGlyphCacheClearDirtyGlyphs.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not modified by another thread at the same time.
+ */
+const int* tuiGlyphCacheGetDirtyGlyphs(TuiGlyphCache glyph_cache, int* dirty_count);
+/*!
+ * @brief Get the rasterized pixels of the dirty glyphs of a @ref TuiGlyphCache.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ *
+ * @returns Pointer to one cell of pixels for every dirty glyph, in the same order as @ref tuiGlyphCacheGetDirtyGlyphs. It stays valid until the next call to @ref tuiGlyphCacheGetGlyph or @ref tuiGlyphCacheClearDirtyGlyphs.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not modified by another thread at the same time.
+ */
+const uint8_t* tuiGlyphCacheGetDirtyGlyphPixels(TuiGlyphCache glyph_cache);
+/*!
+ * @brief Mark every dirty glyph of a @ref TuiGlyphCache as uploaded, and allow every glyph used so far to be evicted. Call it once per frame after the glyphs are uploaded, which @ref tuiAtlasUpdateFromGlyphCache does.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not used by another thread at the same time.
+ */
+void tuiGlyphCacheClearDirtyGlyphs(TuiGlyphCache glyph_cache);
+/*!
+ * @brief Get the stpqp coordinates of every slot of a @ref TuiGlyphCache, with @ref TUI_STPQP_COORDINATES_PER_GLYPH floats for each slot.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ *
+ * @returns Pointer to the coordinates. It stays valid until the cache is destroyed.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not modified by another thread at the same time.
+ */
+const float* tuiGlyphCacheGetStpqpCoordinates(TuiGlyphCache glyph_cache);
+/*!
+ * @brief Get the lookup statistics of a @ref TuiGlyphCache.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ * @param hit_count Pointer to where the amount of lookups that found a cached glyph is stored. Can be @ref TUI_NULL.
+ * @param miss_count Pointer to where the amount of lookups that had to rasterize a glyph is stored. Can be @ref TUI_NULL.
+ * @param eviction_count Pointer to where the amount of glyphs evicted to make room is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not modified by another thread at the same time.
+ */
+void tuiGlyphCacheGetStatistics(TuiGlyphCache glyph_cache, size_t* hit_count, size_t* miss_count, size_t* eviction_count);
+/*!
+ * @brief Reset the lookup statistics of a @ref TuiGlyphCache to 0.
+ *
+ * @param glyph_cache The @ref TuiGlyphCache.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGlyphCache passed to it, so it is thread safe as long as that @ref TuiGlyphCache is not used by another thread at the same time.
+ */
+void tuiGlyphCacheResetStatistics(TuiGlyphCache glyph_cache);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,78 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file glyph_metrics.h
+ */
+#ifndef TUIC_GLYPH_METRICS_H //header guard
+#define TUIC_GLYPH_METRICS_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <stdint.h>
+
+/*!
+ * \brief How a glyph of a @ref TuiAtlas is placed on a line of proportional text, in pixels.
+ */
+typedef struct TuiGlyphMetrics
+{
+	/*!
+	 * \brief The distance from the pen position of the glyph to the pen position of the next glyph.
+	 */
+	int advance;
+	/*!
+	 * \brief The distance from the pen position to the left edge of the glyph tile.
+	 */
+	int bearing_x;
+	/*!
+	 * \brief The distance from the baseline up to the top edge of the glyph tile.
+	 */
+	int bearing_y;
+	/*!
+	 * \brief The width of the glyph tile, or 0 if the glyph only advances the pen, like a space.
+	 */
+	int width;
+	/*!
+	 * \brief The height of the glyph tile, or 0 if the glyph only advances the pen, like a space.
+	 */
+	int height;
+} TuiGlyphMetrics;
+
+/*!
+ * \brief An adjustment in pixels to the advance between two glyphs of a @ref TuiAtlas that are drawn one after another.
+ */
+typedef struct TuiKerningPair
+{
+	/*!
+	 * \brief The glyph on the left.
+	 */
+	uint16_t left_glyph;
+	/*!
+	 * \brief The glyph on the right.
+	 */
+	uint16_t right_glyph;
+	/*!
+	 * \brief The amount of pixels added to the advance of the left glyph, which is negative to move the glyphs closer.
+	 */
+	int adjustment;
+} TuiKerningPair;
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
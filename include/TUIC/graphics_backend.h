@@ -0,0 +1,45 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file graphics_backend.h
+ */
+#ifndef TUIC_GRAPHICS_BACKEND_H //header guard
+#define TUIC_GRAPHICS_BACKEND_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+
+/*!
+ * @brief What TUIC renders panels, textures, atlases and consoles with, set with @ref tuiSetGraphicsBackend before TUIC is initialized.
+ */
+typedef enum TuiGraphicsBackend_e
+{
+	TUI_GRAPHICS_BACKEND_INVALID = 0,
+	/*! OpenGL 3.3 through GLFW. This is the default, and the only backend that supports windows. */
+	TUI_GRAPHICS_BACKEND_OPENGL33,
+	/*! Multithreaded rasterization into memory on the CPU, with the same tile format, sampling and blending as @ref TUI_GRAPHICS_BACKEND_OPENGL33. It needs no graphics context or display, so it works on headless machines and can serve as a reference for the output of the graphics path. Windows can not be created with it. */
+	TUI_GRAPHICS_BACKEND_SOFTWARE,
+	TUI_GRAPHICS_BACKEND_FIRST = TUI_GRAPHICS_BACKEND_OPENGL33,
+	TUI_GRAPHICS_BACKEND_LAST = TUI_GRAPHICS_BACKEND_SOFTWARE
+} TuiGraphicsBackend;
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file graphics_validation.h
+ */
+#ifndef TUIC_GRAPHICS_VALIDATION_H //header guard
+#define TUIC_GRAPHICS_VALIDATION_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/boolean.h>
+
+/*!
+ * @brief How much the graphics backend checks its own calls, set with @ref tuiSetGraphicsValidation.
+ */
+typedef enum TuiGraphicsValidation_e
+{
+	TUI_GRAPHICS_VALIDATION_INVALID = 0,
+	/*! No checking at all. */
+	TUI_GRAPHICS_VALIDATION_OFF,
+	/*! Driver messages are reported asynchronously through the KHR_debug message callback, without waiting on the driver after each call. */
+	TUI_GRAPHICS_VALIDATION_DEBUG_CALLBACK,
+	/*! Driver messages are reported synchronously, and every graphics call is followed by an error check that makes the calling function fail. This is the slowest level. */
+	TUI_GRAPHICS_VALIDATION_FULL,
+	TUI_GRAPHICS_VALIDATION_FIRST = TUI_GRAPHICS_VALIDATION_OFF,
+	TUI_GRAPHICS_VALIDATION_LAST = TUI_GRAPHICS_VALIDATION_FULL
+} TuiGraphicsValidation;
+
+/*!
+ * @brief Callback type used for graphics driver messages, set with @ref tuiSetGraphicsDebugMessageCallback.
+ *
+ * @param message The message of the driver. It is only valid for the duration of the callback.
+ * @param is_error @ref TUI_TRUE if the message reports an error, or @ref TUI_FALSE if it is a warning or performance hint.
+ */
+typedef void (* tuiGraphicsDebugMessageFunction)(const char* message, TuiBoolean is_error);
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
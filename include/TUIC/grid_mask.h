@@ -0,0 +1,157 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file grid_mask.h
+ */
+#ifndef TUIC_GRID_MASK_H //header guard
+#define TUIC_GRID_MASK_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+
+/*! @name Grid Mask Functions
+ *
+ * Functions for manipulating @ref TuiGridMask.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiGridMask with every tile unset.
+ *
+ * @param grid_mask Pointer to where the created @ref TuiGridMask is stored.
+ * @param width The width of the mask in tiles.
+ * @param height The height of the mask in tiles.
+ *
+ * @returns @ref TUI_RESULT_OK if the mask was created.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if width or height is less than 1, or @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the tiles could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiResult tuiGridMaskCreate(TuiGridMask* grid_mask, const int width, const int height);
+/*!
+ * @brief Destroy a @ref TuiGridMask and free its tiles.
+ *
+ * @param grid_mask The @ref TuiGridMask to destroy.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGridMask passed to it, so it is thread safe as long as that @ref TuiGridMask is not modified by another thread at the same time.
+ */
+void tuiGridMaskDestroy(TuiGridMask grid_mask);
+/*!
+ * @brief Get the dimensions of a @ref TuiGridMask in tiles.
+ *
+ * @param grid_mask The @ref TuiGridMask.
+ * @param width Pointer to where the width is stored. Can be @ref TUI_NULL.
+ * @param height Pointer to where the height is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGridMask passed to it, so it is thread safe as long as that @ref TuiGridMask is not modified by another thread at the same time.
+ */
+void tuiGridMaskGetDimensions(TuiGridMask grid_mask, int* width, int* height);
+/*!
+ * @brief Set or unset every tile of a @ref TuiGridMask.
+ *
+ * @param grid_mask The @ref TuiGridMask.
+ * @param value If the tiles are set.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGridMask passed to it, so it is thread safe as long as that @ref TuiGridMask is not modified by another thread at the same time.
+ */
+void tuiGridMaskClear(TuiGridMask grid_mask, const TuiBoolean value);
+/*!
+ * @brief Get if a tile of a @ref TuiGridMask is set.
+ *
+ * @param grid_mask The @ref TuiGridMask.
+ * @param x The x position of the tile.
+ * @param y The y position of the tile.
+ *
+ * @returns If the tile is set. Tiles outside of the mask are never set.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGridMask passed to it, so it is thread safe as long as that @ref TuiGridMask is not modified by another thread at the same time.
+ */
+TuiBoolean tuiGridMaskGet(TuiGridMask grid_mask, const int x, const int y);
+/*!
+ * @brief Set or unset a tile of a @ref TuiGridMask. Tiles outside of the mask are ignored.
+ *
+ * @param grid_mask The @ref TuiGridMask.
+ * @param x The x position of the tile.
+ * @param y The y position of the tile.
+ * @param value If the tile is set.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGridMask passed to it, so it is thread safe as long as that @ref TuiGridMask is not modified by another thread at the same time.
+ */
+void tuiGridMaskSet(TuiGridMask grid_mask, const int x, const int y, const TuiBoolean value);
+/*!
+ * @brief Set or unset every tile of a @ref TuiGridMask covered by a @ref TuiCompositeShape. The shape is written one @ref TuiSpan at a time, and tiles outside of the mask are ignored.
+ *
+ * @param grid_mask The @ref TuiGridMask.
+ * @param composite_shape The @ref TuiCompositeShape to write.
+ * @param value If the covered tiles are set.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiGridMask passed to it, so it is thread safe as long as that @ref TuiGridMask is not modified by another thread at the same time.
+ */
+void tuiGridMaskSetCompositeShape(TuiGridMask grid_mask, const TuiCompositeShape composite_shape, const TuiBoolean value);
+/*!
+ * @brief Get the tiles of a @ref TuiGridMask. The tiles are stored in rows from top to bottom with one byte per tile that is 1 if the tile is set and 0 if it is not.
+ *
+ * @param grid_mask The @ref TuiGridMask.
+ *
+ * @returns Pointer to the width * height tiles of the mask. It stays valid until the mask is destroyed.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiGridMask passed to it, so it is thread safe as long as that @ref TuiGridMask is not modified by another thread at the same time.
+ */
+uint8_t* tuiGridMaskGetData(TuiGridMask grid_mask);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -25,6 +25,7 @@
 extern "C" {
 #endif
 #include <TUIC/box_part.h>
+#include <TUIC/shape_operation.h>
 
 
 /*! @name Grid Shape Struct Types
@@ -522,6 +523,329 @@ typedef struct TuiCropRing
 	 */
 	int crop_height;
 } TuiCropRing;
+/*!
+ * \brief A horizontal run of tiles on a single row of a grid shape.
+ */
+typedef struct TuiSpan
+{
+	/*!
+	 * \brief The y position of the row of the span.
+	 */
+	int y;
+	/*!
+	 * \brief The x position of the leftmost tile of the span.
+	 */
+	int left_x;
+	/*!
+	 * \brief The x position of the rightmost tile of the span.
+	 */
+	int right_x;
+} TuiSpan;
+/*!
+ * \brief The maximum amount of vertices of a @ref TuiPolygon. Polygons with more vertices are invalid and contain no tiles.
+ */
+#define TUI_POLYGON_MAX_POINT_COUNT 256
+/*!
+ * \brief A 2D filled polygon made from a caller owned array of vertex @ref TuiPoint2.
+ */
+typedef struct TuiPolygon
+{
+	/*!
+	 * \brief The vertices of the polygon in order. The last vertex is connected back to the first.
+	 */
+	const TuiPoint2* points;
+	/*!
+	 * \brief The amount of vertices in the polygon.
+	 */
+	int point_count;
+} TuiPolygon;
+/*!
+ * \brief The maximum amount of disjoint spans a @ref TuiPolygonIt can hold for a single row. Every span of a row touches at least two edges of its polygon, so a row of a valid polygon never has more spans than this.
+ */
+#define TUI_POLYGON_IT_MAX_ROW_SPANS (TUI_POLYGON_MAX_POINT_COUNT / 2)
+/*!
+ * \brief A 2D polygon iterator.
+ */
+typedef struct TuiPolygonIt
+{
+	/*!
+	 * \brief The vertices of the polygon.
+	 */
+	const TuiPoint2* const points;
+	/*!
+	 * \brief The amount of vertices in the polygon.
+	 */
+	const int point_count;
+	/*!
+	 * \brief The top y position of the polygon.
+	 */
+	const int top_y;
+	/*!
+	 * \brief The bottom y position of the polygon.
+	 */
+	const int bottom_y;
+	/*!
+	 * \brief The amount of spans in the current row of the polygon.
+	 */
+	int row_span_count;
+	/*!
+	 * \brief The index of the current span in the current row of the polygon.
+	 */
+	int row_span_index;
+	/*!
+	 * \brief The left and right x positions of each span in the current row of the polygon, sorted from left to right.
+	 */
+	int row_span_xs[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	/*!
+	 * \brief The current x position of the iterator.
+	 */
+	int cur_x_position;
+	/*!
+	 * \brief The current y position of the iterator.
+	 */
+	int cur_y_position;
+} TuiPolygonIt;
+/*!
+ * \brief A 2D axis aligned ellipse.
+ */
+typedef struct TuiEllipse
+{
+	/*!
+	 * \brief The x position of the center of the ellipse.
+	 */
+	int center_x;
+	/*!
+	 * \brief The y position of the center of the ellipse.
+	 */
+	int center_y;
+	/*!
+	 * \brief The horizontal radius of the ellipse.
+	 */
+	float radius_x;
+	/*!
+	 * \brief The vertical radius of the ellipse.
+	 */
+	float radius_y;
+} TuiEllipse;
+/*!
+ * \brief A 2D ellipse iterator.
+ */
+typedef struct TuiEllipseIt
+{
+	/*!
+	 * \brief The horizontal radius of the ellipse.
+	 */
+	const float radius_x;
+	/*!
+	 * \brief The vertical radius of the ellipse.
+	 */
+	const float radius_y;
+	/*!
+	 * \brief The x position of the center of the ellipse.
+	 */
+	const int center_x;
+	/*!
+	 * \brief The y position of the center of the ellipse.
+	 */
+	const int center_y;
+	/*!
+	 * \brief The top y position of the ellipse.
+	 */
+	const int top_y;
+	/*!
+	 * \brief The bottom y position of the ellipse.
+	 */
+	const int bottom_y;
+	/*!
+	 * \brief The left x position of the current row of the ellipse.
+	 */
+	int row_left_x;
+	/*!
+	 * \brief The right x position of the current row of the ellipse.
+	 */
+	int row_right_x;
+	/*!
+	 * \brief The current x position of the iterator.
+	 */
+	int cur_x_position;
+	/*!
+	 * \brief The current y position of the iterator.
+	 */
+	int cur_y_position;
+} TuiEllipseIt;
+/*!
+ * \brief The kind of grid shape stored in a @ref TuiShape.
+ */
+typedef enum TuiShapeType
+{
+	/*!
+	 * \brief The shape type is invalid. A @ref TuiShape of this type has no tiles.
+	 */
+	TUI_SHAPE_TYPE_INVALID = 0,
+	/*!
+	 * \brief The shape is a @ref TuiRect.
+	 */
+	TUI_SHAPE_TYPE_RECT = 1,
+	/*!
+	 * \brief The shape is a @ref TuiBox.
+	 */
+	TUI_SHAPE_TYPE_BOX = 2,
+	/*!
+	 * \brief The shape is a @ref TuiCropBox.
+	 */
+	TUI_SHAPE_TYPE_CROP_BOX = 3,
+	/*!
+	 * \brief The shape is a @ref TuiCircle.
+	 */
+	TUI_SHAPE_TYPE_CIRCLE = 4,
+	/*!
+	 * \brief The shape is a @ref TuiCropCircle.
+	 */
+	TUI_SHAPE_TYPE_CROP_CIRCLE = 5,
+	/*!
+	 * \brief The shape is a @ref TuiRing.
+	 */
+	TUI_SHAPE_TYPE_RING = 6,
+	/*!
+	 * \brief The shape is a @ref TuiCropRing.
+	 */
+	TUI_SHAPE_TYPE_CROP_RING = 7,
+	/*!
+	 * \brief The shape is a @ref TuiPolygon.
+	 */
+	TUI_SHAPE_TYPE_POLYGON = 8,
+	/*!
+	 * \brief The shape is a @ref TuiEllipse.
+	 */
+	TUI_SHAPE_TYPE_ELLIPSE = 9,
+	/*!
+	 * \brief The first valid shape type value.
+	 */
+	TUI_SHAPE_TYPE_FIRST = TUI_SHAPE_TYPE_RECT,
+	/*!
+	 * \brief The last valid shape type value.
+	 */
+	TUI_SHAPE_TYPE_LAST = TUI_SHAPE_TYPE_ELLIPSE
+} TuiShapeType;
+/*!
+ * \brief Any filled or outlined grid shape that can be rasterized into rows of @ref TuiSpan.
+ */
+typedef struct TuiShape
+{
+	/*!
+	 * \brief The kind of grid shape stored in the union.
+	 */
+	TuiShapeType type;
+	union
+	{
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_RECT.
+		 */
+		TuiRect rect;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_BOX.
+		 */
+		TuiBox box;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_CROP_BOX.
+		 */
+		TuiCropBox crop_box;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_CIRCLE.
+		 */
+		TuiCircle circle;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_CROP_CIRCLE.
+		 */
+		TuiCropCircle crop_circle;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_RING.
+		 */
+		TuiRing ring;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_CROP_RING.
+		 */
+		TuiCropRing crop_ring;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_POLYGON.
+		 */
+		TuiPolygon polygon;
+		/*!
+		 * \brief The shape if type is @ref TUI_SHAPE_TYPE_ELLIPSE.
+		 */
+		TuiEllipse ellipse;
+	};
+} TuiShape;
+/*!
+ * \brief A grid shape made by combining a caller owned array of @ref TuiShape with @ref TuiShapeOperation from left to right.
+ *
+ * The first shape is the starting set of tiles, and each following shape is combined into that set with the operation of the same index minus one.
+ */
+typedef struct TuiCompositeShape
+{
+	/*!
+	 * \brief The shapes to combine in order.
+	 */
+	const TuiShape* shapes;
+	/*!
+	 * \brief The operations used to combine each shape after the first into the result. Has one less element than shapes.
+	 */
+	const TuiShapeOperation* operations;
+	/*!
+	 * \brief The amount of shapes.
+	 */
+	int shape_count;
+} TuiCompositeShape;
+/*!
+ * \brief The maximum amount of disjoint spans a single row of a @ref TuiCompositeShape can hold while it is being evaluated. Every row of a single valid shape fits, but rows of combined shapes with more disjoint spans than this have their rightmost spans merged together.
+ */
+#define TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS TUI_POLYGON_IT_MAX_ROW_SPANS
+/*!
+ * \brief A 2D composite shape iterator.
+ */
+typedef struct TuiCompositeShapeIt
+{
+	/*!
+	 * \brief The shapes being combined.
+	 */
+	const TuiShape* const shapes;
+	/*!
+	 * \brief The operations used to combine the shapes.
+	 */
+	const TuiShapeOperation* const operations;
+	/*!
+	 * \brief The amount of shapes.
+	 */
+	const int shape_count;
+	/*!
+	 * \brief The top y position of the composite shape.
+	 */
+	const int top_y;
+	/*!
+	 * \brief The bottom y position of the composite shape.
+	 */
+	const int bottom_y;
+	/*!
+	 * \brief The amount of spans in the current row of the composite shape.
+	 */
+	int row_span_count;
+	/*!
+	 * \brief The index of the current span in the current row of the composite shape.
+	 */
+	int row_span_index;
+	/*!
+	 * \brief The left and right x positions of each span in the current row of the composite shape, sorted from left to right.
+	 */
+	int row_span_xs[TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS * 2];
+	/*!
+	 * \brief The current x position of the iterator.
+	 */
+	int cur_x_position;
+	/*!
+	 * \brief The current y position of the iterator.
+	 */
+	int cur_y_position;
+} TuiCompositeShapeIt;
 /*! @} */
 
 
@@ -34,6 +34,39 @@ typedef TuiConsole_s* TuiConsole;
 typedef TuiWindow_s* TuiWindow;
 typedef TuiPanel_s* TuiPanel;
 
+#define TUI_PANEL_MAX_CONSOLE_DRAWS 65536
+
+/*!
+ * \brief A draw of a @ref TuiConsole to a rectangle of a @ref TuiPanel, for @ref tuiPanelDrawConsoles.
+ */
+typedef struct TuiConsoleDraw
+{
+	/*!
+	 * \brief The @ref TuiConsole to draw.
+	 */
+	TuiConsole console;
+	/*!
+	 * \brief The @ref TuiAtlas of the glyphs of the console.
+	 */
+	TuiAtlas atlas;
+	/*!
+	 * \brief The left edge in pixels of the rectangle of the panel to draw to.
+	 */
+	int left_x;
+	/*!
+	 * \brief The right edge in pixels of the rectangle.
+	 */
+	int right_x;
+	/*!
+	 * \brief The top edge in pixels of the rectangle.
+	 */
+	int top_y;
+	/*!
+	 * \brief The bottom edge in pixels of the rectangle.
+	 */
+	int bottom_y;
+} TuiConsoleDraw;
+
 TuiResult tuiPanelCreate(TuiPanel* panel, int pixel_width, int pixel_height);
 
 void tuiPanelDestroy(TuiPanel panel);
@@ -46,10 +79,20 @@ TuiResult tuiPanelSetPixelDimensions(TuiPanel panel, int pixel_width, int pixel_
 
 void tuiPanelGetPixelDimensions(TuiPanel panel, int* pixel_width, int* pixel_height);
 
+TuiResult tuiPanelSetDepthStencil(TuiPanel panel, TuiBoolean depth_stencil);
+
+TuiBoolean tuiPanelHasDepthStencil(TuiPanel panel);
+
+TuiResult tuiPanelSetLabel(TuiPanel panel, const char* label);
+
+const char* tuiPanelGetLabel(TuiPanel panel);
+
 TuiResult tuiPanelDrawConsole(TuiPanel panel, TuiAtlas atlas, TuiConsole console);
 
 TuiResult tuiPanelDrawConsoleTransformed(TuiPanel panel, TuiAtlas atlas, TuiConsole console, int left_x, int right_x, int top_y, int bottom_y);
 
+TuiResult tuiPanelDrawConsoles(TuiPanel panel, const TuiConsoleDraw* draws, int draw_count);
+
 TuiResult tuiPanelDrawPanel(TuiPanel panel, TuiPanel subject_panel);
 
 TuiResult tuiPanelDrawPanelTransformed(TuiPanel panel, TuiPanel subject_panel, int left_x, int right_x, int top_y, int bottom_y);
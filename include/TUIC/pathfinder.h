@@ -0,0 +1,199 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file pathfinder.h
+ */
+#ifndef TUIC_PATHFINDER_H //header guard
+#define TUIC_PATHFINDER_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+/*! @name Path Costs
+ *
+ * Path costs are integers where moving to a tile costs its tile cost times the step cost of the move.
+ *  @{ */
+/*!
+ * @brief The cost of a horizontal or vertical step onto a tile with a tile cost of 1.
+ */
+#define TUI_PATH_ORTHOGONAL_STEP_COST 10
+/*!
+ * @brief The cost of a diagonal step onto a tile with a tile cost of 1.
+ */
+#define TUI_PATH_DIAGONAL_STEP_COST 14
+/*!
+ * @brief The distance of a tile that can not reach any source of a distance map, or the cost of a path that was not found.
+ */
+#define TUI_PATH_UNREACHABLE INT32_MAX
+/*! @} */
+
+/*! @name Pathfinder Functions
+ *
+ * Functions for finding paths on a grid of tiles with a reusable @ref TuiPathfinder.
+ *
+ * Every search takes an optional blocking @ref TuiGridMask and an optional array of tile costs. A tile can be walked on if it is inside the grid, is not set in the blocking mask, and does not have a tile cost of 0. Tile costs are stored one byte per tile in rows from top to bottom, and a @ref TUI_NULL array gives every tile a cost of 1. Diagonal steps are never allowed to cut the corner of a tile that can not be walked on.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiPathfinder for grids of the given dimensions. All of its memory is allocated here, so searches never allocate.
+ *
+ * @param pathfinder Pointer to where the created @ref TuiPathfinder is stored.
+ * @param width The width of the grid in tiles.
+ * @param height The height of the grid in tiles.
+ *
+ * @returns @ref TUI_RESULT_OK if the pathfinder was created.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if width or height is less than 1 or the grid is too large for every path cost to fit in an int32_t, or @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if the scratch memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiResult tuiPathfinderCreate(TuiPathfinder* pathfinder, const int width, const int height);
+/*!
+ * @brief Destroy a @ref TuiPathfinder and free its scratch memory.
+ *
+ * @param pathfinder The @ref TuiPathfinder to destroy.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiPathfinder passed to it, so it is thread safe as long as that @ref TuiPathfinder is not used by another thread at the same time.
+ */
+void tuiPathfinderDestroy(TuiPathfinder pathfinder);
+/*!
+ * @brief Get the dimensions of the grids a @ref TuiPathfinder searches.
+ *
+ * @param pathfinder The @ref TuiPathfinder.
+ * @param width Pointer to where the width is stored. Can be @ref TUI_NULL.
+ * @param height Pointer to where the height is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiPathfinder passed to it, so it is thread safe as long as that @ref TuiPathfinder is not used by another thread at the same time.
+ */
+void tuiPathfinderGetDimensions(TuiPathfinder pathfinder, int* width, int* height);
+/*!
+ * @brief Find the cheapest path between two tiles with A*.
+ *
+ * @param pathfinder The @ref TuiPathfinder whose scratch memory is used.
+ * @param blocking_mask The @ref TuiGridMask of tiles that can not be walked on. Can be @ref TUI_NULL.
+ * @param tile_costs Array of width * height tile costs. Can be @ref TUI_NULL.
+ * @param start The tile the path starts on.
+ * @param goal The tile the path ends on.
+ * @param allow_diagonal If diagonal steps are allowed.
+ * @param path Array the path is written to, starting with start and ending with goal. Only the first path_capacity tiles are written. Can be @ref TUI_NULL to only get the length.
+ * @param path_capacity The amount of tiles path can hold.
+ * @param path_length Pointer to where the full amount of tiles in the path is stored. It is 0 if there is no path.
+ *
+ * @returns @ref TUI_RESULT_OK if the search was done, even if no path was found.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if blocking_mask has different dimensions than the pathfinder or path_capacity is negative.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only writes the @ref TuiPathfinder and path passed to it, so it is thread safe as long as they are not used by another thread at the same time. Each thread should search with its own @ref TuiPathfinder.
+ */
+TuiResult tuiPathfinderFindPath(TuiPathfinder pathfinder, TuiGridMask blocking_mask, const uint8_t* tile_costs, const TuiPoint2 start, const TuiPoint2 goal, const TuiBoolean allow_diagonal, TuiPoint2* path, const int path_capacity, int* path_length);
+/*!
+ * @brief Find the shortest path between two tiles with Jump Point Search. Diagonal steps are always allowed and every tile costs 1, which lets long straight runs of open tiles be skipped instead of searched tile by tile. The path has the same cost as one found by @ref tuiPathfinderFindPath with the same blocking mask.
+ *
+ * @param pathfinder The @ref TuiPathfinder whose scratch memory is used.
+ * @param blocking_mask The @ref TuiGridMask of tiles that can not be walked on.
+ * @param start The tile the path starts on.
+ * @param goal The tile the path ends on.
+ * @param path Array the path is written to, starting with start and ending with goal, with every tile between jump points filled in. Only the first path_capacity tiles are written. Can be @ref TUI_NULL to only get the length.
+ * @param path_capacity The amount of tiles path can hold.
+ * @param path_length Pointer to where the full amount of tiles in the path is stored. It is 0 if there is no path.
+ *
+ * @returns @ref TUI_RESULT_OK if the search was done, even if no path was found.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if blocking_mask has different dimensions than the pathfinder or path_capacity is negative.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only writes the @ref TuiPathfinder and path passed to it, so it is thread safe as long as they are not used by another thread at the same time. Each thread should search with its own @ref TuiPathfinder.
+ */
+TuiResult tuiPathfinderJumpPointSearch(TuiPathfinder pathfinder, TuiGridMask blocking_mask, const TuiPoint2 start, const TuiPoint2 goal, TuiPoint2* path, const int path_capacity, int* path_length);
+/*!
+ * @brief Get the cost of the path found by the last search of a @ref TuiPathfinder.
+ *
+ * @param pathfinder The @ref TuiPathfinder.
+ *
+ * @returns The cost of the path, or @ref TUI_PATH_UNREACHABLE if the last search found no path or was not a path search.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiPathfinder passed to it, so it is thread safe as long as that @ref TuiPathfinder is not used by another thread at the same time.
+ */
+int32_t tuiPathfinderGetLastPathCost(TuiPathfinder pathfinder);
+/*!
+ * @brief Compute a distance map with multi source Dijkstra. The distance of each tile is the cost of the cheapest path from it to any of the sources, which makes the map a flow field that every tile can follow to its nearest source with @ref tuiDistanceMapGetNextStep.
+ *
+ * @param pathfinder The @ref TuiPathfinder whose scratch memory is used.
+ * @param blocking_mask The @ref TuiGridMask of tiles that can not be walked on. Can be @ref TUI_NULL.
+ * @param tile_costs Array of width * height tile costs. Can be @ref TUI_NULL.
+ * @param sources Array of source_count source tiles. Sources that can not be walked on are ignored.
+ * @param source_count The amount of sources.
+ * @param allow_diagonal If diagonal steps are allowed.
+ * @param distances Array of width * height distances the map is written to, in rows from top to bottom. Tiles that can not reach a source are @ref TUI_PATH_UNREACHABLE.
+ *
+ * @returns @ref TUI_RESULT_OK if the map was computed.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if blocking_mask has different dimensions than the pathfinder, source_count is negative, or sources is @ref TUI_NULL while source_count is positive.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only writes the @ref TuiPathfinder and distances passed to it, so it is thread safe as long as they are not used by another thread at the same time. Each thread should search with its own @ref TuiPathfinder.
+ */
+TuiResult tuiPathfinderComputeDistanceMap(TuiPathfinder pathfinder, TuiGridMask blocking_mask, const uint8_t* tile_costs, const TuiPoint2* sources, const int source_count, const TuiBoolean allow_diagonal, int32_t* distances);
+/*!
+ * @brief Get the next step from a tile towards the nearest source of a distance map computed by @ref tuiPathfinderComputeDistanceMap. Following the steps from any reachable tile walks a cheapest path to a source.
+ *
+ * @param distances The distance map.
+ * @param tile_costs The tile costs the map was computed with. Can be @ref TUI_NULL.
+ * @param width The width of the map in tiles.
+ * @param height The height of the map in tiles.
+ * @param point The tile to step from.
+ * @param allow_diagonal If the map was computed with diagonal steps allowed.
+ *
+ * @returns The neighbouring tile to step to, or point itself if it is a source, can not reach a source, or is outside of the map.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not write memory, so it is thread safe as long as the distance map is not modified by another thread at the same time.
+ */
+TuiPoint2 tuiDistanceMapGetNextStep(const int32_t* distances, const uint8_t* tile_costs, const int width, const int height, const TuiPoint2 point, const TuiBoolean allow_diagonal);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file pixel_readback.h
+ */
+#ifndef TUIC_PIXEL_READBACK_H //header guard
+#define TUIC_PIXEL_READBACK_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <TUIC/boolean.h>
+#include <stdint.h>
+
+
+/*! @name Pixel Readback Functions
+ *
+ * Functions for reading the pixels of panels and windows back from the GPU without waiting for it, unlike @ref tuiPanelGetPixels.
+ *
+ * A capture is copied into GPU memory that the CPU can read, and the GPU finishes it in the background. Poll @ref tuiPixelReadbackIsReady on later frames, or map the pixels when they are needed, which only waits if the GPU has not finished yet. The pixels are flipped on the GPU while they are copied, so they come back in rows from top to bottom. With @ref TUI_GRAPHICS_BACKEND_SOFTWARE a panel capture is copied immediately and is ready at once, and windows can not be captured.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiPixelReadback with no capture.
+ *
+ * @param pixel_readback Pointer to where the created @ref TuiPixelReadback is stored.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_NOT_INITIALIZED if TUIC is not initialized. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiPixelReadbackCreate(TuiPixelReadback* pixel_readback);
+/*!
+ * @brief Destroy a @ref TuiPixelReadback, unmapping its pixels if they are mapped.
+ *
+ * @param pixel_readback The @ref TuiPixelReadback.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+void tuiPixelReadbackDestroy(TuiPixelReadback pixel_readback);
+/*!
+ * @brief Start capturing the pixels of a @ref TuiPanel, replacing the last capture of a @ref TuiPixelReadback. This function does not wait for the GPU.
+ *
+ * @param pixel_readback The @ref TuiPixelReadback.
+ * @param panel The @ref TuiPanel to capture.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if the pixels of the last capture are mapped. Returns @ref TUI_RESULT_ERROR_GRAPHICS_BACKEND if the capture could not be started.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiPixelReadbackCapturePanel(TuiPixelReadback pixel_readback, TuiPanel panel);
+/*!
+ * @brief Start capturing the framebuffer pixels of a @ref TuiWindow, replacing the last capture of a @ref TuiPixelReadback. This function does not wait for the GPU.
+ *
+ * @param pixel_readback The @ref TuiPixelReadback.
+ * @param window The @ref TuiWindow to capture.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if the pixels of the last capture are mapped. Returns @ref TUI_RESULT_ERROR_GRAPHICS_BACKEND if the capture could not be started. Returns @ref TUI_RESULT_ERROR_UNSUPPORTED_OPERATION with @ref TUI_GRAPHICS_BACKEND_SOFTWARE, which has no windows.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiPixelReadbackCaptureWindow(TuiPixelReadback pixel_readback, TuiWindow window);
+/*!
+ * @brief Get if the GPU has finished the last capture of a @ref TuiPixelReadback, so its pixels can be mapped without waiting. This function does not wait for the GPU.
+ *
+ * @param pixel_readback The @ref TuiPixelReadback.
+ *
+ * @returns @ref TUI_TRUE if the last capture is finished. @ref TUI_FALSE if it is not finished or nothing was captured.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiBoolean tuiPixelReadbackIsReady(TuiPixelReadback pixel_readback);
+/*!
+ * @brief Map the pixels of the last capture of a @ref TuiPixelReadback, waiting for the GPU to finish the capture if it has not.
+ *
+ * @param pixel_readback The @ref TuiPixelReadback.
+ * @param pixels Pointer to where the pointer to the RGBA pixels is stored, in rows from top to bottom.
+ * @param pixel_width Pointer to where the width in pixels of the capture is stored. Can be @ref TUI_NULL.
+ * @param pixel_height Pointer to where the height in pixels of the capture is stored. Can be @ref TUI_NULL.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if nothing was captured or the pixels are already mapped. Returns @ref TUI_RESULT_ERROR_GRAPHICS_BACKEND if the pixels could not be mapped.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @pointer_lifetime The pixels are valid until @ref tuiPixelReadbackUnmapPixels or @ref tuiPixelReadbackDestroy is called.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiPixelReadbackMapPixels(TuiPixelReadback pixel_readback, const uint8_t** pixels, int* pixel_width, int* pixel_height);
+/*!
+ * @brief Unmap the pixels mapped by @ref tuiPixelReadbackMapPixels, so the @ref TuiPixelReadback can capture again. Nothing happens if the pixels are not mapped.
+ *
+ * @param pixel_readback The @ref TuiPixelReadback.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function must only be called when TUIC is initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+void tuiPixelReadbackUnmapPixels(TuiPixelReadback pixel_readback);
+/*! @} */
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,306 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file polygon.h
+ */
+#ifndef TUIC_POLYGON_H //header guard
+#define TUIC_POLYGON_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+#include <TUIC/result.h>
+
+
+/*! @name 2D Polygon Functions
+ *
+ * Functions for manipulating @ref TuiPolygon.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiPolygon. The vertex array is not copied, so it must stay alive for as long as the @ref TuiPolygon is used. Polygons with more than @ref TUI_POLYGON_MAX_POINT_COUNT vertices contain no tiles, use @ref tuiPolygonCreate to have them rejected.
+ *
+ * @param points The vertices of the polygon in order. The last vertex is connected back to the first.
+ * @param point_count The amount of vertices.
+ *
+ * @returns The created @ref TuiPolygon.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPolygon tuiPolygon(const TuiPoint2* const points, const int point_count);
+/*!
+ * @brief Create a @ref TuiPolygon, checking that it has vertices and no more than @ref TUI_POLYGON_MAX_POINT_COUNT of them. The vertex array is not copied, so it must stay alive for as long as the @ref TuiPolygon is used.
+ *
+ * @param polygon Pointer to where the created @ref TuiPolygon is stored.
+ * @param points The vertices of the polygon in order. The last vertex is connected back to the first.
+ * @param point_count The amount of vertices.
+ *
+ * @returns @ref TUI_RESULT_OK if the polygon was created.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if points is @ref TUI_NULL, or point_count is less than 1 or more than @ref TUI_POLYGON_MAX_POINT_COUNT.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiResult tuiPolygonCreate(TuiPolygon* const polygon, const TuiPoint2* const points, const int point_count);
+/*!
+ * @brief Get the left x coordinate of a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns The left x coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiPolygonGetLeftX(const TuiPolygon polygon);
+/*!
+ * @brief Get the right x coordinate of a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns The right x coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiPolygonGetRightX(const TuiPolygon polygon);
+/*!
+ * @brief Get the top y coordinate of a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns The top y coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiPolygonGetTopY(const TuiPolygon polygon);
+/*!
+ * @brief Get the bottom y coordinate of a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns The bottom y coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiPolygonGetBottomY(const TuiPolygon polygon);
+/*!
+ * @brief Get the width in tiles of a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns The width in tiles.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiPolygonGetTileWidth(const TuiPolygon polygon);
+/*!
+ * @brief Get the height in tiles of a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns The height in tiles.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiPolygonGetTileHeight(const TuiPolygon polygon);
+/*!
+ * @brief Get the bounding @ref TuiRect of a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns The bounding @ref TuiRect.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiRect tuiPolygonGetBoundingRect(const TuiPolygon polygon);
+/*!
+ * @brief Get if a @ref TuiPolygon is degenerate. A degenerate @ref TuiPolygon has less than 3 vertices or has all of its vertices on the same line.
+ *
+ * @param polygon The @ref TuiPolygon.
+ *
+ * @returns If the @ref TuiPolygon is degenerate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonIsDegenerate(const TuiPolygon polygon);
+/*!
+ * @brief Get if a @ref TuiPolygon contains a @ref TuiPoint2. Points on the border of the polygon are contained.
+ *
+ * @param polygon The @ref TuiPolygon.
+ * @param point2 The @ref TuiPoint2
+ *
+ * @returns if the @ref TuiPolygon contains the @ref TuiPoint2.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonContainsPoint2(const TuiPolygon polygon, const TuiPoint2 point2);
+/*!
+ * @brief Get if a @ref TuiPolygon contains every tile of a @ref TuiLine.
+ *
+ * @param polygon The @ref TuiPolygon.
+ * @param line The @ref TuiLine
+ *
+ * @returns if the @ref TuiPolygon contains the @ref TuiLine.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonContainsLine(const TuiPolygon polygon, const TuiLine line);
+/*!
+ * @brief Get if a @ref TuiPolygon contains a @ref TuiRect.
+ *
+ * @param polygon The @ref TuiPolygon.
+ * @param rect The @ref TuiRect
+ *
+ * @returns if the @ref TuiPolygon contains the @ref TuiRect.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonContainsRect(const TuiPolygon polygon, const TuiRect rect);
+/*!
+ * @brief Get if a @ref TuiPolygon intersects a @ref TuiLine.
+ *
+ * @param polygon The @ref TuiPolygon.
+ * @param line The @ref TuiLine
+ *
+ * @returns if the @ref TuiPolygon intersects the @ref TuiLine.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonIntersectsLine(const TuiPolygon polygon, const TuiLine line);
+/*!
+ * @brief Get if a @ref TuiPolygon intersects a @ref TuiRect.
+ *
+ * @param polygon The @ref TuiPolygon.
+ * @param rect The @ref TuiRect
+ *
+ * @returns if the @ref TuiPolygon intersects the @ref TuiRect.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonIntersectsRect(const TuiPolygon polygon, const TuiRect rect);
+/*!
+ * @brief Get if a @ref TuiPolygon intersects a @ref TuiCircle.
+ *
+ * @param polygon The @ref TuiPolygon.
+ * @param circle The @ref TuiCircle
+ *
+ * @returns if the @ref TuiPolygon intersects the @ref TuiCircle.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonIntersectsCircle(const TuiPolygon polygon, const TuiCircle circle);
+/*!
+ * @brief Get if a @ref TuiPolygon intersects a @ref TuiEllipse.
+ *
+ * @param polygon The @ref TuiPolygon.
+ * @param ellipse The @ref TuiEllipse
+ *
+ * @returns if the @ref TuiPolygon intersects the @ref TuiEllipse.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonIntersectsEllipse(const TuiPolygon polygon, const TuiEllipse ellipse);
+/*!
+ * @brief Get if a @ref TuiPolygon intersects a @ref TuiPolygon.
+ *
+ * @param polygon_1 The first @ref TuiPolygon.
+ * @param polygon_2 The second @ref TuiPolygon.
+ *
+ * @returns if the @ref TuiPolygon intersects the @ref TuiPolygon.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiPolygonIntersectsPolygon(const TuiPolygon polygon_1, const TuiPolygon polygon_2);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
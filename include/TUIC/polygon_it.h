@@ -0,0 +1,177 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file polygon_it.h
+ */
+#ifndef TUIC_POLYGON_IT_H //header guard
+#define TUIC_POLYGON_IT_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+
+/*! @name Polygon Iterator Functions
+ *
+ * Functions for manipulating @ref TuiPolygonIt.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiPolygonIt to iterate over the points within a @ref TuiPolygon.
+ *
+ * @param polygon The @ref TuiPolygon to iterate.
+ *
+ * @returns The created @ref TuiPolygonIt.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiPolygonIt tuiPolygonIt(const TuiPolygon polygon);
+/*!
+ * @brief Get if a @ref TuiPolygonIt position is out of its @ref TuiPolygon.
+ *
+ * @param it The @ref TuiPolygonIt to check.
+ *
+ * @returns If the iterator's position is out of the polygon.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiPolygonItDone(const TuiPolygonIt it);
+/*!
+ * @brief Step a @ref TuiPolygonIt forward.
+ *
+ * @param it The @ref TuiPolygonIt to step.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+void tuiPolygonItStepForward(TuiPolygonIt* const it);
+/*!
+ * @brief Step a @ref TuiPolygonIt forward to the first point of the next @ref TuiSpan, skipping the rest of the current @ref TuiSpan.
+ *
+ * @param it The @ref TuiPolygonIt to step.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+void tuiPolygonItStepSpan(TuiPolygonIt* const it);
+/*!
+ * @brief Set the position of a @ref TuiPolygonIt to its start position.
+ *
+ * @param it The @ref TuiPolygonIt to set the position to start.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+void tuiPolygonItSetStart(TuiPolygonIt* const it);
+/*!
+ * @brief Get the @ref TuiPolygon being iterated over by a @ref TuiPolygonIt.
+ *
+ * @param it The @ref TuiPolygonIt to get the polygon from.
+ *
+ * @returns The @ref TuiPolygon the iterator is iterating over.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPolygon tuiPolygonItGetPolygon(const TuiPolygonIt it);
+/*!
+ * @brief Get the @ref TuiPoint2 at the current position of a @ref TuiPolygonIt.
+ *
+ * @param it The @ref TuiPolygonIt to get the point from.
+ *
+ * @returns The @ref TuiPoint2 at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiPoint2 tuiPolygonItGetPoint2(const TuiPolygonIt it);
+/*!
+ * @brief Get the @ref TuiSpan from the current position of a @ref TuiPolygonIt to the end of its current row span.
+ *
+ * @param it The @ref TuiPolygonIt to get the span from.
+ *
+ * @returns The @ref TuiSpan at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiSpan tuiPolygonItGetSpan(const TuiPolygonIt it);
+/*! @} */
+
+
+/*! @name Polygon Iterator Macro Functions
+ *
+ * Macros for easily writing @ref TuiPolygonIt loops.
+ *  @{ */
+/*!
+ * @brief Macro function for easily constructing a polygon iterator for loop without body.
+ *
+ * @param polygon The @ref TuiPolygon to iterate over. Can pass in a function that returns a @ref TuiPolygon.
+ * @param iterator The name of the variable that will store the @ref TuiPolygonIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+#define TUI_POLYGON_ITERATE(polygon, iterator) for(TuiPolygonIt iterator = tuiPolygonIt(polygon); !tuiPolygonItDone(iterator); tuiPolygonItStepForward(&iterator))
+/*!
+ * @brief Macro function for easily constructing a polygon iterator for loop over each @ref TuiSpan without body. Use @ref tuiPolygonItGetSpan to get the span in the loop body.
+ *
+ * @param polygon The @ref TuiPolygon to iterate over. Can pass in a function that returns a @ref TuiPolygon.
+ * @param iterator The name of the variable that will store the @ref TuiPolygonIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array of the @ref TuiPolygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+#define TUI_POLYGON_ITERATE_SPANS(polygon, iterator) for(TuiPolygonIt iterator = tuiPolygonIt(polygon); !tuiPolygonItDone(iterator); tuiPolygonItStepSpan(&iterator))
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
@@ -85,6 +85,18 @@ void tuiRectItStepForward(TuiRectIt* const it);
  * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
  */
 void tuiRectItStepBackward(TuiRectIt* const it);
+/*!
+ * @brief Step a @ref TuiRectIt to the start of the next @ref TuiSpan, skipping the rest of the current one.
+ *
+ * @param it The @ref TuiRectIt to step.
+ *
+ * @errors This function can have the error @ref TUI_ERROR_NULL_GRID_SHAPE_ITERATOR and immediatly return.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+void tuiRectItStepSpan(TuiRectIt* const it);
 /*!
  * @brief Set the position of a @ref TuiRectIt to its start position.
  *
@@ -125,6 +137,20 @@ TuiRect tuiRectItGetRect(const TuiRectIt it);
  * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
  */
 TuiPoint2 tuiRectItGetPoint2(const TuiRectIt it);
+/*!
+ * @brief Get the @ref TuiSpan from the current position of a @ref TuiRectIt to the right end of its row.
+ *
+ * @param it The @ref TuiRectIt to get the span from.
+ *
+ * @returns The @ref TuiSpan at the iterator's current position.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiSpan tuiRectItGetSpan(const TuiRectIt it);
 /*! @} */
 
 
@@ -143,6 +169,17 @@ TuiPoint2 tuiRectItGetPoint2(const TuiRectIt it);
  * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
  */
 #define TUI_RECT_ITERATE(rect, iterator) for(TuiRectIt iterator = tuiRectIt(rect); !tuiRectDone(iterator); tuiRectItStepForward(&iterator))
+/*!
+ * @brief Macro function for easily constructing a rect iterator for loop over each @ref TuiSpan without body. Use @ref tuiRectItGetSpan to get the span in the loop body.
+ *
+ * @param rect The @ref TuiRect to iterate over. Can pass in a function that returns a @ref TuiRect.
+ * @param iterator The name of the variable that will store the @ref TuiRectIt.
+ *
+ * @requirements This macro function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+#define TUI_RECT_ITERATE_SPANS(rect, iterator) for(TuiRectIt iterator = tuiRectIt(rect); !tuiRectDone(iterator); tuiRectItStepSpan(&iterator))
 /*! @} */
 
 
@@ -0,0 +1,211 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file shape.h
+ */
+#ifndef TUIC_SHAPE_H //header guard
+#define TUIC_SHAPE_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/grid_shape_types.h>
+#include <TUIC/boolean.h>
+
+
+/*! @name Shape Functions
+ *
+ * Functions for manipulating @ref TuiShape.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiRect.
+ *
+ * @param rect The @ref TuiRect to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeRect(const TuiRect rect);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiBox.
+ *
+ * @param box The @ref TuiBox to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeBox(const TuiBox box);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiCropBox.
+ *
+ * @param crop_box The @ref TuiCropBox to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeCropBox(const TuiCropBox crop_box);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiCircle.
+ *
+ * @param circle The @ref TuiCircle to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeCircle(const TuiCircle circle);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiCropCircle.
+ *
+ * @param crop_circle The @ref TuiCropCircle to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeCropCircle(const TuiCropCircle crop_circle);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiRing.
+ *
+ * @param ring The @ref TuiRing to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeRing(const TuiRing ring);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiCropRing.
+ *
+ * @param crop_ring The @ref TuiCropRing to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeCropRing(const TuiCropRing crop_ring);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiPolygon. The vertex array of the polygon is not copied, so it must stay alive for as long as the @ref TuiShape is used.
+ *
+ * @param polygon The @ref TuiPolygon to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapePolygon(const TuiPolygon polygon);
+/*!
+ * @brief Create a @ref TuiShape that stores a @ref TuiEllipse.
+ *
+ * @param ellipse The @ref TuiEllipse to store.
+ *
+ * @returns The created @ref TuiShape.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShape tuiShapeEllipse(const TuiEllipse ellipse);
+/*!
+ * @brief Get the top y coordinate of the rows a @ref TuiShape can cover.
+ *
+ * @param shape The @ref TuiShape.
+ *
+ * @returns The top y coordinate.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array if the @ref TuiShape is a polygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiShapeGetTopY(const TuiShape shape);
+/*!
+ * @brief Get the bottom y coordinate of the rows a @ref TuiShape can cover.
+ *
+ * @param shape The @ref TuiShape.
+ *
+ * @returns The bottom y coordinate. It is less than the top y coordinate if the shape type is @ref TUI_SHAPE_TYPE_INVALID.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array if the @ref TuiShape is a polygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+int tuiShapeGetBottomY(const TuiShape shape);
+/*!
+ * @brief Get if a @ref TuiShape contains a tile. A tile is contained if it would be visited by iterating the shape on its own.
+ *
+ * @param shape The @ref TuiShape.
+ * @param point2 The @ref TuiPoint2 of the tile.
+ *
+ * @returns If the @ref TuiShape contains the tile.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the vertex array if the @ref TuiShape is a polygon, so it is thread safe as long as the vertex array is not modified at the same time.
+ */
+TuiBoolean tuiShapeContainsPoint2(const TuiShape shape, const TuiPoint2 point2);
+/*! @} */
+
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
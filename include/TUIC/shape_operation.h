@@ -0,0 +1,144 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file shape_operation.h
+ */
+#ifndef TUIC_SHAPE_OPERATION_H // header guard
+#define TUIC_SHAPE_OPERATION_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/boolean.h>
+
+
+/*!
+ * @brief Boolean operations used to combine the tiles of two grid shapes in a @ref TuiCompositeShape.
+ */
+typedef enum TuiShapeOperation
+{
+	/*!
+	 * \brief The shape operation is invalid.
+	 *
+	 * This shape operation is returned when an error occurs, and is also used to specify that no shape operation is
+	 * defined.
+	 */
+	TUI_SHAPE_OPERATION_INVALID = 0,
+	/*!
+	 * \brief Tiles in either of the shapes.
+	 */
+	TUI_SHAPE_OPERATION_UNION = 1,
+	/*!
+	 * \brief Tiles in both of the shapes.
+	 */
+	TUI_SHAPE_OPERATION_INTERSECTION = 2,
+	/*!
+	 * \brief Tiles in the first shape that are not in the second shape.
+	 */
+	TUI_SHAPE_OPERATION_DIFFERENCE = 3,
+	/*!
+	 * \brief Tiles in exactly one of the shapes.
+	 */
+	TUI_SHAPE_OPERATION_XOR = 4,
+	/*!
+	 * \brief The first valid shape operation value.
+	 */
+	TUI_SHAPE_OPERATION_FIRST = TUI_SHAPE_OPERATION_UNION,
+	/*!
+	 * \brief The last valid shape operation value.
+	 */
+	TUI_SHAPE_OPERATION_LAST = TUI_SHAPE_OPERATION_XOR
+} TuiShapeOperation;
+
+/*! @name Shape Operation Names
+ *
+ * Constant string names of each shape operation.
+ *  @{ */
+/*!
+ * @brief String name of @ref TUI_SHAPE_OPERATION_UNION.
+ */
+extern const char* kTui_Shape_Operation_Union_Name;
+/*!
+ * @brief String name of @ref TUI_SHAPE_OPERATION_INTERSECTION.
+ */
+extern const char* kTui_Shape_Operation_Intersection_Name;
+/*!
+ * @brief String name of @ref TUI_SHAPE_OPERATION_DIFFERENCE.
+ */
+extern const char* kTui_Shape_Operation_Difference_Name;
+/*!
+ * @brief String name of @ref TUI_SHAPE_OPERATION_XOR.
+ */
+extern const char* kTui_Shape_Operation_Xor_Name;
+/*! @} */
+
+
+/*! @name Shape Operation Functions
+ *
+ * Functions for dealing with @ref TuiShapeOperation enum values.
+ *  @{ */
+/*!
+ * @brief Determine if a @ref TuiShapeOperation enum is valid.
+ *
+ * @param shape_operation The @ref TuiShapeOperation to check.
+ *
+ * @returns The @ref TuiBoolean result. If shape_operation is a valid @ref TuiShapeOperation, it
+ * returns @ref TUI_TRUE. Otherwise, it returns @ref TUI_FALSE.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiBoolean tuiShapeOperationIsValid(TuiShapeOperation shape_operation);
+/*!
+ * @brief Retrieve the string name associated with a @ref TuiShapeOperation enum.
+ *
+ * @param shape_operation The @ref TuiShapeOperation to get the name of.
+ *
+ * @returns The string name. @ref TUI_NULL is returned if shape_operation is an invalid @ref TuiShapeOperation.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+const char* tuiShapeOperationToString(TuiShapeOperation shape_operation);
+/*!
+ * @brief Determine the @ref TuiShapeOperation enum value associated with a string name.
+ *
+ * @param str The string name.
+ *
+ * @returns The @ref TuiShapeOperation. @ref TUI_SHAPE_OPERATION_INVALID is returned if no match is found.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access memory in ways that could cause a data race, so it is thread safe.
+ */
+TuiShapeOperation tuiStringToShapeOperation(const char* str);
+/*! @} */
+
+
+#ifdef __cplusplus // extern C guard
+}
+#endif
+#endif // header guard
\ No newline at end of file
@@ -25,6 +25,10 @@
 extern "C" {
 #endif
 #include <TUIC/boolean.h>
+#include <TUIC/graphics_backend.h>
+#include <TUIC/graphics_validation.h>
+#include <TUIC/result.h>
+#include <stddef.h>
 
 
 /*! @name TUIC System Functions
@@ -37,6 +41,8 @@ extern "C" {
  * @returns The @ref TuiBoolean result. If the library initialized successfully, it
  * returns @ref TUI_TRUE. Otherwise, it returns @ref TUI_FALSE.
  * 
+ * With @ref TUI_GRAPHICS_BACKEND_SOFTWARE set by @ref tuiSetGraphicsBackend, GLFW is not initialized and no graphics context is created. With @ref tuiSetHeadless, GLFW is initialized without a window system and the graphics context is offscreen.
+ *
  * @errors Possible errors in order are @ref TUI_ERROR_ALREADY_INITIALIZED and GLFW errors. The first error that occurs will cause the function to immediatly return @ref TUI_FALSE.
  * 
  * @requirements This function must only be called when TUIC is not initialized.
@@ -125,6 +131,119 @@ const char* tuiGetClipboardString();
  * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
  */
 void tuiSetClipboardString(const char* string);
+/*!
+ * @brief Get how many context switches and graphics state changes were made, and how many were skipped because the state was already set. Both are 0 with @ref TUI_GRAPHICS_BACKEND_SOFTWARE, which makes no graphics calls.
+ *
+ * @param issued_call_count Pointer to where the amount of calls made is stored. Can be @ref TUI_NULL.
+ * @param skipped_call_count Pointer to where the amount of calls skipped is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+void tuiGetGraphicsStateStatistics(size_t* issued_call_count, size_t* skipped_call_count);
+/*!
+ * @brief Reset the counts returned by @ref tuiGetGraphicsStateStatistics to 0.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+void tuiResetGraphicsStateStatistics();
+/*!
+ * @brief Set how much the graphics backend checks its calls. Debug builds default to @ref TUI_GRAPHICS_VALIDATION_FULL, and builds with NDEBUG defined default to @ref TUI_GRAPHICS_VALIDATION_OFF.
+ *
+ * If it is set to anything but @ref TUI_GRAPHICS_VALIDATION_OFF before TUIC is initialized, a debug graphics context is requested so the driver reports as much as it can. Labels set on panels, atlases and consoles name them in driver messages and graphics captures.
+ *
+ * @param validation The @ref TuiGraphicsValidation level.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_ERROR_INVALID_ENUM is returned if validation is not a valid level. @ref TUI_RESULT_ERROR_UNSUPPORTED_OPERATION is returned if TUIC is initialized, validation is @ref TUI_GRAPHICS_VALIDATION_DEBUG_CALLBACK and the driver does not support KHR_debug, or if TUIC is initialized with @ref TUI_GRAPHICS_BACKEND_SOFTWARE; the level is then left unchanged.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiResult tuiSetGraphicsValidation(TuiGraphicsValidation validation);
+/*!
+ * @brief Get the level set by @ref tuiSetGraphicsValidation.
+ *
+ * @returns The @ref TuiGraphicsValidation level.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiGraphicsValidation tuiGetGraphicsValidation();
+/*!
+ * @brief Set the function called with the messages of the graphics driver while validation is not @ref TUI_GRAPHICS_VALIDATION_OFF. Driver notifications are filtered out.
+ *
+ * @param callback The @ref tuiGraphicsDebugMessageFunction, or @ref TUI_NULL to drop the messages.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety The callback is called on the thread on which TUIC was initialized, from within graphics calls of other TUIC functions. With @ref TUI_GRAPHICS_VALIDATION_DEBUG_CALLBACK some drivers call it later than the graphics call that caused the message, or from a driver thread.
+ */
+void tuiSetGraphicsDebugMessageCallback(tuiGraphicsDebugMessageFunction callback);
+/*!
+ * @brief Set the backend TUIC renders with from the next time it is initialized. The default is @ref TUI_GRAPHICS_BACKEND_OPENGL33.
+ *
+ * @param backend The @ref TuiGraphicsBackend.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_ERROR_INVALID_ENUM is returned if backend is not a valid backend. @ref TUI_RESULT_ERROR_UNSUPPORTED_OPERATION is returned if TUIC is initialized, since objects of one backend can not be used with another; the backend is then left unchanged.
+ *
+ * @requirements This function must only be called when TUIC is not initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC will be initialized to ensure safe memory access.
+ */
+TuiResult tuiSetGraphicsBackend(TuiGraphicsBackend backend);
+/*!
+ * @brief Get the backend set by @ref tuiSetGraphicsBackend.
+ *
+ * @returns The @ref TuiGraphicsBackend.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiGraphicsBackend tuiGetGraphicsBackend();
+/*!
+ * @brief Set if TUIC is initialized headless the next time, with an offscreen graphics context and no connection to a window system. It is off by default.
+ *
+ * Headless TUIC starts without an X11 or Wayland server, such as in a container, and can still draw panels and read their pixels back. The graphics context is created with EGL, which Mesa provides surfaceless with its llvmpipe CPU driver, or with OSMesa if EGL is not available. Windows can not be created while headless, and @ref tuiWindowCreate fails with @ref TUI_ERROR_GLFW_PLATFORM_ERROR. Other functions work as usual.
+ *
+ * @param headless @ref TUI_TRUE to initialize headless, or @ref TUI_FALSE to use the window system.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_ERROR_UNSUPPORTED_OPERATION is returned if TUIC is initialized, or if headless is @ref TUI_TRUE and TUIC was built against a GLFW older than 3.4, which has no null platform; the setting is then left unchanged.
+ *
+ * @requirements This function must only be called when TUIC is not initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC will be initialized to ensure safe memory access.
+ */
+TuiResult tuiSetHeadless(TuiBoolean headless);
+/*!
+ * @brief Get the setting of @ref tuiSetHeadless.
+ *
+ * The setting is returned as it was requested, whether or not TUIC is initialized and whether or not a headless initialization succeeded. It has no effect while the graphics backend is @ref TUI_GRAPHICS_BACKEND_SOFTWARE, which never uses a window system.
+ *
+ * @returns @ref TUI_TRUE if headless is set, or @ref TUI_FALSE otherwise.
+ *
+ * @errors This function can have no errors.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function must only be called on the same thread on which TUIC was initialized to ensure safe memory access.
+ */
+TuiBoolean tuiIsHeadless();
 /*! @} */
 
 
@@ -0,0 +1,111 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file text_run_cache.h
+ */
+#ifndef TUIC_TEXT_RUN_CACHE_H //header guard
+#define TUIC_TEXT_RUN_CACHE_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*! @name Text Run Cache Functions
+ *
+ * Functions for caching the measured widths of runs of proportional glyphs, so labels that do not change are not measured glyph by glyph every frame.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiTextRunCache. Each run is stored in the entry picked by a 64 bit hash of its glyphs, and replaces whatever run was there before.
+ *
+ * @param text_run_cache Pointer to where the created @ref TuiTextRunCache is stored.
+ * @param capacity The least amount of runs the cache can hold. It is rounded up to a power of 2.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if capacity is less than 1 or more than 16777216. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+TuiResult tuiTextRunCacheCreate(TuiTextRunCache* text_run_cache, int capacity);
+/*!
+ * @brief Destroy a @ref TuiTextRunCache and free its memory.
+ *
+ * @param text_run_cache The @ref TuiTextRunCache.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiTextRunCache passed to it, so it is thread safe as long as that @ref TuiTextRunCache is not used by another thread at the same time.
+ */
+void tuiTextRunCacheDestroy(TuiTextRunCache text_run_cache);
+/*!
+ * @brief Get the width in pixels of a run of glyphs of a @ref TuiAtlas, as @ref tuiAtlasMeasureGlyphs would measure it, from the cache if the run was measured since the metrics or kerning of the atlas last changed.
+ *
+ * @param text_run_cache The @ref TuiTextRunCache.
+ * @param atlas The @ref TuiAtlas whose glyph metrics and kerning are used.
+ * @param glyphs Array of glyph_count glyphs.
+ * @param glyph_count The amount of glyphs.
+ *
+ * @returns The width in pixels of the run.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, but the @ref TuiAtlas must be valid. Call @ref tuiTextRunCacheClear after destroying an atlas the cache has measured, so a new atlas at the same address can not match its runs.
+ *
+ * @thread_safety This function only accesses the @ref TuiTextRunCache passed to it and reads the @ref TuiAtlas, so it is thread safe as long as that @ref TuiTextRunCache is not used and that @ref TuiAtlas is not modified by another thread at the same time.
+ */
+int tuiTextRunCacheMeasure(TuiTextRunCache text_run_cache, TuiAtlas atlas, const uint16_t* glyphs, int glyph_count);
+/*!
+ * @brief Remove every run from a @ref TuiTextRunCache and reset its statistics.
+ *
+ * @param text_run_cache The @ref TuiTextRunCache.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiTextRunCache passed to it, so it is thread safe as long as that @ref TuiTextRunCache is not used by another thread at the same time.
+ */
+void tuiTextRunCacheClear(TuiTextRunCache text_run_cache);
+/*!
+ * @brief Get how many measurements of a @ref TuiTextRunCache were found in the cache and how many had to be measured.
+ *
+ * @param text_run_cache The @ref TuiTextRunCache.
+ * @param hit_count Pointer to where the amount of measurements found in the cache is stored. Can be @ref TUI_NULL.
+ * @param miss_count Pointer to where the amount of measurements that were measured is stored. Can be @ref TUI_NULL.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiTextRunCache passed to it, so it is thread safe as long as that @ref TuiTextRunCache is not modified by another thread at the same time.
+ */
+void tuiTextRunCacheGetStatistics(TuiTextRunCache text_run_cache, size_t* hit_count, size_t* miss_count);
+/*! @} */
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
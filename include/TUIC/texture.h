@@ -37,6 +37,8 @@ TuiResult tuiTextureCreate(TuiTexture* texture, uint8_t* pixel_data, int pixel_w
 
 void tuiTextureDestroy(TuiTexture texture);
 
+TuiResult tuiTextureUpdateRegion(TuiTexture texture, const uint8_t* pixels, int x, int y, int width, int height, size_t row_pitch);
+
 void tuiTextureGetPixelDimensions(TuiTexture texture, int* pixel_width, int* pixel_height);
 
 size_t tuiGetTextureCount();
@@ -0,0 +1,123 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file true_type_font.h
+ */
+#ifndef TUIC_TRUE_TYPE_FONT_H //header guard
+#define TUIC_TRUE_TYPE_FONT_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+#include <TUIC/result.h>
+#include <TUIC/boolean.h>
+
+/*! @name TrueType Font Functions
+ *
+ * Functions for rasterizing the glyphs of a TrueType font on demand, so a @ref TuiGlyphCache can be filled from it.
+ *  @{ */
+/*!
+ * @brief Create a @ref TuiTrueTypeFont from the contents of a TrueType font file.
+ *
+ * @param font Pointer to where the created @ref TuiTrueTypeFont is stored.
+ * @param font_data The contents of the font file. It is not copied, so it must stay valid until the @ref TuiTrueTypeFont is destroyed.
+ * @param pixel_height The height in pixels from the highest ascender to the lowest descender of rasterized glyphs.
+ *
+ * @returns The @ref TuiResult. @ref TUI_RESULT_OK is returned if no error occured.
+ *
+ * @errors Returns @ref TUI_RESULT_ERROR_INVALID_VALUE if font_data is @ref TUI_NULL, is not a TrueType font, or pixel_height is not above 0. Returns @ref TUI_RESULT_ERROR_OUT_OF_MEMORY if memory could not be allocated.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function does not access shared state, so it is thread safe.
+ */
+TuiResult tuiTrueTypeFontCreate(TuiTrueTypeFont* font, const uint8_t* font_data, float pixel_height);
+/*!
+ * @brief Destroy a @ref TuiTrueTypeFont and free its memory.
+ *
+ * @param font The @ref TuiTrueTypeFont.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiTrueTypeFont passed to it, so it is thread safe as long as that @ref TuiTrueTypeFont is not used by another thread at the same time.
+ */
+void tuiTrueTypeFontDestroy(TuiTrueTypeFont font);
+/*!
+ * @brief Rasterize a glyph of a @ref TuiTrueTypeFont as coverage, drawn as white with the coverage as alpha when there are more channels. It is a @ref tuiGlyphRasterizeFunction, so it can be given to @ref tuiGlyphCacheCreate with the font as user data.
+ *
+ * @param font The @ref TuiTrueTypeFont.
+ * @param codepoint The Unicode codepoint to rasterize.
+ * @param max_width The width in pixels of pixels.
+ * @param max_height The height in pixels of pixels.
+ * @param channel_count The amount of 8 bit channels of each pixel, from 1 to 4.
+ * @param pixels Array of max_width * max_height pixels with channel_count channels to draw into. Every channel must start at 0.
+ * @param width Pointer to where the advance width of the glyph is stored, at most max_width.
+ * @param height Pointer to where the height of the glyph is stored, which is always max_height.
+ *
+ * @returns If the font has a glyph for the codepoint.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiTrueTypeFont passed to it, so it is thread safe as long as that @ref TuiTrueTypeFont is not modified by another thread at the same time.
+ */
+TuiBoolean tuiTrueTypeFontRasterizeGlyph(void* font, uint32_t codepoint, int max_width, int max_height, int channel_count, uint8_t* pixels, int* width, int* height);
+/*!
+ * @brief Rasterize a glyph of a @ref TuiTrueTypeFont as a signed distance field computed from its outline, so a distance field @ref TuiAtlas can draw it at any scale. The edge is 128, and values reach 255 inside and 0 outside at the distance field spread of the font from the edge. It is a @ref tuiGlyphRasterizeFunction, so it can be given to @ref tuiGlyphCacheCreate with the font as user data.
+ *
+ * @param font The @ref TuiTrueTypeFont.
+ * @param codepoint The Unicode codepoint to rasterize.
+ * @param max_width The width in pixels of pixels.
+ * @param max_height The height in pixels of pixels.
+ * @param channel_count The amount of 8 bit channels of each pixel, from 1 to 4. The distance is written where @ref tuiTrueTypeFontRasterizeGlyph writes coverage.
+ * @param pixels Array of max_width * max_height pixels with channel_count channels to draw into. Every channel must start at 0.
+ * @param width Pointer to where the advance width of the glyph is stored, at most max_width.
+ * @param height Pointer to where the height of the glyph is stored, which is always max_height.
+ *
+ * @returns If the font has a glyph for the codepoint.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only reads the @ref TuiTrueTypeFont passed to it, so it is thread safe as long as that @ref TuiTrueTypeFont is not modified by another thread at the same time.
+ */
+TuiBoolean tuiTrueTypeFontRasterizeGlyphDistanceField(void* font, uint32_t codepoint, int max_width, int max_height, int channel_count, uint8_t* pixels, int* width, int* height);
+/*!
+ * @brief Set the distance in pixels from the glyph edge at which the distance fields of @ref tuiTrueTypeFontRasterizeGlyphDistanceField stop changing. It is 4 when the font is created. A larger spread allows more downscaling and effects like outlines, at the cost of edge precision.
+ *
+ * @param font The @ref TuiTrueTypeFont.
+ * @param spread The spread in pixels. It must be above 0.
+ *
+ * @errors This function can have no error codes.
+ *
+ * @requirements This function can be called freely, even if TUIC is not currently initialized.
+ *
+ * @thread_safety This function only accesses the @ref TuiTrueTypeFont passed to it, so it is thread safe as long as that @ref TuiTrueTypeFont is not used by another thread at the same time.
+ */
+void tuiTrueTypeFontSetDistanceFieldSpread(TuiTrueTypeFont font, float spread);
+/*! @} */
+
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
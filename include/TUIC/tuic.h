@@ -22,13 +22,18 @@
  */
 
 #include <TUIC/atlas.h>
+#include <TUIC/atlas_builder.h>
+#include <TUIC/atlas_cache.h>
 #include <TUIC/atlas_type.h>
+#include <TUIC/bitmap_font.h>
 #include <TUIC/boolean.h>
 #include <TUIC/box.h>
 #include <TUIC/box_part.h>
 #include <TUIC/button_state.h>
 #include <TUIC/circle.h>
 #include <TUIC/circle_it.h>
+#include <TUIC/composite_shape.h>
+#include <TUIC/composite_shape_it.h>
 #include <TUIC/console.h>
 #include <TUIC/crop_box.h>
 #include <TUIC/crop_box_it.h>
@@ -40,9 +45,22 @@
 #include <TUIC/cursor_shape.h>
 #include <TUIC/debug.h>
 #include <TUIC/desktop_callback.h>
+#include <TUIC/distance_field.h>
+#include <TUIC/distance_transform.h>
+#include <TUIC/draw_list.h>
+#include <TUIC/ellipse.h>
+#include <TUIC/ellipse_it.h>
+#include <TUIC/embedded_atlas.h>
 #include <TUIC/error_code.h>
 #include <TUIC/events.h>
+#include <TUIC/field_of_view.h>
 #include <TUIC/filter_mode.h>
+#include <TUIC/frame_stats.h>
+#include <TUIC/glyph_cache.h>
+#include <TUIC/glyph_metrics.h>
+#include <TUIC/graphics_backend.h>
+#include <TUIC/graphics_validation.h>
+#include <TUIC/grid_mask.h>
 #include <TUIC/grid_shape_types.h>
 #include <TUIC/heap.h>
 #include <TUIC/image.h>
@@ -54,12 +72,20 @@
 #include <TUIC/mouse_button.h>
 #include <TUIC/palette.h>
 #include <TUIC/panel.h>
+#include <TUIC/pathfinder.h>
+#include <TUIC/pixel_readback.h>
 #include <TUIC/point2.h>
+#include <TUIC/polygon.h>
+#include <TUIC/polygon_it.h>
 #include <TUIC/rect.h>
 #include <TUIC/rect_it.h>
 #include <TUIC/ring.h>
+#include <TUIC/shape.h>
+#include <TUIC/shape_operation.h>
 #include <TUIC/system.h>
+#include <TUIC/text_run_cache.h>
 #include <TUIC/texture.h>
 #include <TUIC/time.h>
+#include <TUIC/true_type_font.h>
 #include <TUIC/types.h>
 #include <TUIC/window.h>
\ No newline at end of file
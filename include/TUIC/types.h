@@ -52,6 +52,30 @@ typedef struct TuiPalette_s* TuiPalette;
  * \brief A GPU texture atlas.
  */
 typedef struct TuiAtlas_s* TuiAtlas;
+/*!
+ * \brief A CPU set of glyph images that are packed into the pages of a @ref TuiAtlas.
+ */
+typedef struct TuiAtlasBuilder_s* TuiAtlasBuilder;
+/*!
+ * \brief A memory mapped file of baked atlas pages and glyph coordinates that a @ref TuiAtlas can be created from without decoding images.
+ */
+typedef struct TuiAtlasCache_s* TuiAtlasCache;
+/*!
+ * \brief A CPU cache that rasterizes glyphs on demand into the fixed size cells of the pages of a @ref TuiAtlas.
+ */
+typedef struct TuiGlyphCache_s* TuiGlyphCache;
+/*!
+ * \brief A cache of the measured widths of runs of proportional glyphs of a @ref TuiAtlas.
+ */
+typedef struct TuiTextRunCache_s* TuiTextRunCache;
+/*!
+ * \brief A PSF or BDF bitmap font of fixed size 1 bit glyphs and the codepoints they map to.
+ */
+typedef struct TuiBitmapFont_s* TuiBitmapFont;
+/*!
+ * \brief A TrueType font that glyphs can be rasterized from.
+ */
+typedef struct TuiTrueTypeFont_s* TuiTrueTypeFont;
 /*!
  * \brief A GPU texture.
  */
@@ -62,10 +86,26 @@ typedef struct TuiConsole_s* TuiConsole;
  * \brief A GPU framebuffer.
  */
 typedef struct TuiPanel_s* TuiPanel;
+/*!
+ * \brief A CPU list of recorded draws to panels that are submitted together, grouped by the panel they draw to.
+ */
+typedef struct TuiDrawList_s* TuiDrawList;
+/*!
+ * \brief A GPU copy of the pixels of a panel or window that is read back without waiting for the GPU.
+ */
+typedef struct TuiPixelReadback_s* TuiPixelReadback;
 /*!
  * \brief A CPU image.
  */
 typedef struct TuiImage_s* TuiImage;
+/*!
+ * \brief A CPU grid of tiles that are each either set or unset.
+ */
+typedef struct TuiGridMask_s* TuiGridMask;
+/*!
+ * \brief Reusable scratch memory for finding paths on a grid of tiles.
+ */
+typedef struct TuiPathfinder_s* TuiPathfinder;
 /*!
  * \brief A desktop mouse cursor.
  */
@@ -0,0 +1,23 @@
+#version 330 core
+
+uniform sampler2DArray Atlas;
+uniform bool MultiChannel; //median of red, green and blue for multi-channel distance fields, or alpha for single channel distance fields
+in vec3 UV;
+in vec4 FG;
+in vec4 BG;
+out vec4 FragColor;
+
+float median(float r, float g, float b)
+{
+    return max(min(r, g), min(max(r, g), b));
+}
+void main()
+{
+    vec4 c = texture(Atlas, UV);
+    float distance = MultiChannel ? median(c.r, c.g, c.b) : c.a;
+    vec3 color = MultiChannel ? vec3(1.0) : c.rgb;
+    //the edge is at 0.5 and is smoothed over about one screen pixel, whatever the scale the tile is drawn at
+    float edge_width = max(fwidth(distance) * 0.5, 0.0001);
+    float coverage = smoothstep(0.5 - edge_width, 0.5 + edge_width, distance);
+    FragColor = mix(BG, FG * vec4(color, 1.0), coverage);
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+//compiled after opengl33_batch_vertex_common.glsl, which holds the version, the shared inputs and outputs and the tile decoding
+uniform usamplerBuffer DrawIndices; //index of the console draw of every tile
+uniform samplerBuffer DrawTransforms; //two texels per console draw: the scale and offset from console pixels to clip space, then the left, right, bottom and top clip space edges of its rectangle
+out float gl_ClipDistance[4];
+void main()
+{
+    int tile = gl_VertexID / 6;
+    int tile_vertex = gl_VertexID % 6;
+    int buffer_offset = 18 * tile;
+    int draw = int(texelFetch(DrawIndices, tile).r);
+    vec4 transform = texelFetch(DrawTransforms, draw * 2);
+    vec4 edges = texelFetch(DrawTransforms, draw * 2 + 1);
+    vec2 position = getVertexPixelPosition(tile_vertex, buffer_offset) * transform.xy + transform.zw;
+    gl_Position = vec4(position, 0.0, 1.0);
+    //the viewport covers the whole panel, so each console is clipped to its own rectangle here instead
+    gl_ClipDistance[0] = position.x - edges.x;
+    gl_ClipDistance[1] = edges.y - position.x;
+    gl_ClipDistance[2] = position.y - edges.z;
+    gl_ClipDistance[3] = edges.w - position.y;
+    int glyph = getGlyph16(buffer_offset);
+    UV = getVertexUV(glyph, tile_vertex);
+    FG = getColor32(buffer_offset);
+    BG = getColor32(buffer_offset);
+}
\ No newline at end of file
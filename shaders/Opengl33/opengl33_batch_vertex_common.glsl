@@ -0,0 +1,83 @@
+#version 330 core
+
+uniform usamplerBuffer Data; //packed tile data of the batch
+uniform usamplerBuffer Coordinates; //one packed texel of glyph pixel coordinates per glyph
+uniform sampler2DArray Atlas;
+uniform ivec2 AtlasGrid; //columns and rows of cells per page for grid atlases, or 0 for atlases with a coordinates buffer
+out vec3 UV; //uv texture position
+out vec4 FG; //foreground color
+out vec4 BG; //background color
+vec3 getGridVertexUV(int ch, int tile_vertex)
+{
+    int cells_per_page = AtlasGrid.x * AtlasGrid.y;
+    int cell = ch % cells_per_page;
+    int column = cell % AtlasGrid.x;
+    int row = cell / AtlasGrid.x;
+    vec2 cell_size = vec2(1.0) / vec2(AtlasGrid);
+    vec4 uv_square = vec4(float(column) * cell_size.x, float(column + 1) * cell_size.x, float(row + 1) * cell_size.y, float(row) * cell_size.y);
+    vec2 vert_uvs[6] = vec2[](uv_square.sp, uv_square.sq, uv_square.tq, uv_square.sp, uv_square.tq, uv_square.tp);
+    return vec3(vert_uvs[tile_vertex], float(ch / cells_per_page));
+}
+vec3 getVertexUV(int ch, int tile_vertex)
+{
+    if (AtlasGrid.x > 0)
+    {
+        return getGridVertexUV(ch, tile_vertex);
+    }
+    uvec4 packed_coordinates = texelFetch(Coordinates, ch);
+    vec2 page_size = vec2(textureSize(Atlas, 0).xy);
+    float left = float(packed_coordinates.r & 65535u) / page_size.x;
+    float top = float(packed_coordinates.r >> 16u) / page_size.y;
+    float right = float(packed_coordinates.g & 65535u) / page_size.x;
+    float bottom = float(packed_coordinates.g >> 16u) / page_size.y;
+    vec4 uv_square = vec4(left, right, bottom, top);
+    vec2 vert_uvs[6] = vec2[](uv_square.sp, uv_square.sq, uv_square.tq, uv_square.sp, uv_square.tq, uv_square.tp);
+    vec3 uv = vec3(vert_uvs[tile_vertex], float(packed_coordinates.b));
+    return uv;
+}
+vec2 getVertexPixelPosition(int tile_vertex, inout int buffer_offset)
+{
+    uint x_pixel = texelFetch(Data, buffer_offset).r;
+    buffer_offset += 1;
+    x_pixel += texelFetch(Data, buffer_offset).r * 256u;
+    buffer_offset += 1;
+    uint y_pixel = texelFetch(Data, buffer_offset).r;
+    buffer_offset += 1;
+    y_pixel += texelFetch(Data, buffer_offset).r * 256u;
+    buffer_offset += 1;
+    uint tile_pixel_width = texelFetch(Data, buffer_offset).r;
+    buffer_offset += 1;
+    tile_pixel_width += texelFetch(Data, buffer_offset).r * 256u;
+    buffer_offset += 1;
+    uint tile_pixel_height = texelFetch(Data, buffer_offset).r;
+    buffer_offset += 1;
+    tile_pixel_height += texelFetch(Data, buffer_offset).r * 256u;
+    buffer_offset += 1;
+    float tile_lx = float(int(x_pixel) - 16384);
+    float tile_ty = float(int(y_pixel) - 16384);
+    float tile_rx = tile_lx + float(tile_pixel_width);
+    float tile_by = tile_ty + float(tile_pixel_height);
+    vec4 position_square = vec4(tile_lx, tile_rx, tile_by, tile_ty);
+    vec2 vert_positions[6] = vec2[](position_square.sp, position_square.sq, position_square.tq, position_square.sp, position_square.tq, position_square.tp);
+    return vert_positions[tile_vertex];
+}
+vec4 getColor32(inout int buffer_offset)
+{
+    float r = float(texelFetch(Data, buffer_offset).r) / 255.0;
+    buffer_offset += 1;
+    float g = float(texelFetch(Data, buffer_offset).r) / 255.0;
+    buffer_offset += 1;
+    float b = float(texelFetch(Data, buffer_offset).r) / 255.0;
+    buffer_offset += 1;
+    float a = float(texelFetch(Data, buffer_offset).r) / 255.0;
+    buffer_offset += 1;
+    return vec4(r, g, b, a);
+}
+int getGlyph16(inout int buffer_offset)
+{
+    int glyph = int(texelFetch(Data, buffer_offset).r);
+    buffer_offset += 1;
+    glyph += int(texelFetch(Data, buffer_offset).r * 256u);
+    buffer_offset += 1;
+    return glyph;
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #version 330 core
+uniform vec2 UVScale;
 out vec2 UV;
 void main()
 {
@@ -6,6 +7,7 @@ void main()
 	int tile_vertex = gl_VertexID % 6;
 	vec4 value_square = vec4(0.0, 1.0, 1.0, 0.0);
 	vec2 value_corners[6] = vec2[](value_square.sp, value_square.sq, value_square.tq, value_square.sp, value_square.tq, value_square.tp);
-	UV = value_corners[tile_vertex];
-	gl_Position = vec4(UV.x, 1 - UV.y, 0.0, 1.0) * Matrix;
+	vec2 corner = value_corners[tile_vertex];
+	UV = vec2(corner.x, UVScale.y < 0.0 ? 1.0 - corner.y : corner.y) * abs(UVScale);
+	gl_Position = vec4(corner.x, 1 - corner.y, 0.0, 1.0) * Matrix;
 }
\ No newline at end of file
@@ -20,14 +20,19 @@
 #include <TUIC/tuic.h>
 #include "objects.h"
 #include "opengl33.h"
+#include "software.h"
 #include <TUIC/system.h>
 
 #include <assert.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 
 static int sAtlasCount = 0;
 
+// Every new atlas and every change to the metrics or kerning of any atlas takes a new version, so measurements cached against an older version (or against a destroyed atlas whose address was reused) are never reused.
+static uint32_t sAtlasMetricsVersion = 0;
+
 TuiResult tuiAtlasCreateFromImage(TuiAtlas* atlas, int width, int height, int pages, const uint8_t* pixel_data, const float* const stpqp_coordinates, const int glyph_count)
 {
 	assert(atlas != NULL);
@@ -48,12 +53,13 @@ TuiResult tuiAtlasCreateFromImage(TuiAtlas* atlas, int width, int height, int pa
 		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
 	}
 	memset(atlas, 0, sizeof(TuiAtlas_s));
+	(*atlas)->MetricsVersion = ++sAtlasMetricsVersion;
 	(*atlas)->ChannelCount = image->ChannelCount;
 	(*atlas)->Width = width;
 	(*atlas)->Height = height;
 	(*atlas)->Pages = pages;
 	(*atlas)->GlyphCount = glyph_count;
-	TuiResult result = tuiAtlasCreate_Opengl33((*atlas), pixel_data, stpqp_coordinates);	
+	TuiResult result = tui_is_software_backend() ? tuiAtlasCreate_Software(*atlas, pixel_data, stpqp_coordinates) : tuiAtlasCreate_Opengl33((*atlas), pixel_data, stpqp_coordinates);	
 	if (result != TUI_RESULT_OK)
 	{
 		tuiFree(*atlas)
@@ -64,10 +70,198 @@ TuiResult tuiAtlasCreateFromImage(TuiAtlas* atlas, int width, int height, int pa
 	return TUI_RESULT_OK;
 }
 
+// Create an atlas from pages in the native format of their channel count. Grid atlases have columns and rows above 0 and no coordinates.
+static TuiResult _tuiAtlasCreate(TuiAtlas* atlas, int width, int height, int pages, int channel_count, const uint8_t* pixel_data, const float* stpqp_coordinates, int glyph_count, int columns, int rows)
+{
+	assert(atlas != NULL);
+	assert(pixel_data != NULL);
+	TuiSystem system = tui_get_system();
+	if (system == NULL)
+	{
+		return TUI_RESULT_ERROR_NOT_INITIALIZED;
+	}
+	if (width <= 0 || height <= 0 || pages <= 0 || glyph_count <= 0 || channel_count < 1 || channel_count > 4 || (columns == 0 && stpqp_coordinates == NULL))
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	*atlas = (TuiAtlas)tuiAllocate(sizeof(TuiAtlas_s));
+	if (*atlas == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*atlas, 0, sizeof(TuiAtlas_s));
+	(*atlas)->MetricsVersion = ++sAtlasMetricsVersion;
+	(*atlas)->Width = width;
+	(*atlas)->Height = height;
+	(*atlas)->Pages = pages;
+	(*atlas)->Channels = channel_count;
+	(*atlas)->GlyphCount = glyph_count;
+	(*atlas)->GridColumns = columns;
+	(*atlas)->GridRows = rows;
+	TuiResult result = tui_is_software_backend() ? tuiAtlasCreate_Software(*atlas, pixel_data, stpqp_coordinates) : tuiAtlasCreate_Opengl33(*atlas, pixel_data, stpqp_coordinates);
+	if (result != TUI_RESULT_OK)
+	{
+		tuiFree(*atlas);
+		*atlas = NULL;
+		return result;
+	}
+	sAtlasCount++;
+	return TUI_RESULT_OK;
+}
+
+static TuiResult _tuiAtlasCreateGrid(TuiAtlas* atlas, int width, int height, int pages, int channel_count, const uint8_t* pixel_data, int columns, int rows)
+{
+	// Cells must divide the pages evenly so the batch shader can compute exact uvs from a glyph index.
+	if (columns <= 0 || rows <= 0 || width <= 0 || height <= 0 || width % columns != 0 || height % rows != 0)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	return _tuiAtlasCreate(atlas, width, height, pages, channel_count, pixel_data, NULL, columns * rows * pages, columns, rows);
+}
+
+TuiResult tuiAtlasCreateFromPixels(TuiAtlas* atlas, int width, int height, int pages, int channel_count, const uint8_t* pixel_data, const float* stpqp_coordinates, int glyph_count)
+{
+	assert(stpqp_coordinates != NULL);
+	return _tuiAtlasCreate(atlas, width, height, pages, channel_count, pixel_data, stpqp_coordinates, glyph_count, 0, 0);
+}
+
+TuiResult tuiAtlasCreateGrid(TuiAtlas* atlas, int width, int height, int pages, const uint8_t* pixel_data, int columns, int rows)
+{
+	return _tuiAtlasCreateGrid(atlas, width, height, pages, 4, pixel_data, columns, rows);
+}
+
+TuiResult tuiAtlasCreateGridFromImage(TuiAtlas* atlas, int image_width, int image_height, int channel_count, const uint8_t* image_pixels, int columns, int rows)
+{
+	// The image is uploaded in its own format, so 1 and 2 channel images take a quarter and half the memory of RGBA.
+	return _tuiAtlasCreateGrid(atlas, image_width, image_height, 1, channel_count, image_pixels, columns, rows);
+}
+
+TuiResult tuiAtlasCreateFromCache(TuiAtlas* atlas, TuiAtlasCache atlas_cache)
+{
+	assert(atlas_cache != NULL);
+	// The pages are uploaded straight from the mapped file, so nothing is decoded or copied first.
+	return _tuiAtlasCreate(atlas, atlas_cache->Width, atlas_cache->Height, atlas_cache->Pages, atlas_cache->ChannelCount, atlas_cache->PixelData, atlas_cache->StpqpCoordinates, atlas_cache->GlyphCount, 0, 0);
+}
+
+TuiResult tuiAtlasCreateFromEmbedded(TuiAtlas* atlas, const TuiEmbeddedAtlas* embedded_atlas)
+{
+	assert(embedded_atlas != NULL);
+	if (embedded_atlas->grid_columns > 0)
+	{
+		return _tuiAtlasCreateGrid(atlas, embedded_atlas->width, embedded_atlas->height, embedded_atlas->pages, embedded_atlas->channel_count, embedded_atlas->pixel_data, embedded_atlas->grid_columns, embedded_atlas->grid_rows);
+	}
+	return _tuiAtlasCreate(atlas, embedded_atlas->width, embedded_atlas->height, embedded_atlas->pages, embedded_atlas->channel_count, embedded_atlas->pixel_data, embedded_atlas->stpqp_coordinates, embedded_atlas->glyph_count, 0, 0);
+}
+
+TuiResult tuiAtlasCreateFromBitmapFont(TuiAtlas* atlas, TuiBitmapFont bitmap_font, int columns)
+{
+	assert(bitmap_font != NULL);
+	if (columns < 1)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	// Glyphs are expanded into a single channel page, so glyph i of the font is cell i of the atlas.
+	int glyph_width, glyph_height, glyph_count;
+	tuiBitmapFontGetDimensions(bitmap_font, &glyph_width, &glyph_height, &glyph_count);
+	const int rows = (glyph_count + columns - 1) / columns;
+	uint8_t* pixels = (uint8_t*)tuiAllocate((size_t)columns * (size_t)glyph_width * (size_t)rows * (size_t)glyph_height);
+	if (pixels == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	tuiBitmapFontExpandGlyphs(bitmap_font, columns, 1, pixels);
+	TuiResult result = _tuiAtlasCreateGrid(atlas, columns * glyph_width, rows * glyph_height, 1, 1, pixels, columns, rows);
+	tuiFree(pixels);
+	return result;
+}
+
+TuiResult tuiAtlasCreateFromGlyphCache(TuiAtlas* atlas, TuiGlyphCache glyph_cache)
+{
+	assert(atlas != NULL);
+	assert(glyph_cache != NULL);
+	TuiSystem system = tui_get_system();
+	if (system == NULL)
+	{
+		return TUI_RESULT_ERROR_NOT_INITIALIZED;
+	}
+	*atlas = (TuiAtlas)tuiAllocate(sizeof(TuiAtlas_s));
+	if (*atlas == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*atlas, 0, sizeof(TuiAtlas_s));
+	(*atlas)->MetricsVersion = ++sAtlasMetricsVersion;
+	(*atlas)->Width = glyph_cache->PageWidth;
+	(*atlas)->Height = glyph_cache->PageHeight;
+	(*atlas)->Pages = glyph_cache->PageCount;
+	(*atlas)->Channels = glyph_cache->ChannelCount;
+	(*atlas)->GlyphCount = glyph_cache->SlotCount;
+	TuiResult result = tui_is_software_backend() ? tuiAtlasCreateGlyphCache_Software(*atlas, glyph_cache->StpqpCoordinates) : tuiAtlasCreateGlyphCache_Opengl33(*atlas, glyph_cache->StpqpCoordinates);
+	if (result != TUI_RESULT_OK)
+	{
+		tuiFree(*atlas);
+		*atlas = NULL;
+		return result;
+	}
+	sAtlasCount++;
+	result = tuiAtlasUpdateFromGlyphCache(*atlas, glyph_cache);
+	if (result != TUI_RESULT_OK)
+	{
+		tuiAtlasDestroy(*atlas);
+		*atlas = NULL;
+		return result;
+	}
+	return TUI_RESULT_OK;
+}
+
+TuiResult tuiAtlasUpdateFromGlyphCache(TuiAtlas atlas, TuiGlyphCache glyph_cache)
+{
+	assert(atlas != NULL);
+	assert(glyph_cache != NULL);
+	if ((int)atlas->Width != glyph_cache->PageWidth || (int)atlas->Height != glyph_cache->PageHeight || (int)atlas->Pages != glyph_cache->PageCount || (int)atlas->GlyphCount != glyph_cache->SlotCount)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	// Only the cells that changed are uploaded, each with the coordinates entry of its glyph.
+	const int cells_per_page = glyph_cache->CellsWide * (glyph_cache->PageHeight / glyph_cache->CellHeight);
+	const size_t cell_size = (size_t)glyph_cache->CellWidth * (size_t)glyph_cache->CellHeight * (size_t)glyph_cache->ChannelCount;
+	for (int dirty_i = 0; dirty_i < glyph_cache->DirtyCount; dirty_i++)
+	{
+		const int slot = glyph_cache->DirtySlots[dirty_i];
+		const int cell = slot % cells_per_page;
+		TuiResult result = (tui_is_software_backend() ? tuiAtlasUpdateGlyph_Software : tuiAtlasUpdateGlyph_Opengl33)(atlas, slot, slot / cells_per_page, (cell % glyph_cache->CellsWide) * glyph_cache->CellWidth, (cell / glyph_cache->CellsWide) * glyph_cache->CellHeight, glyph_cache->CellWidth, glyph_cache->CellHeight, &glyph_cache->StagingPixels[(size_t)dirty_i * cell_size], &glyph_cache->StpqpCoordinates[(size_t)slot * TUI_STPQP_COORDINATES_PER_GLYPH]);
+		if (result != TUI_RESULT_OK)
+		{
+			return result;
+		}
+	}
+	tuiGlyphCacheClearDirtyGlyphs(glyph_cache);
+	return TUI_RESULT_OK;
+}
+
 void tuiAtlasDestroy(TuiAtlas atlas)
 {
 	assert(atlas != NULL);
-	tuiAtlasDestroy_Opengl33(atlas);
+	if (tui_is_software_backend())
+	{
+		tuiAtlasDestroy_Software(atlas);
+	}
+	else
+	{
+		tuiAtlasDestroy_Opengl33(atlas);
+	}
+	if (atlas->GlyphMetrics != NULL)
+	{
+		tuiFree(atlas->GlyphMetrics);
+	}
+	if (atlas->KerningKeys != NULL)
+	{
+		tuiFree(atlas->KerningKeys);
+	}
+	if (atlas->Label != NULL)
+	{
+		tuiFree(atlas->Label);
+	}
 	tuiFree(atlas);
 	sAtlasCount--;
 }
@@ -77,13 +271,20 @@ TuiResult tuiAtlasSetData(TuiAtlas atlas, int width, int height, int pages, cons
 	assert(atlas != NULL);
 	assert(pixel_data != NULL);
 	assert(stpqp_coordinates != NULL);
-	tuiAtlasDestroy_Opengl33(atlas);
+	if (tui_is_software_backend())
+	{
+		tuiAtlasDestroy_Software(atlas);
+	}
+	else
+	{
+		tuiAtlasDestroy_Opengl33(atlas);
+	}
 	atlas->ChannelCount = image->ChannelCount;
 	atlas->Width = width;
 	atlas->Height = height;
 	atlas->Pages = pages;
 	atlas->GlyphCount = glyph_count;
-	TuiResult result = tuiAtlasCreate_Opengl33(atlas, pixel_data, stpqp_coordinates);	
+	TuiResult result = tui_is_software_backend() ? tuiAtlasCreate_Software(atlas, pixel_data, stpqp_coordinates) : tuiAtlasCreate_Opengl33(atlas, pixel_data, stpqp_coordinates);	
 	if (result != TUI_RESULT_OK)
 	{
 		tuiFree(atlas);
@@ -116,6 +317,227 @@ int tuiAtlasGetGlyphCount(TuiAtlas atlas)
 	return atlas->GlyphCount;
 }
 
+TuiResult tuiAtlasSetDistanceField(TuiAtlas atlas, TuiBoolean distance_field)
+{
+	assert(atlas != NULL);
+	// The software backend reads the flag when it draws, so only the Opengl33 backend has programs to switch.
+	TuiResult result = tui_is_software_backend() ? TUI_RESULT_OK : tuiAtlasSetDistanceField_Opengl33(atlas, distance_field);
+	if (result != TUI_RESULT_OK)
+	{
+		return result;
+	}
+	atlas->DistanceField = distance_field;
+	return TUI_RESULT_OK;
+}
+
+TuiResult tuiAtlasSetLabel(TuiAtlas atlas, const char* label)
+{
+	assert(atlas != NULL);
+	char* label_copy = NULL;
+	if (label != NULL)
+	{
+		label_copy = (char*)tuiAllocate((strlen(label) + 1) * sizeof(char));
+		if (label_copy == NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		strcpy(label_copy, label);
+	}
+	if (atlas->Label != NULL)
+	{
+		tuiFree(atlas->Label);
+	}
+	atlas->Label = label_copy;
+	if (tui_is_software_backend())
+	{
+		return TUI_RESULT_OK;
+	}
+	return tuiAtlasSetLabel_Opengl33(atlas);
+}
+
+const char* tuiAtlasGetLabel(TuiAtlas atlas)
+{
+	assert(atlas != NULL);
+	return atlas->Label;
+}
+
+TuiBoolean tuiAtlasIsDistanceField(TuiAtlas atlas)
+{
+	assert(atlas != NULL);
+	return atlas->DistanceField;
+}
+
+TuiResult tuiAtlasSetGlyphMetrics(TuiAtlas atlas, const TuiGlyphMetrics* glyph_metrics)
+{
+	assert(atlas != NULL);
+	TuiGlyphMetrics* copied_metrics = NULL;
+	if (glyph_metrics != NULL)
+	{
+		copied_metrics = (TuiGlyphMetrics*)tuiAllocate(atlas->GlyphCount * sizeof(TuiGlyphMetrics));
+		if (copied_metrics == NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		memcpy(copied_metrics, glyph_metrics, atlas->GlyphCount * sizeof(TuiGlyphMetrics));
+	}
+	if (atlas->GlyphMetrics != NULL)
+	{
+		tuiFree(atlas->GlyphMetrics);
+	}
+	atlas->GlyphMetrics = copied_metrics;
+	atlas->MetricsVersion = ++sAtlasMetricsVersion;
+	return TUI_RESULT_OK;
+}
+
+const TuiGlyphMetrics* tuiAtlasGetGlyphMetrics(TuiAtlas atlas)
+{
+	assert(atlas != NULL);
+	return atlas->GlyphMetrics;
+}
+
+void tuiAtlasGetGlyphMetric(TuiAtlas atlas, uint16_t glyph, TuiGlyphMetrics* glyph_metrics)
+{
+	assert(atlas != NULL);
+	assert(glyph_metrics != NULL);
+	if (atlas->GlyphMetrics != NULL && glyph < atlas->GlyphCount)
+	{
+		*glyph_metrics = atlas->GlyphMetrics[glyph];
+	}
+	else if (atlas->GridColumns > 0)
+	{
+		// Grid atlases with no metrics are monospace, with every glyph filling a cell that sits on the baseline.
+		const int cell_width = (int)atlas->Width / atlas->GridColumns;
+		const int cell_height = (int)atlas->Height / atlas->GridRows;
+		glyph_metrics->advance = cell_width;
+		glyph_metrics->bearing_x = 0;
+		glyph_metrics->bearing_y = cell_height;
+		glyph_metrics->width = cell_width;
+		glyph_metrics->height = cell_height;
+	}
+	else
+	{
+		memset(glyph_metrics, 0, sizeof(TuiGlyphMetrics));
+	}
+}
+
+static int _tuiCompareKerningKeys(const void* a, const void* b)
+{
+	const uint64_t key_a = *(const uint64_t*)a;
+	const uint64_t key_b = *(const uint64_t*)b;
+	return (key_a > key_b) - (key_a < key_b);
+}
+
+TuiResult tuiAtlasSetKerningPairs(TuiAtlas atlas, const TuiKerningPair* kerning_pairs, int kerning_pair_count)
+{
+	assert(atlas != NULL);
+	if (kerning_pair_count < 0 || (kerning_pair_count > 0 && kerning_pairs == NULL))
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	for (int pair_i = 0; pair_i < kerning_pair_count; pair_i++)
+	{
+		if (kerning_pairs[pair_i].left_glyph >= atlas->GlyphCount || kerning_pairs[pair_i].right_glyph >= atlas->GlyphCount)
+		{
+			return TUI_RESULT_ERROR_INVALID_VALUE;
+		}
+	}
+	// Pairs are sorted by the left glyph above the right glyph so a pair is found with a binary search, and a pair given more than once keeps its last adjustment.
+	uint64_t* sorted_pairs = (uint64_t*)tuiAllocate(((size_t)kerning_pair_count + 1) * sizeof(uint64_t));
+	uint32_t* keys = (uint32_t*)tuiAllocate(((size_t)kerning_pair_count + 1) * (sizeof(uint32_t) + sizeof(int)));
+	if (sorted_pairs == NULL || keys == NULL)
+	{
+		if (sorted_pairs != NULL)
+		{
+			tuiFree(sorted_pairs);
+		}
+		if (keys != NULL)
+		{
+			tuiFree(keys);
+		}
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	for (int pair_i = 0; pair_i < kerning_pair_count; pair_i++)
+	{
+		const uint32_t key = ((uint32_t)kerning_pairs[pair_i].left_glyph << 16) | kerning_pairs[pair_i].right_glyph;
+		sorted_pairs[pair_i] = ((uint64_t)key << 32) | (uint64_t)pair_i;
+	}
+	qsort(sorted_pairs, (size_t)kerning_pair_count, sizeof(uint64_t), _tuiCompareKerningKeys);
+	int* adjustments = (int*)(keys + kerning_pair_count + 1);
+	int key_count = 0;
+	for (int pair_i = 0; pair_i < kerning_pair_count; pair_i++)
+	{
+		const uint32_t key = (uint32_t)(sorted_pairs[pair_i] >> 32);
+		if (key_count == 0 || keys[key_count - 1] != key)
+		{
+			key_count++;
+		}
+		keys[key_count - 1] = key;
+		adjustments[key_count - 1] = kerning_pairs[sorted_pairs[pair_i] & 0xFFFFFFFFu].adjustment;
+	}
+	tuiFree(sorted_pairs);
+	if (atlas->KerningKeys != NULL)
+	{
+		tuiFree(atlas->KerningKeys);
+	}
+	atlas->KerningPairCount = key_count;
+	atlas->KerningKeys = keys;
+	atlas->KerningAdjustments = adjustments;
+	atlas->MetricsVersion = ++sAtlasMetricsVersion;
+	return TUI_RESULT_OK;
+}
+
+int tuiAtlasGetKerning(TuiAtlas atlas, uint16_t left_glyph, uint16_t right_glyph)
+{
+	assert(atlas != NULL);
+	const uint32_t key = ((uint32_t)left_glyph << 16) | right_glyph;
+	int low = 0;
+	int high = atlas->KerningPairCount;
+	while (low < high)
+	{
+		const int middle = low + (high - low) / 2;
+		if (atlas->KerningKeys[middle] < key)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return (low < atlas->KerningPairCount && atlas->KerningKeys[low] == key) ? atlas->KerningAdjustments[low] : 0;
+}
+
+int tuiAtlasMeasureGlyphs(TuiAtlas atlas, const uint16_t* glyphs, int glyph_count)
+{
+	assert(atlas != NULL);
+	assert(glyphs != NULL || glyph_count == 0);
+	int width = 0;
+	for (int glyph_i = 0; glyph_i < glyph_count; glyph_i++)
+	{
+		TuiGlyphMetrics glyph_metrics;
+		tuiAtlasGetGlyphMetric(atlas, glyphs[glyph_i], &glyph_metrics);
+		width += glyph_metrics.advance;
+		if (glyph_i + 1 < glyph_count && atlas->KerningPairCount > 0)
+		{
+			width += tuiAtlasGetKerning(atlas, glyphs[glyph_i], glyphs[glyph_i + 1]);
+		}
+	}
+	return width;
+}
+
+void tuiAtlasGetGridDimensions(TuiAtlas atlas, int* const columns, int* const rows)
+{
+	assert(atlas != NULL);
+	if (columns != NULL)
+	{
+		*columns = atlas->GridColumns;
+	}
+	if (rows != NULL)
+	{
+		*rows = atlas->GridRows;
+	}
+}
+
 size_t tuiGetAtlasCount()
 {
 	return sAtlasCount;
@@ -0,0 +1,489 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/atlas_builder.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "parallel.h"
+#include "math_inline.h"
+#include <TUIC/atlas.h>
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// One run of unused space along the top of a page's skyline. Everything below Y from X to X + Width - 1 is either used or wasted.
+typedef struct TuiSkylineNode
+{
+	int X;
+
+	int Y;
+
+	int Width;
+} TuiSkylineNode;
+
+typedef struct TuiAtlasPlacement
+{
+	int X;
+
+	int Y;
+
+	int Page;
+} TuiAtlasPlacement;
+
+// A glyph with the keys it is sorted by in one packing order. Glyphs with equal keys keep the order they were added in, so every sort is deterministic.
+typedef struct TuiAtlasSortKey
+{
+	int Primary;
+
+	int Secondary;
+
+	int GlyphIndex;
+} TuiAtlasSortKey;
+
+// The result of packing every glyph in one order.
+typedef struct TuiAtlasPacking
+{
+	TuiAtlasSortKey* Keys;
+
+	TuiAtlasPlacement* Placements;
+
+	TuiSkylineNode* Nodes;
+
+	int* NodeCounts;
+
+	int PageCapacity;
+
+	int PageCount;
+
+	TuiResult Result;
+} TuiAtlasPacking;
+
+typedef struct TuiAtlasPackJobs
+{
+	TuiAtlasBuilder AtlasBuilder;
+
+	TuiAtlasPacking Packings[TUI_ATLAS_BUILDER_PACKING_ORDER_COUNT];
+} TuiAtlasPackJobs;
+
+static int _tuiAtlasSortKeyCompare(const void* a, const void* b)
+{
+	const TuiAtlasSortKey* key_a = (const TuiAtlasSortKey*)a;
+	const TuiAtlasSortKey* key_b = (const TuiAtlasSortKey*)b;
+	if (key_a->Primary != key_b->Primary)
+	{
+		return (key_a->Primary > key_b->Primary) ? -1 : 1;
+	}
+	if (key_a->Secondary != key_b->Secondary)
+	{
+		return (key_a->Secondary > key_b->Secondary) ? -1 : 1;
+	}
+	return (key_a->GlyphIndex < key_b->GlyphIndex) ? -1 : 1;
+}
+
+// Get the top y a rectangle would be placed at if its left edge is on a skyline node, or -1 if it does not fit there.
+static int _tuiSkylineFit(const TuiSkylineNode* nodes, const int node_i, const int width, const int height, const int page_width, const int page_height)
+{
+	if (nodes[node_i].X + width > page_width)
+	{
+		return -1;
+	}
+	int y = 0;
+	int remaining_width = width;
+	for (int i = node_i; remaining_width > 0; i++)
+	{
+		y = MAX(y, nodes[i].Y);
+		if (y + height > page_height)
+		{
+			return -1;
+		}
+		remaining_width -= nodes[i].Width;
+	}
+	return y;
+}
+
+// Raise the skyline under a placed rectangle, trimming the nodes it covers and merging neighbours of equal height.
+static void _tuiSkylineInsert(TuiSkylineNode* nodes, int* node_count, const int node_i, const int width, const int bottom_y)
+{
+	memmove(&nodes[node_i + 1], &nodes[node_i], (size_t)(*node_count - node_i) * sizeof(TuiSkylineNode));
+	(*node_count)++;
+	nodes[node_i].Y = bottom_y;
+	nodes[node_i].Width = width;
+	for (int i = node_i + 1; i < *node_count; )
+	{
+		const int overlap = nodes[i - 1].X + nodes[i - 1].Width - nodes[i].X;
+		if (overlap <= 0)
+		{
+			break;
+		}
+		nodes[i].X += overlap;
+		nodes[i].Width -= overlap;
+		if (nodes[i].Width > 0)
+		{
+			break;
+		}
+		memmove(&nodes[i], &nodes[i + 1], (size_t)(*node_count - i - 1) * sizeof(TuiSkylineNode));
+		(*node_count)--;
+	}
+	for (int i = 0; i < *node_count - 1; )
+	{
+		if (nodes[i].Y == nodes[i + 1].Y)
+		{
+			nodes[i].Width += nodes[i + 1].Width;
+			memmove(&nodes[i + 1], &nodes[i + 2], (size_t)(*node_count - i - 2) * sizeof(TuiSkylineNode));
+			(*node_count)--;
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
+// Place a rectangle on the skyline node that leaves its bottom edge highest, preferring the leftmost. Returns TUI_FALSE if it does not fit on the page.
+static TuiBoolean _tuiSkylinePlace(TuiSkylineNode* nodes, int* node_count, const int width, const int height, const int page_width, const int page_height, int* x, int* y)
+{
+	int best_node_i = -1;
+	int best_y = 0;
+	for (int node_i = 0; node_i < *node_count; node_i++)
+	{
+		const int fit_y = _tuiSkylineFit(nodes, node_i, width, height, page_width, page_height);
+		if (fit_y >= 0 && (best_node_i < 0 || fit_y < best_y))
+		{
+			best_node_i = node_i;
+			best_y = fit_y;
+		}
+	}
+	if (best_node_i < 0)
+	{
+		return TUI_FALSE;
+	}
+	*x = nodes[best_node_i].X;
+	*y = best_y;
+	_tuiSkylineInsert(nodes, node_count, best_node_i, width, best_y + height);
+	return TUI_TRUE;
+}
+
+// Sort the glyphs by one packing order, then place each on the first page it fits on, starting a new page when it fits on none.
+static void _tuiAtlasPackJob(void* user_data, int job_index)
+{
+	TuiAtlasPackJobs* jobs = (TuiAtlasPackJobs*)user_data;
+	TuiAtlasBuilder atlas_builder = jobs->AtlasBuilder;
+	TuiAtlasPacking* packing = &jobs->Packings[job_index];
+	const int padding = atlas_builder->Padding * 2;
+	const int nodes_per_page = atlas_builder->PageWidth + 1;
+	for (int glyph_i = 0; glyph_i < atlas_builder->GlyphCount; glyph_i++)
+	{
+		const int width = atlas_builder->Glyphs[glyph_i].Width + padding;
+		const int height = atlas_builder->Glyphs[glyph_i].Height + padding;
+		TuiAtlasSortKey* key = &packing->Keys[glyph_i];
+		key->GlyphIndex = glyph_i;
+		switch (job_index)
+		{
+		case 0:
+			key->Primary = MAX(width, height);
+			key->Secondary = MIN(width, height);
+			break;
+		case 1:
+			key->Primary = height;
+			key->Secondary = width;
+			break;
+		case 2:
+			key->Primary = width * height;
+			key->Secondary = MAX(width, height);
+			break;
+		default:
+			key->Primary = width;
+			key->Secondary = height;
+			break;
+		}
+	}
+	qsort(packing->Keys, (size_t)atlas_builder->GlyphCount, sizeof(TuiAtlasSortKey), _tuiAtlasSortKeyCompare);
+
+	packing->PageCount = 0;
+	for (int key_i = 0; key_i < atlas_builder->GlyphCount; key_i++)
+	{
+		const int glyph_i = packing->Keys[key_i].GlyphIndex;
+		const int width = atlas_builder->Glyphs[glyph_i].Width + padding;
+		const int height = atlas_builder->Glyphs[glyph_i].Height + padding;
+		TuiAtlasPlacement* placement = &packing->Placements[glyph_i];
+		TuiBoolean placed = TUI_FALSE;
+		for (int page = 0; page < packing->PageCount && !placed; page++)
+		{
+			placed = _tuiSkylinePlace(&packing->Nodes[(size_t)page * nodes_per_page], &packing->NodeCounts[page], width, height, atlas_builder->PageWidth, atlas_builder->PageHeight, &placement->X, &placement->Y);
+			placement->Page = page;
+		}
+		if (placed)
+		{
+			continue;
+		}
+		if (packing->PageCount == packing->PageCapacity)
+		{
+			const int page_capacity = MAX(packing->PageCapacity * 2, 1);
+			TuiSkylineNode* nodes = (TuiSkylineNode*)tuiReallocate(packing->Nodes, (size_t)page_capacity * (size_t)nodes_per_page * sizeof(TuiSkylineNode));
+			if (nodes == NULL)
+			{
+				packing->Result = TUI_RESULT_ERROR_OUT_OF_MEMORY;
+				return;
+			}
+			packing->Nodes = nodes;
+			int* node_counts = (int*)tuiReallocate(packing->NodeCounts, (size_t)page_capacity * sizeof(int));
+			if (node_counts == NULL)
+			{
+				packing->Result = TUI_RESULT_ERROR_OUT_OF_MEMORY;
+				return;
+			}
+			packing->NodeCounts = node_counts;
+			packing->PageCapacity = page_capacity;
+		}
+		const int page = packing->PageCount++;
+		TuiSkylineNode* page_nodes = &packing->Nodes[(size_t)page * nodes_per_page];
+		page_nodes[0].X = 0;
+		page_nodes[0].Y = 0;
+		page_nodes[0].Width = atlas_builder->PageWidth;
+		packing->NodeCounts[page] = 1;
+		placed = _tuiSkylinePlace(page_nodes, &packing->NodeCounts[page], width, height, atlas_builder->PageWidth, atlas_builder->PageHeight, &placement->X, &placement->Y);
+		assert(placed);
+		placement->Page = page;
+	}
+	packing->Result = TUI_RESULT_OK;
+}
+
+// Copy one glyph onto its page. Padding keeps glyphs apart, so glyphs can be copied by different threads at once.
+static void _tuiAtlasCopyJob(void* user_data, int job_index)
+{
+	TuiAtlasBuilder atlas_builder = (TuiAtlasBuilder)user_data;
+	const TuiAtlasBuilderGlyph* glyph = &atlas_builder->Glyphs[job_index];
+	const size_t channel_count = (size_t)atlas_builder->ChannelCount;
+	const size_t page_size = (size_t)atlas_builder->PageWidth * (size_t)atlas_builder->PageHeight * channel_count;
+	const size_t row_size = (size_t)glyph->Width * channel_count;
+	for (int y = 0; y < glyph->Height; y++)
+	{
+		uint8_t* destination = &atlas_builder->PixelData[page_size * (size_t)glyph->Page + ((size_t)(glyph->PageY + y) * (size_t)atlas_builder->PageWidth + (size_t)glyph->PageX) * channel_count];
+		memcpy(destination, &atlas_builder->GlyphPixels[glyph->PixelOffset + row_size * (size_t)y], row_size);
+	}
+}
+
+static void _tuiAtlasBuilderClearPages(TuiAtlasBuilder atlas_builder)
+{
+	tuiFree(atlas_builder->PixelData);
+	tuiFree(atlas_builder->StpqpCoordinates);
+	atlas_builder->PixelData = NULL;
+	atlas_builder->StpqpCoordinates = NULL;
+	atlas_builder->PageCount = 0;
+}
+
+TuiResult tuiAtlasBuilderCreate(TuiAtlasBuilder* atlas_builder, const int page_width, const int page_height, const int channel_count, const int padding)
+{
+	assert(atlas_builder != NULL);
+	if (page_width < 1 || page_height < 1 || channel_count < 1 || channel_count > 4 || padding < 0)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	*atlas_builder = (TuiAtlasBuilder)tuiAllocate(sizeof(TuiAtlasBuilder_s));
+	if (*atlas_builder == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*atlas_builder, 0, sizeof(TuiAtlasBuilder_s));
+	(*atlas_builder)->PageWidth = page_width;
+	(*atlas_builder)->PageHeight = page_height;
+	(*atlas_builder)->ChannelCount = channel_count;
+	(*atlas_builder)->Padding = padding;
+	return TUI_RESULT_OK;
+}
+
+void tuiAtlasBuilderDestroy(TuiAtlasBuilder atlas_builder)
+{
+	assert(atlas_builder != NULL);
+	_tuiAtlasBuilderClearPages(atlas_builder);
+	tuiFree(atlas_builder->Glyphs);
+	tuiFree(atlas_builder->GlyphPixels);
+	tuiFree(atlas_builder);
+}
+
+TuiResult tuiAtlasBuilderAddGlyph(TuiAtlasBuilder atlas_builder, const int width, const int height, const uint8_t* pixels)
+{
+	assert(atlas_builder != NULL);
+	assert(pixels != NULL);
+	if (width < 1 || height < 1 || width + atlas_builder->Padding * 2 > atlas_builder->PageWidth || height + atlas_builder->Padding * 2 > atlas_builder->PageHeight)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	if (atlas_builder->GlyphCount == atlas_builder->GlyphCapacity)
+	{
+		const int glyph_capacity = MAX(atlas_builder->GlyphCapacity * 2, 64);
+		TuiAtlasBuilderGlyph* glyphs = (TuiAtlasBuilderGlyph*)tuiReallocate(atlas_builder->Glyphs, (size_t)glyph_capacity * sizeof(TuiAtlasBuilderGlyph));
+		if (glyphs == NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		atlas_builder->Glyphs = glyphs;
+		atlas_builder->GlyphCapacity = glyph_capacity;
+	}
+	const size_t pixels_size = (size_t)width * (size_t)height * (size_t)atlas_builder->ChannelCount;
+	if (atlas_builder->GlyphPixelsSize + pixels_size > atlas_builder->GlyphPixelsCapacity)
+	{
+		const size_t glyph_pixels_capacity = MAX(atlas_builder->GlyphPixelsCapacity * 2, atlas_builder->GlyphPixelsSize + pixels_size);
+		uint8_t* glyph_pixels = (uint8_t*)tuiReallocate(atlas_builder->GlyphPixels, glyph_pixels_capacity);
+		if (glyph_pixels == NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		atlas_builder->GlyphPixels = glyph_pixels;
+		atlas_builder->GlyphPixelsCapacity = glyph_pixels_capacity;
+	}
+	_tuiAtlasBuilderClearPages(atlas_builder);
+	TuiAtlasBuilderGlyph* glyph = &atlas_builder->Glyphs[atlas_builder->GlyphCount++];
+	memset(glyph, 0, sizeof(TuiAtlasBuilderGlyph));
+	glyph->Width = width;
+	glyph->Height = height;
+	glyph->PixelOffset = atlas_builder->GlyphPixelsSize;
+	memcpy(&atlas_builder->GlyphPixels[glyph->PixelOffset], pixels, pixels_size);
+	atlas_builder->GlyphPixelsSize += pixels_size;
+	return TUI_RESULT_OK;
+}
+
+int tuiAtlasBuilderGetGlyphCount(TuiAtlasBuilder atlas_builder)
+{
+	assert(atlas_builder != NULL);
+	return atlas_builder->GlyphCount;
+}
+
+TuiResult tuiAtlasBuilderPack(TuiAtlasBuilder atlas_builder, const int thread_count)
+{
+	assert(atlas_builder != NULL);
+	if (atlas_builder->GlyphCount == 0)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	_tuiAtlasBuilderClearPages(atlas_builder);
+	TuiAtlasPackJobs jobs;
+	memset(&jobs, 0, sizeof(TuiAtlasPackJobs));
+	jobs.AtlasBuilder = atlas_builder;
+	TuiResult result = TUI_RESULT_OK;
+	for (int packing_i = 0; packing_i < TUI_ATLAS_BUILDER_PACKING_ORDER_COUNT; packing_i++)
+	{
+		TuiAtlasPacking* packing = &jobs.Packings[packing_i];
+		packing->Keys = (TuiAtlasSortKey*)tuiAllocate((size_t)atlas_builder->GlyphCount * sizeof(TuiAtlasSortKey));
+		packing->Placements = (TuiAtlasPlacement*)tuiAllocate((size_t)atlas_builder->GlyphCount * sizeof(TuiAtlasPlacement));
+		if (packing->Keys == NULL || packing->Placements == NULL)
+		{
+			result = TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	int best_packing_i = -1;
+	if (result == TUI_RESULT_OK)
+	{
+		tui_parallel_for(TUI_ATLAS_BUILDER_PACKING_ORDER_COUNT, thread_count, _tuiAtlasPackJob, &jobs);
+		for (int packing_i = 0; packing_i < TUI_ATLAS_BUILDER_PACKING_ORDER_COUNT; packing_i++)
+		{
+			if (jobs.Packings[packing_i].Result != TUI_RESULT_OK)
+			{
+				result = jobs.Packings[packing_i].Result;
+			}
+			else if (best_packing_i < 0 || jobs.Packings[packing_i].PageCount < jobs.Packings[best_packing_i].PageCount)
+			{
+				best_packing_i = packing_i;
+			}
+		}
+	}
+	if (result == TUI_RESULT_OK)
+	{
+		const TuiAtlasPacking* packing = &jobs.Packings[best_packing_i];
+		const size_t page_size = (size_t)atlas_builder->PageWidth * (size_t)atlas_builder->PageHeight * (size_t)atlas_builder->ChannelCount;
+		atlas_builder->PixelData = (uint8_t*)tuiAllocate(page_size * (size_t)packing->PageCount);
+		atlas_builder->StpqpCoordinates = (float*)tuiAllocate((size_t)atlas_builder->GlyphCount * TUI_STPQP_COORDINATES_PER_GLYPH * sizeof(float));
+		if (atlas_builder->PixelData == NULL || atlas_builder->StpqpCoordinates == NULL)
+		{
+			_tuiAtlasBuilderClearPages(atlas_builder);
+			result = TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		else
+		{
+			memset(atlas_builder->PixelData, 0, page_size * (size_t)packing->PageCount);
+			atlas_builder->PageCount = packing->PageCount;
+			const float page_width = (float)atlas_builder->PageWidth;
+			const float page_height = (float)atlas_builder->PageHeight;
+			for (int glyph_i = 0; glyph_i < atlas_builder->GlyphCount; glyph_i++)
+			{
+				TuiAtlasBuilderGlyph* glyph = &atlas_builder->Glyphs[glyph_i];
+				glyph->PageX = packing->Placements[glyph_i].X + atlas_builder->Padding;
+				glyph->PageY = packing->Placements[glyph_i].Y + atlas_builder->Padding;
+				glyph->Page = packing->Placements[glyph_i].Page;
+				float* coordinates = &atlas_builder->StpqpCoordinates[(size_t)glyph_i * TUI_STPQP_COORDINATES_PER_GLYPH];
+				coordinates[0] = (float)glyph->PageX / page_width;
+				coordinates[1] = (float)glyph->PageY / page_height;
+				coordinates[2] = (float)(glyph->PageX + glyph->Width) / page_width;
+				coordinates[3] = (float)(glyph->PageY + glyph->Height) / page_height;
+				coordinates[4] = (float)glyph->Page;
+			}
+			tui_parallel_for(atlas_builder->GlyphCount, thread_count, _tuiAtlasCopyJob, atlas_builder);
+		}
+	}
+	for (int packing_i = 0; packing_i < TUI_ATLAS_BUILDER_PACKING_ORDER_COUNT; packing_i++)
+	{
+		tuiFree(jobs.Packings[packing_i].Keys);
+		tuiFree(jobs.Packings[packing_i].Placements);
+		tuiFree(jobs.Packings[packing_i].Nodes);
+		tuiFree(jobs.Packings[packing_i].NodeCounts);
+	}
+	return result;
+}
+
+void tuiAtlasBuilderGetDimensions(TuiAtlasBuilder atlas_builder, int* width, int* height, int* pages)
+{
+	assert(atlas_builder != NULL);
+	if (width != NULL)
+	{
+		*width = atlas_builder->PageWidth;
+	}
+	if (height != NULL)
+	{
+		*height = atlas_builder->PageHeight;
+	}
+	if (pages != NULL)
+	{
+		*pages = atlas_builder->PageCount;
+	}
+}
+
+const uint8_t* tuiAtlasBuilderGetPixelData(TuiAtlasBuilder atlas_builder)
+{
+	assert(atlas_builder != NULL);
+	return atlas_builder->PixelData;
+}
+
+const float* tuiAtlasBuilderGetStpqpCoordinates(TuiAtlasBuilder atlas_builder)
+{
+	assert(atlas_builder != NULL);
+	return atlas_builder->StpqpCoordinates;
+}
+
+TuiResult tuiAtlasBuilderCreateAtlas(TuiAtlasBuilder atlas_builder, TuiAtlas* atlas)
+{
+	assert(atlas_builder != NULL);
+	assert(atlas != NULL);
+	if (atlas_builder->PageCount == 0)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	return tuiAtlasCreateFromPixels(atlas, atlas_builder->PageWidth, atlas_builder->PageHeight, atlas_builder->PageCount, atlas_builder->ChannelCount, atlas_builder->PixelData, atlas_builder->StpqpCoordinates, atlas_builder->GlyphCount);
+}
\ No newline at end of file
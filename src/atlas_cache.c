@@ -0,0 +1,352 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/atlas_cache.h>
+#include <TUIC/atlas_builder.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Pixels start on a page boundary so the mapped pixels can be handed to the upload as they are.
+#define TUI_ATLAS_CACHE_PIXEL_ALIGNMENT 4096
+#define TUI_ATLAS_CACHE_COORDINATES_ALIGNMENT 16
+#define TUI_ATLAS_CACHE_BYTE_ORDER_MARK 0x01020304u
+
+static const char kAtlasCacheMagic[8] = { 'T', 'U', 'I', 'C', 'A', 'T', 'L', 'S' };
+
+typedef struct TuiAtlasCacheHeader
+{
+	char Magic[8];
+
+	uint32_t Version;
+
+	uint32_t ByteOrderMark;
+
+	uint64_t SourceHash;
+
+	int32_t Width;
+
+	int32_t Height;
+
+	int32_t Pages;
+
+	int32_t ChannelCount;
+
+	int32_t GlyphCount;
+
+	int32_t Reserved;
+
+	uint64_t PixelOffset;
+
+	uint64_t PixelSize;
+
+	uint64_t CoordinatesOffset;
+
+	uint64_t CoordinatesSize;
+} TuiAtlasCacheHeader;
+
+static inline uint64_t _tuiAtlasCacheMix(uint64_t value)
+{
+	value ^= value >> 33;
+	value *= 0xff51afd7ed558ccdull;
+	value ^= value >> 33;
+	value *= 0xc4ceb9fe1a85ec53ull;
+	value ^= value >> 33;
+	return value;
+}
+
+static inline uint64_t _tuiAtlasCacheAlign(const uint64_t offset, const uint64_t alignment)
+{
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+uint64_t tuiAtlasCacheHash(const void* data, size_t size, uint64_t seed)
+{
+	assert(data != NULL || size == 0);
+	const uint8_t* bytes = (const uint8_t*)data;
+	uint64_t hash = seed ^ ((uint64_t)size * 0x9e3779b97f4a7c15ull);
+	// Hash 8 bytes at a time, since the sources hashed are often whole image files.
+	size_t byte_i = 0;
+	for (; byte_i + 8 <= size; byte_i += 8)
+	{
+		uint64_t word;
+		memcpy(&word, &bytes[byte_i], 8);
+		hash = (hash ^ _tuiAtlasCacheMix(word)) * 0x9e3779b97f4a7c15ull;
+		hash ^= hash >> 31;
+	}
+	if (byte_i < size)
+	{
+		uint64_t word = 0;
+		memcpy(&word, &bytes[byte_i], size - byte_i);
+		hash = (hash ^ _tuiAtlasCacheMix(word)) * 0x9e3779b97f4a7c15ull;
+	}
+	return _tuiAtlasCacheMix(hash);
+}
+
+static TuiBoolean _tuiAtlasCacheWritePadding(FILE* file, uint64_t offset, const uint64_t padded_offset)
+{
+	static const uint8_t kZeros[64] = { 0 };
+	while (offset < padded_offset)
+	{
+		const size_t write_size = (padded_offset - offset < sizeof(kZeros)) ? (size_t)(padded_offset - offset) : sizeof(kZeros);
+		if (fwrite(kZeros, 1, write_size, file) != write_size)
+		{
+			return TUI_FALSE;
+		}
+		offset += write_size;
+	}
+	return TUI_TRUE;
+}
+
+TuiResult tuiAtlasCacheWrite(const char* path, uint64_t source_hash, int width, int height, int pages, int channel_count, const uint8_t* pixel_data, const float* stpqp_coordinates, int glyph_count)
+{
+	assert(path != NULL);
+	assert(pixel_data != NULL);
+	assert(stpqp_coordinates != NULL);
+	if (width < 1 || height < 1 || pages < 1 || glyph_count < 1 || channel_count < 1 || channel_count > 4)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	TuiAtlasCacheHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.Magic, kAtlasCacheMagic, sizeof(kAtlasCacheMagic));
+	header.Version = TUI_ATLAS_CACHE_VERSION;
+	header.ByteOrderMark = TUI_ATLAS_CACHE_BYTE_ORDER_MARK;
+	header.SourceHash = source_hash;
+	header.Width = width;
+	header.Height = height;
+	header.Pages = pages;
+	header.ChannelCount = channel_count;
+	header.GlyphCount = glyph_count;
+	header.PixelOffset = _tuiAtlasCacheAlign(sizeof(header), TUI_ATLAS_CACHE_PIXEL_ALIGNMENT);
+	header.PixelSize = (uint64_t)width * (uint64_t)height * (uint64_t)pages * (uint64_t)channel_count;
+	header.CoordinatesOffset = _tuiAtlasCacheAlign(header.PixelOffset + header.PixelSize, TUI_ATLAS_CACHE_COORDINATES_ALIGNMENT);
+	header.CoordinatesSize = (uint64_t)glyph_count * TUI_STPQP_COORDINATES_PER_GLYPH * sizeof(float);
+
+	FILE* file = fopen(path, "wb");
+	if (file == NULL)
+	{
+		return TUI_RESULT_ERROR_FILE_CREATION_FAILURE;
+	}
+	TuiBoolean written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		_tuiAtlasCacheWritePadding(file, sizeof(header), header.PixelOffset) &&
+		fwrite(pixel_data, 1, (size_t)header.PixelSize, file) == (size_t)header.PixelSize &&
+		_tuiAtlasCacheWritePadding(file, header.PixelOffset + header.PixelSize, header.CoordinatesOffset) &&
+		fwrite(stpqp_coordinates, 1, (size_t)header.CoordinatesSize, file) == (size_t)header.CoordinatesSize;
+	if (fclose(file) != 0)
+	{
+		written = TUI_FALSE;
+	}
+	if (!written)
+	{
+		// Never leave a partial file behind that a later open could mistake for a complete one.
+		remove(path);
+		return TUI_RESULT_ERROR_FILE_WRITE_FAILURE;
+	}
+	return TUI_RESULT_OK;
+}
+
+static void _tuiAtlasCacheUnmap(TuiAtlasCache atlas_cache)
+{
+#ifdef _WIN32
+	UnmapViewOfFile((LPCVOID)atlas_cache->MappedData);
+	CloseHandle((HANDLE)atlas_cache->MappingHandle);
+#else
+	munmap((void*)atlas_cache->MappedData, atlas_cache->MappedSize);
+#endif
+}
+
+static TuiResult _tuiAtlasCacheMap(TuiAtlasCache atlas_cache, const char* path)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return TUI_RESULT_ERROR_FILE_NOT_FOUND;
+	}
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < (LONGLONG)sizeof(TuiAtlasCacheHeader))
+	{
+		CloseHandle(file);
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	// The mapping keeps the file open, so the file handle is not needed once the mapping exists.
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL)
+	{
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	const void* mapped_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (mapped_data == NULL)
+	{
+		CloseHandle(mapping);
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	atlas_cache->MappedData = (const uint8_t*)mapped_data;
+	atlas_cache->MappedSize = (size_t)file_size.QuadPart;
+	atlas_cache->MappingHandle = mapping;
+#else
+	const int file = open(path, O_RDONLY);
+	if (file < 0)
+	{
+		return TUI_RESULT_ERROR_FILE_NOT_FOUND;
+	}
+	struct stat file_status;
+	if (fstat(file, &file_status) != 0 || file_status.st_size < (off_t)sizeof(TuiAtlasCacheHeader))
+	{
+		close(file);
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	void* mapped_data = mmap(NULL, (size_t)file_status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (mapped_data == MAP_FAILED)
+	{
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	atlas_cache->MappedData = (const uint8_t*)mapped_data;
+	atlas_cache->MappedSize = (size_t)file_status.st_size;
+	atlas_cache->MappingHandle = NULL;
+#endif
+	return TUI_RESULT_OK;
+}
+
+TuiResult tuiAtlasCacheOpen(TuiAtlasCache* atlas_cache, const char* path, uint64_t source_hash)
+{
+	assert(atlas_cache != NULL);
+	assert(path != NULL);
+	*atlas_cache = (TuiAtlasCache)tuiAllocate(sizeof(TuiAtlasCache_s));
+	if (*atlas_cache == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*atlas_cache, 0, sizeof(TuiAtlasCache_s));
+	TuiAtlasCache cache = *atlas_cache;
+	TuiResult result = _tuiAtlasCacheMap(cache, path);
+	if (result != TUI_RESULT_OK)
+	{
+		tuiFree(cache);
+		*atlas_cache = NULL;
+		return result;
+	}
+
+	// Only the header is read here, so the pages are not paged in until they are uploaded.
+	TuiAtlasCacheHeader header;
+	memcpy(&header, cache->MappedData, sizeof(header));
+	const uint64_t pixel_size = (uint64_t)header.Width * (uint64_t)header.Height * (uint64_t)header.Pages * (uint64_t)header.ChannelCount;
+	const uint64_t coordinates_size = (uint64_t)header.GlyphCount * TUI_STPQP_COORDINATES_PER_GLYPH * sizeof(float);
+	if (memcmp(header.Magic, kAtlasCacheMagic, sizeof(kAtlasCacheMagic)) != 0 ||
+		header.Version != TUI_ATLAS_CACHE_VERSION ||
+		header.ByteOrderMark != TUI_ATLAS_CACHE_BYTE_ORDER_MARK ||
+		header.SourceHash != source_hash ||
+		header.Width < 1 || header.Height < 1 || header.Pages < 1 || header.GlyphCount < 1 ||
+		header.ChannelCount < 1 || header.ChannelCount > 4 ||
+		header.PixelSize != pixel_size || header.CoordinatesSize != coordinates_size ||
+		header.PixelOffset % TUI_ATLAS_CACHE_PIXEL_ALIGNMENT != 0 || header.CoordinatesOffset % TUI_ATLAS_CACHE_COORDINATES_ALIGNMENT != 0 ||
+		header.PixelOffset < sizeof(header) || header.PixelOffset + pixel_size > header.CoordinatesOffset ||
+		header.CoordinatesOffset + coordinates_size > (uint64_t)cache->MappedSize)
+	{
+		_tuiAtlasCacheUnmap(cache);
+		tuiFree(cache);
+		*atlas_cache = NULL;
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	cache->Width = header.Width;
+	cache->Height = header.Height;
+	cache->Pages = header.Pages;
+	cache->ChannelCount = header.ChannelCount;
+	cache->GlyphCount = header.GlyphCount;
+	cache->PixelData = &cache->MappedData[header.PixelOffset];
+	cache->StpqpCoordinates = (const float*)&cache->MappedData[header.CoordinatesOffset];
+	return TUI_RESULT_OK;
+}
+
+TuiResult tuiAtlasCacheOpenOrBuild(TuiAtlasCache* atlas_cache, const char* path, uint64_t source_hash, tuiAtlasCacheBuildFunction build_function, void* user_data)
+{
+	assert(atlas_cache != NULL);
+	assert(build_function != NULL);
+	TuiResult result = tuiAtlasCacheOpen(atlas_cache, path, source_hash);
+	if (result != TUI_RESULT_ERROR_FILE_NOT_FOUND && result != TUI_RESULT_ERROR_FILE_READ_FAILURE)
+	{
+		return result;
+	}
+	result = build_function(user_data, path, source_hash);
+	if (result != TUI_RESULT_OK)
+	{
+		return result;
+	}
+	return tuiAtlasCacheOpen(atlas_cache, path, source_hash);
+}
+
+void tuiAtlasCacheClose(TuiAtlasCache atlas_cache)
+{
+	assert(atlas_cache != NULL);
+	_tuiAtlasCacheUnmap(atlas_cache);
+	tuiFree(atlas_cache);
+}
+
+void tuiAtlasCacheGetDimensions(TuiAtlasCache atlas_cache, int* width, int* height, int* pages, int* channel_count)
+{
+	assert(atlas_cache != NULL);
+	if (width != NULL)
+	{
+		*width = atlas_cache->Width;
+	}
+	if (height != NULL)
+	{
+		*height = atlas_cache->Height;
+	}
+	if (pages != NULL)
+	{
+		*pages = atlas_cache->Pages;
+	}
+	if (channel_count != NULL)
+	{
+		*channel_count = atlas_cache->ChannelCount;
+	}
+}
+
+int tuiAtlasCacheGetGlyphCount(TuiAtlasCache atlas_cache)
+{
+	assert(atlas_cache != NULL);
+	return atlas_cache->GlyphCount;
+}
+
+const uint8_t* tuiAtlasCacheGetPixelData(TuiAtlasCache atlas_cache)
+{
+	assert(atlas_cache != NULL);
+	return atlas_cache->PixelData;
+}
+
+const float* tuiAtlasCacheGetStpqpCoordinates(TuiAtlasCache atlas_cache)
+{
+	assert(atlas_cache != NULL);
+	return atlas_cache->StpqpCoordinates;
+}
\ No newline at end of file
@@ -0,0 +1,603 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/bitmap_font.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "math_inline.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// The largest glyph width and height a bitmap font can have.
+#define TUI_BITMAP_FONT_MAX_GLYPH_SIZE 1024
+// The longest BDF line that is read. Longer lines are only ever comments or properties, so they are cut.
+#define TUI_BDF_MAX_LINE_LENGTH 256
+
+static inline uint32_t _tuiReadLittleEndian32(const uint8_t* bytes)
+{
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+// Allocate a font with zeroed glyph bits and room for the given amount of codepoint mappings, which are packed as the codepoint above the glyph in 64 bits until they are sorted.
+static TuiResult _tuiBitmapFontAllocate(TuiBitmapFont* font, const int glyph_width, const int glyph_height, const int glyph_count, const size_t mapping_capacity, uint64_t** mappings)
+{
+	*font = (TuiBitmapFont)tuiAllocate(sizeof(TuiBitmapFont_s));
+	if (*font == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*font, 0, sizeof(TuiBitmapFont_s));
+	(*font)->GlyphWidth = glyph_width;
+	(*font)->GlyphHeight = glyph_height;
+	(*font)->GlyphCount = glyph_count;
+	(*font)->RowSize = (glyph_width + 7) / 8;
+	const size_t bits_size = (size_t)(*font)->RowSize * (size_t)glyph_height * (size_t)glyph_count;
+	(*font)->GlyphBits = (uint8_t*)tuiAllocate(bits_size);
+	*mappings = (uint64_t*)tuiAllocate(MAX(mapping_capacity, 1) * sizeof(uint64_t));
+	if ((*font)->GlyphBits == NULL || *mappings == NULL)
+	{
+		if (*mappings != NULL)
+		{
+			tuiFree(*mappings);
+		}
+		tuiBitmapFontDestroy(*font);
+		*font = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset((*font)->GlyphBits, 0, bits_size);
+	return TUI_RESULT_OK;
+}
+
+static int _tuiCompareMappings(const void* a, const void* b)
+{
+	const uint64_t mapping_a = *(const uint64_t*)a;
+	const uint64_t mapping_b = *(const uint64_t*)b;
+	return (mapping_a > mapping_b) - (mapping_a < mapping_b);
+}
+
+// Sort the packed mappings by codepoint and unpack them, keeping the lowest glyph of a codepoint that is mapped more than once. The packed mappings are freed, and the font is destroyed if it fails.
+static TuiResult _tuiBitmapFontFinishMappings(TuiBitmapFont* font, uint64_t* mappings, const size_t mapping_count)
+{
+	qsort(mappings, mapping_count, sizeof(uint64_t), _tuiCompareMappings);
+	size_t unique_count = 0;
+	for (size_t mapping_i = 0; mapping_i < mapping_count; mapping_i++)
+	{
+		if (unique_count == 0 || (mappings[mapping_i] >> 32) != (mappings[unique_count - 1] >> 32))
+		{
+			mappings[unique_count++] = mappings[mapping_i];
+		}
+	}
+	// The codepoints and glyphs share one allocation.
+	TuiBitmapFont bitmap_font = *font;
+	bitmap_font->MappedCodepoints = (uint32_t*)tuiAllocate(MAX(unique_count, 1) * (sizeof(uint32_t) + sizeof(int)));
+	if (bitmap_font->MappedCodepoints == NULL)
+	{
+		tuiFree(mappings);
+		tuiBitmapFontDestroy(bitmap_font);
+		*font = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	bitmap_font->MappedGlyphs = (int*)(bitmap_font->MappedCodepoints + MAX(unique_count, 1));
+	for (size_t mapping_i = 0; mapping_i < unique_count; mapping_i++)
+	{
+		bitmap_font->MappedCodepoints[mapping_i] = (uint32_t)(mappings[mapping_i] >> 32);
+		bitmap_font->MappedGlyphs[mapping_i] = (int)(mappings[mapping_i] & 0xFFFFFFFFu);
+	}
+	bitmap_font->MappingCount = (int)unique_count;
+	tuiFree(mappings);
+	return TUI_RESULT_OK;
+}
+
+// Decode one UTF-8 codepoint of a PSF2 Unicode table, and return the amount of bytes it used, or 0 if it is not valid UTF-8.
+static size_t _tuiDecodeUtf8(const uint8_t* bytes, const size_t size, uint32_t* codepoint)
+{
+	const uint8_t lead = bytes[0];
+	size_t length = (lead < 0x80) ? 1 : ((lead & 0xE0) == 0xC0) ? 2 : ((lead & 0xF0) == 0xE0) ? 3 : ((lead & 0xF8) == 0xF0) ? 4 : 0;
+	if (length == 0 || length > size)
+	{
+		return 0;
+	}
+	*codepoint = (length == 1) ? lead : (lead & (0x7F >> length));
+	for (size_t byte_i = 1; byte_i < length; byte_i++)
+	{
+		if ((bytes[byte_i] & 0xC0) != 0x80)
+		{
+			return 0;
+		}
+		*codepoint = (*codepoint << 6) | (bytes[byte_i] & 0x3F);
+	}
+	return length;
+}
+
+TuiResult tuiBitmapFontCreatePsf(TuiBitmapFont* font, const uint8_t* data, size_t size)
+{
+	assert(font != NULL);
+	if (data == NULL)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	int glyph_width, glyph_height, glyph_count;
+	size_t glyph_offset;
+	TuiBoolean has_table;
+	const TuiBoolean is_psf1 = size >= 4 && data[0] == 0x36 && data[1] == 0x04;
+	if (is_psf1)
+	{
+		// Mode bit 0 doubles the glyphs to 512, and bits 1 and 2 mean a Unicode table follows them.
+		glyph_width = 8;
+		glyph_height = data[3];
+		glyph_count = (data[2] & 0x01) ? 512 : 256;
+		glyph_offset = 4;
+		has_table = (data[2] & 0x06) != 0;
+	}
+	else if (size >= 32 && data[0] == 0x72 && data[1] == 0xB5 && data[2] == 0x4A && data[3] == 0x86)
+	{
+		const uint32_t header_size = _tuiReadLittleEndian32(&data[8]);
+		const uint32_t length = _tuiReadLittleEndian32(&data[16]);
+		const uint32_t glyph_size = _tuiReadLittleEndian32(&data[20]);
+		const uint32_t height = _tuiReadLittleEndian32(&data[24]);
+		const uint32_t width = _tuiReadLittleEndian32(&data[28]);
+		if (header_size < 32 || width < 1 || width > TUI_BITMAP_FONT_MAX_GLYPH_SIZE || height > TUI_BITMAP_FONT_MAX_GLYPH_SIZE || length < 1 || length > 0x7FFFFFFF || glyph_size != ((width + 7) / 8) * height)
+		{
+			return TUI_RESULT_ERROR_INVALID_VALUE;
+		}
+		glyph_width = (int)width;
+		glyph_height = (int)height;
+		glyph_count = (int)length;
+		glyph_offset = header_size;
+		has_table = (_tuiReadLittleEndian32(&data[12]) & 0x01) != 0;
+	}
+	else
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	const uint64_t bits_size = (uint64_t)((glyph_width + 7) / 8) * (uint64_t)glyph_height * (uint64_t)glyph_count;
+	if (glyph_height < 1 || glyph_offset > size || bits_size > (uint64_t)(size - glyph_offset))
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	const size_t table_offset = glyph_offset + (size_t)bits_size;
+	const size_t table_size = has_table ? size - table_offset : 0;
+	uint64_t* mappings = NULL;
+	TuiResult result = _tuiBitmapFontAllocate(font, glyph_width, glyph_height, glyph_count, has_table ? table_size : (size_t)glyph_count, &mappings);
+	if (result != TUI_RESULT_OK)
+	{
+		return result;
+	}
+	// PSF glyphs are already rows of bytes with the leftmost pixel in the highest bit, which is the layout of the font.
+	memcpy((*font)->GlyphBits, &data[glyph_offset], (size_t)bits_size);
+
+	size_t mapping_count = 0;
+	if (!has_table)
+	{
+		for (int glyph_i = 0; glyph_i < glyph_count; glyph_i++)
+		{
+			mappings[mapping_count++] = ((uint64_t)glyph_i << 32) | (uint64_t)glyph_i;
+		}
+	}
+	else
+	{
+		// Every glyph has a list of codepoints ended by a terminator, where sequences of codepoints that combine into the glyph follow a sequence start and are skipped.
+		const uint8_t* table = &data[table_offset];
+		size_t byte_i = 0;
+		for (int glyph_i = 0; glyph_i < glyph_count && byte_i < table_size; glyph_i++)
+		{
+			TuiBoolean in_sequence = TUI_FALSE;
+			while (byte_i < table_size)
+			{
+				uint32_t codepoint;
+				if (is_psf1)
+				{
+					if (byte_i + 2 > table_size)
+					{
+						byte_i = table_size;
+						break;
+					}
+					codepoint = (uint32_t)table[byte_i] | ((uint32_t)table[byte_i + 1] << 8);
+					byte_i += 2;
+					if (codepoint == 0xFFFF)
+					{
+						break;
+					}
+					if (codepoint == 0xFFFE)
+					{
+						in_sequence = TUI_TRUE;
+						continue;
+					}
+				}
+				else
+				{
+					if (table[byte_i] == 0xFF)
+					{
+						byte_i++;
+						break;
+					}
+					if (table[byte_i] == 0xFE)
+					{
+						in_sequence = TUI_TRUE;
+						byte_i++;
+						continue;
+					}
+					const size_t length = _tuiDecodeUtf8(&table[byte_i], table_size - byte_i, &codepoint);
+					if (length == 0)
+					{
+						byte_i++;
+						continue;
+					}
+					byte_i += length;
+				}
+				if (!in_sequence)
+				{
+					mappings[mapping_count++] = ((uint64_t)codepoint << 32) | (uint64_t)glyph_i;
+				}
+			}
+		}
+	}
+	return _tuiBitmapFontFinishMappings(font, mappings, mapping_count);
+}
+
+// Copy the next line of BDF text into line, cut to the line buffer, and advance the cursor past it. Returns false at the end of the text.
+static TuiBoolean _tuiBdfReadLine(const char** cursor, const char* end, char* line)
+{
+	if (*cursor >= end)
+	{
+		return TUI_FALSE;
+	}
+	size_t length = 0;
+	while (*cursor < end && **cursor != '\n')
+	{
+		if (**cursor != '\r' && length < TUI_BDF_MAX_LINE_LENGTH - 1)
+		{
+			line[length++] = **cursor;
+		}
+		(*cursor)++;
+	}
+	if (*cursor < end)
+	{
+		(*cursor)++;
+	}
+	line[length] = '\0';
+	return TUI_TRUE;
+}
+
+// Check if a BDF line starts with a keyword, and return the text after it.
+static const char* _tuiBdfKeyword(const char* line, const char* keyword)
+{
+	const size_t length = strlen(keyword);
+	if (strncmp(line, keyword, length) != 0 || (line[length] != '\0' && line[length] != ' ' && line[length] != '\t'))
+	{
+		return NULL;
+	}
+	return &line[length];
+}
+
+static inline int _tuiHexValue(const char character)
+{
+	if (character >= '0' && character <= '9')
+	{
+		return character - '0';
+	}
+	if (character >= 'A' && character <= 'F')
+	{
+		return character - 'A' + 10;
+	}
+	if (character >= 'a' && character <= 'f')
+	{
+		return character - 'a' + 10;
+	}
+	return -1;
+}
+
+TuiResult tuiBitmapFontCreateBdf(TuiBitmapFont* font, const char* text, size_t size)
+{
+	assert(font != NULL);
+	if (text == NULL)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	const char* cursor = text;
+	const char* end = text + size;
+	char line[TUI_BDF_MAX_LINE_LENGTH];
+	if (!_tuiBdfReadLine(&cursor, end, line) || _tuiBdfKeyword(line, "STARTFONT") == NULL)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	// The font bounding box is the cell of every glyph, with its bottom left corner at the given offset from the origin of the glyphs.
+	int font_width = 0, font_height = 0, font_x = 0, font_y = 0;
+	int glyph_capacity = 0;
+	const char* arguments;
+	while (glyph_capacity == 0 && _tuiBdfReadLine(&cursor, end, line))
+	{
+		if ((arguments = _tuiBdfKeyword(line, "FONTBOUNDINGBOX")) != NULL)
+		{
+			if (sscanf(arguments, "%d %d %d %d", &font_width, &font_height, &font_x, &font_y) != 4)
+			{
+				return TUI_RESULT_ERROR_INVALID_VALUE;
+			}
+		}
+		else if ((arguments = _tuiBdfKeyword(line, "CHARS")) != NULL)
+		{
+			if (sscanf(arguments, "%d", &glyph_capacity) != 1 || glyph_capacity < 1)
+			{
+				return TUI_RESULT_ERROR_INVALID_VALUE;
+			}
+		}
+	}
+	if (glyph_capacity < 1 || font_width < 1 || font_height < 1 || font_width > TUI_BITMAP_FONT_MAX_GLYPH_SIZE || font_height > TUI_BITMAP_FONT_MAX_GLYPH_SIZE || (size_t)glyph_capacity > size)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	uint64_t* mappings = NULL;
+	TuiResult result = _tuiBitmapFontAllocate(font, font_width, font_height, glyph_capacity, (size_t)glyph_capacity, &mappings);
+	if (result != TUI_RESULT_OK)
+	{
+		return result;
+	}
+	TuiBitmapFont bitmap_font = *font;
+	size_t mapping_count = 0;
+	int glyph_count = 0;
+	long encoding = -1;
+	int box_width = font_width, box_height = font_height, box_x = font_x, box_y = font_y;
+	while (glyph_count < glyph_capacity && result == TUI_RESULT_OK && _tuiBdfReadLine(&cursor, end, line))
+	{
+		if (_tuiBdfKeyword(line, "STARTCHAR") != NULL)
+		{
+			encoding = -1;
+			box_width = font_width;
+			box_height = font_height;
+			box_x = font_x;
+			box_y = font_y;
+		}
+		else if ((arguments = _tuiBdfKeyword(line, "ENCODING")) != NULL)
+		{
+			encoding = strtol(arguments, NULL, 10);
+		}
+		else if ((arguments = _tuiBdfKeyword(line, "BBX")) != NULL)
+		{
+			if (sscanf(arguments, "%d %d %d %d", &box_width, &box_height, &box_x, &box_y) != 4 || box_width < 0 || box_height < 0)
+			{
+				result = TUI_RESULT_ERROR_INVALID_VALUE;
+			}
+		}
+		else if (_tuiBdfKeyword(line, "BITMAP") != NULL)
+		{
+			// Rows are hex with the leftmost pixel in the highest bit, and are placed in the cell by how far the glyph box is from the font box.
+			uint8_t* glyph_bits = &bitmap_font->GlyphBits[(size_t)glyph_count * (size_t)bitmap_font->RowSize * (size_t)font_height];
+			const int left = box_x - font_x;
+			const int top = (font_height + font_y) - (box_y + box_height);
+			for (int row_i = 0; row_i < box_height && result == TUI_RESULT_OK; row_i++)
+			{
+				if (!_tuiBdfReadLine(&cursor, end, line))
+				{
+					result = TUI_RESULT_ERROR_INVALID_VALUE;
+					break;
+				}
+				const int y = top + row_i;
+				for (int digit_i = 0; line[digit_i] != '\0' && digit_i * 4 < box_width && y >= 0 && y < font_height; digit_i++)
+				{
+					const int digit = _tuiHexValue(line[digit_i]);
+					for (int bit_i = 0; bit_i < 4 && digit > 0; bit_i++)
+					{
+						const int x = left + digit_i * 4 + bit_i;
+						if ((digit & (8 >> bit_i)) && digit_i * 4 + bit_i < box_width && x >= 0 && x < font_width)
+						{
+							glyph_bits[(size_t)y * (size_t)bitmap_font->RowSize + (size_t)(x / 8)] |= (uint8_t)(0x80 >> (x % 8));
+						}
+					}
+				}
+			}
+		}
+		else if (_tuiBdfKeyword(line, "ENDCHAR") != NULL)
+		{
+			if (encoding >= 0 && encoding <= 0x10FFFF)
+			{
+				mappings[mapping_count++] = ((uint64_t)encoding << 32) | (uint64_t)glyph_count;
+			}
+			glyph_count++;
+		}
+	}
+	if (result == TUI_RESULT_OK && glyph_count == 0)
+	{
+		result = TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	if (result != TUI_RESULT_OK)
+	{
+		tuiFree(mappings);
+		tuiBitmapFontDestroy(bitmap_font);
+		*font = NULL;
+		return result;
+	}
+	bitmap_font->GlyphCount = glyph_count;
+	return _tuiBitmapFontFinishMappings(font, mappings, mapping_count);
+}
+
+TuiResult tuiBitmapFontLoad(TuiBitmapFont* font, const char* path)
+{
+	assert(font != NULL);
+	assert(path != NULL);
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		return TUI_RESULT_ERROR_FILE_NOT_FOUND;
+	}
+	long size = -1;
+	if (fseek(file, 0, SEEK_END) == 0)
+	{
+		size = ftell(file);
+	}
+	if (size <= 0 || fseek(file, 0, SEEK_SET) != 0)
+	{
+		fclose(file);
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	uint8_t* data = (uint8_t*)tuiAllocate((size_t)size);
+	if (data == NULL)
+	{
+		fclose(file);
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	const size_t read_size = fread(data, 1, (size_t)size, file);
+	fclose(file);
+	if (read_size != (size_t)size)
+	{
+		tuiFree(data);
+		return TUI_RESULT_ERROR_FILE_READ_FAILURE;
+	}
+	// PSF fonts start with a binary magic number, so anything else is parsed as BDF text.
+	const TuiBoolean is_psf = (read_size >= 2 && data[0] == 0x36 && data[1] == 0x04) || (read_size >= 4 && data[0] == 0x72 && data[1] == 0xB5 && data[2] == 0x4A && data[3] == 0x86);
+	TuiResult result = is_psf ? tuiBitmapFontCreatePsf(font, data, read_size) : tuiBitmapFontCreateBdf(font, (const char*)data, read_size);
+	tuiFree(data);
+	return result;
+}
+
+void tuiBitmapFontDestroy(TuiBitmapFont font)
+{
+	assert(font != NULL);
+	if (font->GlyphBits != NULL)
+	{
+		tuiFree(font->GlyphBits);
+	}
+	if (font->MappedCodepoints != NULL)
+	{
+		tuiFree(font->MappedCodepoints);
+	}
+	tuiFree(font);
+}
+
+void tuiBitmapFontGetDimensions(TuiBitmapFont font, int* glyph_width, int* glyph_height, int* glyph_count)
+{
+	assert(font != NULL);
+	if (glyph_width != NULL)
+	{
+		*glyph_width = font->GlyphWidth;
+	}
+	if (glyph_height != NULL)
+	{
+		*glyph_height = font->GlyphHeight;
+	}
+	if (glyph_count != NULL)
+	{
+		*glyph_count = font->GlyphCount;
+	}
+}
+
+int tuiBitmapFontGetGlyph(TuiBitmapFont font, uint32_t codepoint)
+{
+	assert(font != NULL);
+	int low = 0;
+	int high = font->MappingCount;
+	while (low < high)
+	{
+		const int middle = low + (high - low) / 2;
+		if (font->MappedCodepoints[middle] < codepoint)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return (low < font->MappingCount && font->MappedCodepoints[low] == codepoint) ? font->MappedGlyphs[low] : -1;
+}
+
+int tuiBitmapFontGetMappings(TuiBitmapFont font, const uint32_t** codepoints, const int** glyphs)
+{
+	assert(font != NULL);
+	assert(codepoints != NULL && glyphs != NULL);
+	*codepoints = font->MappedCodepoints;
+	*glyphs = font->MappedGlyphs;
+	return font->MappingCount;
+}
+
+// Expand the 8 pixels of a byte of glyph bits, highest bit first, to 8 bytes of 0 or 255. The byte is copied into every lane of a 64 bit word, each lane keeps its own bit, and adding 0x7F carries any set bit into the top of its lane, so there is no branch per pixel.
+static inline void _tuiBitmapFontExpandByte(const uint8_t bits, uint8_t* coverage)
+{
+	uint64_t lanes = ((uint64_t)bits * 0x0101010101010101ull) & 0x0102040810204080ull;
+	lanes = (((lanes + 0x7F7F7F7F7F7F7F7Full) & 0x8080808080808080ull) >> 7) * 0xFFu;
+	for (int lane_i = 0; lane_i < 8; lane_i++)
+	{
+		coverage[lane_i] = (uint8_t)(lanes >> (lane_i * 8));
+	}
+}
+
+void tuiBitmapFontExpandGlyphs(TuiBitmapFont font, int columns, int channel_count, uint8_t* pixels)
+{
+	assert(font != NULL);
+	assert(pixels != NULL);
+	assert(columns >= 1);
+	assert(channel_count >= 1 && channel_count <= 4);
+	const int glyph_width = font->GlyphWidth;
+	const int glyph_height = font->GlyphHeight;
+	const int rows = (font->GlyphCount + columns - 1) / columns;
+	const size_t page_row_size = (size_t)columns * (size_t)glyph_width * (size_t)channel_count;
+	// Rows are expanded a whole byte further than the glyph width, so the last byte of bits never needs a partial store.
+	uint8_t coverage[TUI_BITMAP_FONT_MAX_GLYPH_SIZE + 8];
+	for (int cell_i = 0; cell_i < columns * rows; cell_i++)
+	{
+		uint8_t* cell_pixels = &pixels[(size_t)(cell_i / columns) * (size_t)glyph_height * page_row_size + (size_t)(cell_i % columns) * (size_t)glyph_width * (size_t)channel_count];
+		for (int y = 0; y < glyph_height; y++)
+		{
+			uint8_t* row_pixels = &cell_pixels[(size_t)y * page_row_size];
+			if (cell_i >= font->GlyphCount)
+			{
+				memset(row_pixels, 0, (size_t)glyph_width * (size_t)channel_count);
+				continue;
+			}
+			const uint8_t* row_bits = &font->GlyphBits[((size_t)cell_i * (size_t)glyph_height + (size_t)y) * (size_t)font->RowSize];
+			for (int byte_i = 0; byte_i < font->RowSize; byte_i++)
+			{
+				_tuiBitmapFontExpandByte(row_bits[byte_i], &coverage[byte_i * 8]);
+			}
+			switch (channel_count)
+			{
+			case 1:
+				memcpy(row_pixels, coverage, (size_t)glyph_width);
+				break;
+			case 2:
+				for (int x = 0; x < glyph_width; x++)
+				{
+					row_pixels[x * 2 + 0] = coverage[x];
+					row_pixels[x * 2 + 1] = coverage[x];
+				}
+				break;
+			case 3:
+				for (int x = 0; x < glyph_width; x++)
+				{
+					row_pixels[x * 3 + 0] = coverage[x];
+					row_pixels[x * 3 + 1] = coverage[x];
+					row_pixels[x * 3 + 2] = coverage[x];
+				}
+				break;
+			default:
+				for (int x = 0; x < glyph_width; x++)
+				{
+					row_pixels[x * 4 + 0] = coverage[x];
+					row_pixels[x * 4 + 1] = coverage[x];
+					row_pixels[x * 4 + 2] = coverage[x];
+					row_pixels[x * 4 + 3] = coverage[x];
+				}
+				break;
+			}
+		}
+	}
+}
\ No newline at end of file
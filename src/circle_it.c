@@ -49,13 +49,7 @@ void tuiCircleItStepForward(TuiCircleIt* const it)
 	assert(it != NULL);
 	if (it->cur_x_position == it->row_right_x)
 	{
-		it->cur_y_position++;
-		if (it->cur_y_position > it->bottom_y) return;
-		const float row_y_distance = (float)(it->cur_y_position - it->center_y);
-		const float row_x_distance = sqrtf(it->radius * it->radius - row_y_distance * row_y_distance); // pythagorean theorem
-		it->row_left_x = it->center_x - (int)ceilf(row_x_distance);
-		it->row_right_x = it->center_x + (int)floorf(row_x_distance);
-		it->cur_x_position = it->row_left_x;
+		tuiCircleItStepSpan(it);
 	}
 	else
 	{
@@ -63,6 +57,18 @@ void tuiCircleItStepForward(TuiCircleIt* const it)
 	}
 }
 
+void tuiCircleItStepSpan(TuiCircleIt* const it)
+{
+	assert(it != NULL);
+	it->cur_y_position++;
+	if (it->cur_y_position > it->bottom_y) return;
+	const float row_y_distance = (float)(it->cur_y_position - it->center_y);
+	const float row_x_distance = sqrtf(it->radius * it->radius - row_y_distance * row_y_distance); // pythagorean theorem
+	it->row_left_x = it->center_x - (int)ceilf(row_x_distance);
+	it->row_right_x = it->center_x + (int)floorf(row_x_distance);
+	it->cur_x_position = it->row_left_x;
+}
+
 void tuiCircleItSetStart(TuiCircleIt* const it)
 {
 	assert(it != NULL);
@@ -87,5 +93,11 @@ TuiPoint2 tuiCircleItGetPoint2(const TuiCircleIt it)
 	return ret;
 }
 
+TuiSpan tuiCircleItGetSpan(const TuiCircleIt it)
+{
+	TuiSpan ret = { it.cur_y_position, it.cur_x_position, it.row_right_x };
+	return ret;
+}
+
 
 
@@ -0,0 +1,100 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/composite_shape.h>
+#include <TUIC/shape.h>
+#include "grid_shapes_inline.h"
+#include "math_inline.h"
+
+
+TuiCompositeShape tuiCompositeShape(const TuiShape* const shapes, const TuiShapeOperation* const operations, const int shape_count)
+{
+	TuiCompositeShape ret = { shapes, operations, shape_count };
+	return ret;
+}
+
+// Get the first and last row a composite shape can cover by folding the row range of each shape with its operation.
+static inline void _tuiCompositeShapeGetRowRange(const TuiCompositeShape composite_shape, int* const top_y, int* const bottom_y)
+{
+	if (tuiCompositeShapeIsDegenerate(composite_shape))
+	{
+		*top_y = 0;
+		*bottom_y = -1;
+		return;
+	}
+	*top_y = tuiShapeGetTopY(composite_shape.shapes[0]);
+	*bottom_y = tuiShapeGetBottomY(composite_shape.shapes[0]);
+	for (int shape_i = 1; shape_i < composite_shape.shape_count; shape_i++)
+	{
+		const int shape_top_y = tuiShapeGetTopY(composite_shape.shapes[shape_i]);
+		const int shape_bottom_y = tuiShapeGetBottomY(composite_shape.shapes[shape_i]);
+		if (shape_top_y > shape_bottom_y) continue;
+		switch (composite_shape.operations[shape_i - 1])
+		{
+		case TUI_SHAPE_OPERATION_UNION:
+		case TUI_SHAPE_OPERATION_XOR:
+			if (*top_y > *bottom_y)
+			{
+				*top_y = shape_top_y;
+				*bottom_y = shape_bottom_y;
+				break;
+			}
+			*top_y = MIN(*top_y, shape_top_y);
+			*bottom_y = MAX(*bottom_y, shape_bottom_y);
+			break;
+		case TUI_SHAPE_OPERATION_INTERSECTION:
+			*top_y = MAX(*top_y, shape_top_y);
+			*bottom_y = MIN(*bottom_y, shape_bottom_y);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+int tuiCompositeShapeGetTopY(const TuiCompositeShape composite_shape)
+{
+	int top_y, bottom_y;
+	_tuiCompositeShapeGetRowRange(composite_shape, &top_y, &bottom_y);
+	return top_y;
+}
+
+int tuiCompositeShapeGetBottomY(const TuiCompositeShape composite_shape)
+{
+	int top_y, bottom_y;
+	_tuiCompositeShapeGetRowRange(composite_shape, &top_y, &bottom_y);
+	return bottom_y;
+}
+
+TuiBoolean tuiCompositeShapeIsDegenerate(const TuiCompositeShape composite_shape)
+{
+	return (composite_shape.shapes == TUI_NULL || composite_shape.shape_count <= 0 || (composite_shape.shape_count > 1 && composite_shape.operations == TUI_NULL));
+}
+
+TuiBoolean tuiCompositeShapeContainsPoint2(const TuiCompositeShape composite_shape, const TuiPoint2 point2)
+{
+	if (tuiCompositeShapeIsDegenerate(composite_shape)) return TUI_FALSE;
+	int span_xs[TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS * 2];
+	const int span_count = _tuiCompositeShapeGetRowSpans(composite_shape.shapes, composite_shape.operations, composite_shape.shape_count, point2.y, span_xs);
+	for (int span_i = 0; span_i < span_count; span_i++)
+	{
+		if (span_xs[span_i * 2] <= point2.x && point2.x <= span_xs[span_i * 2 + 1]) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
\ No newline at end of file
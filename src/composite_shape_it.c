@@ -0,0 +1,106 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/composite_shape_it.h>
+#include <TUIC/composite_shape.h>
+#include "grid_shapes_inline.h"
+#include "math_inline.h"
+
+#include <assert.h>
+
+
+// Load the spans of the first row at or below row_y that has any tiles.
+static inline void _tuiCompositeShapeItLoadRow(TuiCompositeShapeIt* const it, int row_y)
+{
+	it->row_span_count = 0;
+	while (row_y <= it->bottom_y)
+	{
+		it->row_span_count = _tuiCompositeShapeGetRowSpans(it->shapes, it->operations, it->shape_count, row_y, it->row_span_xs);
+		if (it->row_span_count > 0) break;
+		row_y++;
+	}
+	it->cur_y_position = row_y;
+	it->row_span_index = 0;
+	it->cur_x_position = (it->row_span_count > 0) ? it->row_span_xs[0] : 0;
+}
+
+TuiCompositeShapeIt tuiCompositeShapeIt(const TuiCompositeShape composite_shape)
+{
+	const int top_y = tuiCompositeShapeGetTopY(composite_shape);
+	const int bottom_y = tuiCompositeShapeGetBottomY(composite_shape);
+	TuiCompositeShapeIt ret = { composite_shape.shapes, composite_shape.operations, composite_shape.shape_count, top_y, bottom_y, 0, 0, { 0 }, 0, top_y };
+	_tuiCompositeShapeItLoadRow(&ret, top_y);
+	return ret;
+}
+
+TuiBoolean tuiCompositeShapeItDone(const TuiCompositeShapeIt it)
+{
+	return (it.cur_y_position > it.bottom_y);
+}
+
+void tuiCompositeShapeItStepForward(TuiCompositeShapeIt* const it)
+{
+	assert(it != NULL);
+	if (it->cur_x_position == it->row_span_xs[it->row_span_index * 2 + 1])
+	{
+		tuiCompositeShapeItStepSpan(it);
+	}
+	else
+	{
+		it->cur_x_position++;
+	}
+}
+
+void tuiCompositeShapeItStepSpan(TuiCompositeShapeIt* const it)
+{
+	assert(it != NULL);
+	it->row_span_index++;
+	if (it->row_span_index < it->row_span_count)
+	{
+		it->cur_x_position = it->row_span_xs[it->row_span_index * 2];
+	}
+	else
+	{
+		_tuiCompositeShapeItLoadRow(it, it->cur_y_position + 1);
+	}
+}
+
+void tuiCompositeShapeItSetStart(TuiCompositeShapeIt* const it)
+{
+	assert(it != NULL);
+	_tuiCompositeShapeItLoadRow(it, it->top_y);
+}
+
+TuiCompositeShape tuiCompositeShapeItGetCompositeShape(const TuiCompositeShapeIt it)
+{
+	TuiCompositeShape ret = { it.shapes, it.operations, it.shape_count };
+	return ret;
+}
+
+TuiPoint2 tuiCompositeShapeItGetPoint2(const TuiCompositeShapeIt it)
+{
+	TuiPoint2 ret = { it.cur_x_position, it.cur_y_position };
+	return ret;
+}
+
+TuiSpan tuiCompositeShapeItGetSpan(const TuiCompositeShapeIt it)
+{
+	TuiSpan ret = { it.cur_y_position, it.cur_x_position, it.row_span_xs[it.row_span_index * 2 + 1] };
+	return ret;
+}
\ No newline at end of file
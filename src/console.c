@@ -70,10 +70,41 @@ void tuiConsoleDestroy(TuiConsole console)
 {
 	assert(console != NULL);
 	tuiFree(console->TileData);
+	if (console->Label != NULL)
+	{
+		tuiFree(console->Label);
+	}
 	tuiFree(console);
 	sConsoleCount--;
 }
 
+TuiResult tuiConsoleSetLabel(TuiConsole console, const char* label)
+{
+	assert(console != NULL);
+	char* label_copy = NULL;
+	if (label != NULL)
+	{
+		label_copy = (char*)tuiAllocate((strlen(label) + 1) * sizeof(char));
+		if (label_copy == NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		strcpy(label_copy, label);
+	}
+	if (console->Label != NULL)
+	{
+		tuiFree(console->Label);
+	}
+	console->Label = label_copy;
+	return TUI_RESULT_OK;
+}
+
+const char* tuiConsoleGetLabel(TuiConsole console)
+{
+	assert(console != NULL);
+	return console->Label;
+}
+
 float tuiConsoleGetPixelScale(TuiConsole console)
 {
 	assert(console != NULL);
@@ -263,6 +294,33 @@ TuiResult tuiConsolePushTileFreeSized(TuiConsole console, const int screen_pixel
 	return TUI_RESULT_OK;
 }
 
+TuiResult tuiConsolePushTextRun(TuiConsole console, TuiAtlas atlas, const uint16_t* glyphs, const int glyph_count, const int screen_pixel_x, const int baseline_pixel_y, const uint8_t fg_r, const uint8_t fg_g, const uint8_t fg_b, const uint8_t fg_a, const uint8_t bg_r, const uint8_t bg_g, const uint8_t bg_b, const uint8_t bg_a)
+{
+	assert(console != NULL);
+	assert(atlas != NULL);
+	assert(glyphs != NULL || glyph_count == 0);
+	int pen_x = screen_pixel_x;
+	for (int glyph_i = 0; glyph_i < glyph_count; glyph_i++)
+	{
+		TuiGlyphMetrics glyph_metrics;
+		tuiAtlasGetGlyphMetric(atlas, glyphs[glyph_i], &glyph_metrics);
+		const int tile_x = pen_x + glyph_metrics.bearing_x;
+		const int tile_y = baseline_pixel_y - glyph_metrics.bearing_y;
+		// Glyphs with no tile only advance the pen, and tiles entirely outside the console are skipped rather than failing the run.
+		if (glyph_metrics.width > 0 && glyph_metrics.height > 0 && glyph_metrics.width <= TUI_MAX_TILE_SIZE && glyph_metrics.height <= TUI_MAX_TILE_SIZE && tile_x + glyph_metrics.width > 0 && tile_y + glyph_metrics.height > 0 && tile_x < (int)console->PixelWidth && tile_y < (int)console->PixelHeight)
+		{
+			if (!_tuiConsoleTryReserve(console)) return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+			_tuiConsolePushTile(console, tile_x, tile_y, glyph_metrics.width, glyph_metrics.height, glyphs[glyph_i], fg_r, fg_g, fg_b, fg_a, bg_r, bg_g, bg_b, bg_a);
+		}
+		pen_x += glyph_metrics.advance;
+		if (glyph_i + 1 < glyph_count)
+		{
+			pen_x += tuiAtlasGetKerning(atlas, glyphs[glyph_i], glyphs[glyph_i + 1]);
+		}
+	}
+	return TUI_RESULT_OK;
+}
+
 size_t tuiGetConsoleCount()
 {
 	return sConsoleCount;
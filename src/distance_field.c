@@ -0,0 +1,108 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/distance_field.h>
+#include <TUIC/distance_transform.h>
+#include <TUIC/grid_mask.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "math_inline.h"
+
+#include <assert.h>
+#include <math.h>
+
+
+// The coverage value at and above which a pixel is inside the glyph.
+#define TUI_DISTANCE_FIELD_INSIDE_COVERAGE 128
+
+TuiResult tuiDistanceFieldGenerate(const uint8_t* coverage, const int coverage_width, const int coverage_height, const int downscale, const float spread, uint8_t* distances, const int thread_count)
+{
+	assert(coverage != NULL);
+	assert(distances != NULL);
+	if (coverage_width < 1 || coverage_height < 1 || downscale < 1 || coverage_width % downscale != 0 || coverage_height % downscale != 0 || !(spread > 0.0f))
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	const size_t pixel_count = (size_t)coverage_width * (size_t)coverage_height;
+	TuiGridMask inside_mask = NULL;
+	TuiGridMask outside_mask = NULL;
+	TuiResult result = tuiGridMaskCreate(&inside_mask, coverage_width, coverage_height);
+	if (result == TUI_RESULT_OK)
+	{
+		result = tuiGridMaskCreate(&outside_mask, coverage_width, coverage_height);
+	}
+	// The first half holds the distance of every pixel to the inside and the second half its distance to the outside.
+	float* edge_distances = (result == TUI_RESULT_OK) ? (float*)tuiAllocate(pixel_count * 2 * sizeof(float)) : NULL;
+	if (result == TUI_RESULT_OK && edge_distances == NULL)
+	{
+		result = TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	if (result == TUI_RESULT_OK)
+	{
+		for (size_t pixel_i = 0; pixel_i < pixel_count; pixel_i++)
+		{
+			const uint8_t inside = coverage[pixel_i] >= TUI_DISTANCE_FIELD_INSIDE_COVERAGE;
+			inside_mask->Data[pixel_i] = inside;
+			outside_mask->Data[pixel_i] = !inside;
+		}
+		result = tuiDistanceTransformEuclidean(inside_mask, edge_distances, thread_count);
+	}
+	if (result == TUI_RESULT_OK)
+	{
+		result = tuiDistanceTransformEuclidean(outside_mask, &edge_distances[pixel_count], thread_count);
+	}
+	if (result == TUI_RESULT_OK)
+	{
+		const int field_width = coverage_width / downscale;
+		const int field_height = coverage_height / downscale;
+		const float block_scale = 1.0f / ((float)downscale * (float)downscale * (float)downscale);
+		for (int field_y = 0; field_y < field_height; field_y++)
+		{
+			for (int field_x = 0; field_x < field_width; field_x++)
+			{
+				// Pixel centres are half a pixel from the edge between an inside and an outside pixel, so distances are measured to that edge. Outside distances are positive.
+				float block_distance = 0.0f;
+				for (int y = field_y * downscale; y < (field_y + 1) * downscale; y++)
+				{
+					for (int x = field_x * downscale; x < (field_x + 1) * downscale; x++)
+					{
+						const size_t pixel_i = (size_t)y * (size_t)coverage_width + (size_t)x;
+						block_distance += (inside_mask->Data[pixel_i] != 0) ? 0.5f - edge_distances[pixel_count + pixel_i] : edge_distances[pixel_i] - 0.5f;
+					}
+				}
+				float value = 0.5f - (block_distance * block_scale) / (2.0f * spread);
+				value = CLAMP(value, 0.0f, 1.0f);
+				distances[(size_t)field_y * (size_t)field_width + (size_t)field_x] = (uint8_t)(value * 255.0f + 0.5f);
+			}
+		}
+	}
+	if (edge_distances != NULL)
+	{
+		tuiFree(edge_distances);
+	}
+	if (outside_mask != NULL)
+	{
+		tuiGridMaskDestroy(outside_mask);
+	}
+	if (inside_mask != NULL)
+	{
+		tuiGridMaskDestroy(inside_mask);
+	}
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,255 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/distance_transform.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "parallel.h"
+#include "math_inline.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdalign.h>
+
+
+// The scratch memory one thread uses to solve rows with the lower envelope of parabolas.
+typedef struct TuiDistanceTransformScratch
+{
+	double* Heights;
+
+	int* Vertices;
+
+	double* Boundaries;
+} TuiDistanceTransformScratch;
+
+typedef struct TuiDistanceTransformJobs
+{
+	const uint8_t* SourceData;
+
+	float* Distances;
+
+	int Width;
+
+	int Height;
+
+	int JobCount;
+
+	TuiDistanceTransformScratch* Scratches;
+} TuiDistanceTransformJobs;
+
+// Write the squared vertical distance from each tile of a range of columns to the nearest source in its column. Rows are walked in order so every column of the range is updated with contiguous reads and writes.
+static void _tuiDistanceTransformColumns(const TuiDistanceTransformJobs* jobs, const int left_x, const int right_x)
+{
+	const int width = jobs->Width;
+	const int height = jobs->Height;
+	for (int x = left_x; x < right_x; x++)
+	{
+		jobs->Distances[x] = (jobs->SourceData[x] != 0) ? 0.0f : INFINITY;
+	}
+	for (int y = 1; y < height; y++)
+	{
+		const uint8_t* source_row = &jobs->SourceData[(size_t)y * (size_t)width];
+		float* row = &jobs->Distances[(size_t)y * (size_t)width];
+		const float* above_row = row - width;
+		for (int x = left_x; x < right_x; x++)
+		{
+			row[x] = (source_row[x] != 0) ? 0.0f : above_row[x] + 1.0f;
+		}
+	}
+	for (int y = height - 2; y >= 0; y--)
+	{
+		float* row = &jobs->Distances[(size_t)y * (size_t)width];
+		const float* below_row = row + width;
+		for (int x = left_x; x < right_x; x++)
+		{
+			row[x] = MIN(row[x], below_row[x] + 1.0f);
+		}
+	}
+	for (int y = 0; y < height; y++)
+	{
+		float* row = &jobs->Distances[(size_t)y * (size_t)width];
+		for (int x = left_x; x < right_x; x++)
+		{
+			row[x] = row[x] * row[x];
+		}
+	}
+}
+
+// Replace the squared vertical distances of a row with squared Euclidean distances by taking the lower envelope of the parabolas rooted at each tile.
+static void _tuiDistanceTransformRow(float* row, const int width, const TuiDistanceTransformScratch* scratch)
+{
+	double* heights = scratch->Heights;
+	int* vertices = scratch->Vertices;
+	double* boundaries = scratch->Boundaries;
+	int parabola_i = -1;
+	for (int x = 0; x < width; x++)
+	{
+		heights[x] = (double)row[x];
+		if (isinf(row[x]))
+		{
+			continue;
+		}
+		double intersection = 0.0;
+		while (parabola_i >= 0)
+		{
+			const int vertex = vertices[parabola_i];
+			intersection = ((heights[x] + (double)x * x) - (heights[vertex] + (double)vertex * vertex)) / (2.0 * (x - vertex));
+			if (intersection > boundaries[parabola_i])
+			{
+				break;
+			}
+			parabola_i--;
+		}
+		parabola_i++;
+		vertices[parabola_i] = x;
+		boundaries[parabola_i] = (parabola_i == 0) ? -INFINITY : intersection;
+		boundaries[parabola_i + 1] = INFINITY;
+	}
+	if (parabola_i < 0)
+	{
+		return;
+	}
+	parabola_i = 0;
+	for (int x = 0; x < width; x++)
+	{
+		while (boundaries[parabola_i + 1] < x)
+		{
+			parabola_i++;
+		}
+		const int vertex = vertices[parabola_i];
+		row[x] = (float)((double)(x - vertex) * (x - vertex) + heights[vertex]);
+	}
+}
+
+static void _tuiDistanceTransformColumnJob(void* user_data, int job_index)
+{
+	const TuiDistanceTransformJobs* jobs = (const TuiDistanceTransformJobs*)user_data;
+	const int left_x = (int)((int64_t)jobs->Width * job_index / jobs->JobCount);
+	const int right_x = (int)((int64_t)jobs->Width * (job_index + 1) / jobs->JobCount);
+	_tuiDistanceTransformColumns(jobs, left_x, right_x);
+}
+
+static void _tuiDistanceTransformRowJob(void* user_data, int job_index)
+{
+	const TuiDistanceTransformJobs* jobs = (const TuiDistanceTransformJobs*)user_data;
+	for (int y = job_index; y < jobs->Height; y += jobs->JobCount)
+	{
+		float* row = &jobs->Distances[(size_t)y * (size_t)jobs->Width];
+		_tuiDistanceTransformRow(row, jobs->Width, &jobs->Scratches[job_index]);
+		for (int x = 0; x < jobs->Width; x++)
+		{
+			row[x] = sqrtf(row[x]);
+		}
+	}
+}
+
+TuiResult tuiDistanceTransformEuclidean(TuiGridMask source_mask, float* distances, const int thread_count)
+{
+	assert(source_mask != NULL);
+	assert(distances != NULL);
+	const int width = source_mask->Width;
+	const int height = source_mask->Height;
+	int job_count = (thread_count < 1) ? tui_get_hardware_thread_count() : thread_count;
+	job_count = CLAMP(job_count, 1, MIN(MIN(width, height), TUI_PARALLEL_MAX_THREADS));
+
+	// Every thread gets one block of scratch memory for its rows, carved into its heights, vertices and boundaries.
+	// Blocks are rounded up to the alignment of double, since an odd width leaves the vertices ending off it and the next block starts with doubles.
+	const size_t scratch_size = ((size_t)width * sizeof(double) * 2 + sizeof(double) + (size_t)width * sizeof(int) + alignof(double) - 1) / alignof(double) * alignof(double);
+	uint8_t* scratch_memory = (uint8_t*)tuiAllocate(scratch_size * (size_t)job_count);
+	if (scratch_memory == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	TuiDistanceTransformScratch scratches[TUI_PARALLEL_MAX_THREADS];
+	for (int job_i = 0; job_i < job_count; job_i++)
+	{
+		uint8_t* job_memory = scratch_memory + scratch_size * (size_t)job_i;
+		scratches[job_i].Heights = (double*)job_memory;
+		scratches[job_i].Boundaries = (double*)(job_memory + (size_t)width * sizeof(double));
+		scratches[job_i].Vertices = (int*)(job_memory + (size_t)width * sizeof(double) * 2 + sizeof(double));
+	}
+
+	TuiDistanceTransformJobs jobs = { source_mask->Data, distances, width, height, job_count, scratches };
+	tui_parallel_for(job_count, job_count, _tuiDistanceTransformColumnJob, &jobs);
+	tui_parallel_for(job_count, job_count, _tuiDistanceTransformRowJob, &jobs);
+	tuiFree(scratch_memory);
+	return TUI_RESULT_OK;
+}
+
+void tuiDistanceTransformChamfer(TuiGridMask source_mask, float* distances)
+{
+	assert(source_mask != NULL);
+	assert(distances != NULL);
+	const int width = source_mask->Width;
+	const int height = source_mask->Height;
+	const float diagonal = 1.41421356f;
+	for (int y = 0; y < height; y++)
+	{
+		const uint8_t* source_row = &source_mask->Data[(size_t)y * (size_t)width];
+		float* row = &distances[(size_t)y * (size_t)width];
+		const float* above_row = row - width;
+		for (int x = 0; x < width; x++)
+		{
+			float distance = (source_row[x] != 0) ? 0.0f : INFINITY;
+			if (y > 0)
+			{
+				distance = MIN(distance, above_row[x] + 1.0f);
+				if (x > 0)
+				{
+					distance = MIN(distance, above_row[x - 1] + diagonal);
+				}
+				if (x < width - 1)
+				{
+					distance = MIN(distance, above_row[x + 1] + diagonal);
+				}
+			}
+			if (x > 0)
+			{
+				distance = MIN(distance, row[x - 1] + 1.0f);
+			}
+			row[x] = distance;
+		}
+	}
+	for (int y = height - 1; y >= 0; y--)
+	{
+		float* row = &distances[(size_t)y * (size_t)width];
+		const float* below_row = row + width;
+		for (int x = width - 1; x >= 0; x--)
+		{
+			float distance = row[x];
+			if (y < height - 1)
+			{
+				distance = MIN(distance, below_row[x] + 1.0f);
+				if (x > 0)
+				{
+					distance = MIN(distance, below_row[x - 1] + diagonal);
+				}
+				if (x < width - 1)
+				{
+					distance = MIN(distance, below_row[x + 1] + diagonal);
+				}
+			}
+			if (x < width - 1)
+			{
+				distance = MIN(distance, row[x + 1] + 1.0f);
+			}
+			row[x] = distance;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,278 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/tuic.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "opengl33.h"
+#include "software.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+TuiResult tuiDrawListCreate(TuiDrawList* draw_list, int command_capacity)
+{
+	assert(draw_list != NULL);
+	if (command_capacity < 1)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	*draw_list = (TuiDrawList)tuiAllocate(sizeof(TuiDrawList_s));
+	if (*draw_list == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*draw_list, 0, sizeof(TuiDrawList_s));
+	(*draw_list)->Commands = (TuiDrawCommand*)tuiAllocate((size_t)command_capacity * sizeof(TuiDrawCommand));
+	if ((*draw_list)->Commands == NULL)
+	{
+		tuiFree(*draw_list);
+		*draw_list = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	(*draw_list)->CommandCapacity = command_capacity;
+	return TUI_RESULT_OK;
+}
+
+void tuiDrawListDestroy(TuiDrawList draw_list)
+{
+	assert(draw_list != NULL);
+	tuiFree(draw_list->Commands);
+	if (draw_list->SortedCommands != NULL)
+	{
+		tuiFree(draw_list->SortedCommands);
+	}
+	if (draw_list->Targets != NULL)
+	{
+		tuiFree(draw_list->Targets);
+	}
+	tuiFree(draw_list);
+}
+
+void tuiDrawListBegin(TuiDrawList draw_list)
+{
+	assert(draw_list != NULL);
+	draw_list->CommandCount = 0;
+}
+
+static TuiResult _tuiDrawListRecord(TuiDrawList draw_list, const TuiDrawCommand* command)
+{
+	if (draw_list->CommandCount == draw_list->CommandCapacity)
+	{
+		const int new_capacity = draw_list->CommandCapacity * 2;
+		TuiDrawCommand* new_commands = (TuiDrawCommand*)tuiReallocate(draw_list->Commands, (size_t)new_capacity * sizeof(TuiDrawCommand));
+		if (new_commands == NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		draw_list->Commands = new_commands;
+		draw_list->CommandCapacity = new_capacity;
+	}
+	draw_list->Commands[draw_list->CommandCount] = *command;
+	draw_list->Commands[draw_list->CommandCount].Sequence = draw_list->CommandCount;
+	draw_list->CommandCount++;
+	return TUI_RESULT_OK;
+}
+
+static inline void _tuiDrawCommandInit(TuiDrawCommand* command, TuiDrawCommandType type, TuiPanel panel, int left_x, int right_x, int top_y, int bottom_y)
+{
+	memset(command, 0, sizeof(TuiDrawCommand));
+	command->Type = type;
+	command->Target = panel;
+	command->LeftX = left_x;
+	command->RightX = right_x;
+	command->TopY = top_y;
+	command->BottomY = bottom_y;
+}
+
+TuiResult tuiDrawListRecordConsole(TuiDrawList draw_list, TuiPanel panel, TuiAtlas atlas, TuiConsole console, int left_x, int right_x, int top_y, int bottom_y)
+{
+	assert(draw_list != NULL);
+	assert(panel != NULL);
+	assert(atlas != NULL);
+	assert(console != NULL);
+	TuiDrawCommand command;
+	_tuiDrawCommandInit(&command, TUI_DRAW_COMMAND_CONSOLE, panel, left_x, right_x, top_y, bottom_y);
+	command.Atlas = atlas;
+	command.Console = console;
+	return _tuiDrawListRecord(draw_list, &command);
+}
+
+TuiResult tuiDrawListRecordPanel(TuiDrawList draw_list, TuiPanel panel, TuiPanel subject_panel, int left_x, int right_x, int top_y, int bottom_y)
+{
+	assert(draw_list != NULL);
+	assert(panel != NULL);
+	assert(subject_panel != NULL);
+	if (subject_panel == panel)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	TuiDrawCommand command;
+	_tuiDrawCommandInit(&command, TUI_DRAW_COMMAND_PANEL, panel, left_x, right_x, top_y, bottom_y);
+	command.SubjectPanel = subject_panel;
+	return _tuiDrawListRecord(draw_list, &command);
+}
+
+TuiResult tuiDrawListRecordTexture(TuiDrawList draw_list, TuiPanel panel, TuiTexture texture, int left_x, int right_x, int top_y, int bottom_y)
+{
+	assert(draw_list != NULL);
+	assert(panel != NULL);
+	assert(texture != NULL);
+	TuiDrawCommand command;
+	_tuiDrawCommandInit(&command, TUI_DRAW_COMMAND_TEXTURE, panel, left_x, right_x, top_y, bottom_y);
+	command.Texture = texture;
+	return _tuiDrawListRecord(draw_list, &command);
+}
+
+TuiResult tuiDrawListRecordWindow(TuiDrawList draw_list, TuiPanel panel, TuiWindow window, int left_x, int right_x, int top_y, int bottom_y)
+{
+	assert(draw_list != NULL);
+	assert(panel != NULL);
+	assert(window != NULL);
+	TuiDrawCommand command;
+	_tuiDrawCommandInit(&command, TUI_DRAW_COMMAND_WINDOW, panel, left_x, right_x, top_y, bottom_y);
+	command.Window = window;
+	return _tuiDrawListRecord(draw_list, &command);
+}
+
+int tuiDrawListGetCommandCount(TuiDrawList draw_list)
+{
+	assert(draw_list != NULL);
+	return draw_list->CommandCount;
+}
+
+// Find the target entry of a panel, or add one. There are at most two panels per command, so the entries never outgrow the array.
+static TuiDrawListTarget* _tuiDrawListFindTarget(TuiDrawList draw_list, int* target_count, TuiPanel panel, int* target_i)
+{
+	for (int i = 0; i < *target_count; i++)
+	{
+		if (draw_list->Targets[i].Panel == panel)
+		{
+			*target_i = i;
+			return &draw_list->Targets[i];
+		}
+	}
+	TuiDrawListTarget* target = &draw_list->Targets[*target_count];
+	target->Panel = panel;
+	target->LastWritePass = -1;
+	target->LastReadPass = -1;
+	*target_i = (*target_count)++;
+	return target;
+}
+
+static inline int _tuiMaxInt(int a, int b)
+{
+	return (a > b) ? a : b;
+}
+
+// Put every command in the earliest pass that keeps the result of drawing in order. A draw to a panel goes to a later pass than the last read of the panel, and a read of a panel goes to a later pass than the last draw to the panel.
+static void _tuiDrawListAssignPasses(TuiDrawList draw_list)
+{
+	int target_count = 0;
+	for (int command_i = 0; command_i < draw_list->CommandCount; command_i++)
+	{
+		TuiDrawCommand* command = &draw_list->Commands[command_i];
+		TuiDrawListTarget* target = _tuiDrawListFindTarget(draw_list, &target_count, command->Target, &command->TargetOrder);
+		int pass = _tuiMaxInt(0, _tuiMaxInt(target->LastWritePass, target->LastReadPass + 1));
+		TuiDrawListTarget* source = NULL;
+		if (command->SubjectPanel != NULL)
+		{
+			int source_i;
+			source = _tuiDrawListFindTarget(draw_list, &target_count, command->SubjectPanel, &source_i);
+			pass = _tuiMaxInt(pass, source->LastWritePass + 1);
+			source->LastReadPass = _tuiMaxInt(source->LastReadPass, pass);
+		}
+		command->Pass = pass;
+		target->LastWritePass = pass;
+	}
+}
+
+static int _tuiCompareDrawCommands(const void* a, const void* b)
+{
+	const TuiDrawCommand* command_a = (const TuiDrawCommand*)a;
+	const TuiDrawCommand* command_b = (const TuiDrawCommand*)b;
+	if (command_a->Pass != command_b->Pass)
+	{
+		return (command_a->Pass < command_b->Pass) ? -1 : 1;
+	}
+	if (command_a->TargetOrder != command_b->TargetOrder)
+	{
+		return (command_a->TargetOrder < command_b->TargetOrder) ? -1 : 1;
+	}
+	return (command_a->Sequence > command_b->Sequence) - (command_a->Sequence < command_b->Sequence);
+}
+
+TuiResult tuiDrawListSubmit(TuiDrawList draw_list)
+{
+	assert(draw_list != NULL);
+	if (tui_get_system() == NULL)
+	{
+		return TUI_RESULT_ERROR_NOT_INITIALIZED;
+	}
+	if (draw_list->CommandCount == 0)
+	{
+		return TUI_RESULT_OK;
+	}
+	if (draw_list->SortedCapacity < draw_list->CommandCount)
+	{
+		// Commands are sorted into a copy, so the recorded order is kept for submitting the list again.
+		TuiDrawCommand* sorted_commands = (TuiDrawCommand*)tuiAllocate((size_t)draw_list->CommandCapacity * sizeof(TuiDrawCommand));
+		TuiDrawListTarget* targets = (TuiDrawListTarget*)tuiAllocate((size_t)draw_list->CommandCapacity * 2 * sizeof(TuiDrawListTarget));
+		if (sorted_commands == NULL || targets == NULL)
+		{
+			if (sorted_commands != NULL)
+			{
+				tuiFree(sorted_commands);
+			}
+			if (targets != NULL)
+			{
+				tuiFree(targets);
+			}
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		if (draw_list->SortedCommands != NULL)
+		{
+			tuiFree(draw_list->SortedCommands);
+			tuiFree(draw_list->Targets);
+		}
+		draw_list->SortedCommands = sorted_commands;
+		draw_list->Targets = targets;
+		draw_list->SortedCapacity = draw_list->CommandCapacity;
+	}
+	_tuiDrawListAssignPasses(draw_list);
+	memcpy(draw_list->SortedCommands, draw_list->Commands, (size_t)draw_list->CommandCount * sizeof(TuiDrawCommand));
+	qsort(draw_list->SortedCommands, (size_t)draw_list->CommandCount, sizeof(TuiDrawCommand), _tuiCompareDrawCommands);
+	// Each run of draws to one panel in one pass is handed to the backend together, so its framebuffer is bound once for the run.
+	int run_start = 0;
+	for (int command_i = 1; command_i <= draw_list->CommandCount; command_i++)
+	{
+		if (command_i == draw_list->CommandCount || draw_list->SortedCommands[command_i].Target != draw_list->SortedCommands[run_start].Target || draw_list->SortedCommands[command_i].Pass != draw_list->SortedCommands[run_start].Pass)
+		{
+			TuiPanel target = draw_list->SortedCommands[run_start].Target;
+			TuiResult result = tui_is_software_backend() ? tuiPanelDrawCommands_Software(target, &draw_list->SortedCommands[run_start], command_i - run_start) : tuiPanelDrawCommands_Opengl33(target, &draw_list->SortedCommands[run_start], command_i - run_start);
+			if (result != TUI_RESULT_OK)
+			{
+				return result;
+			}
+			run_start = command_i;
+		}
+	}
+	return TUI_RESULT_OK;
+}
\ No newline at end of file
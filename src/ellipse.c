@@ -0,0 +1,209 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/ellipse.h>
+#include <TUIC/point2.h>
+#include <TUIC/line.h>
+#include <TUIC/rect.h>
+#include <TUIC/circle.h>
+#include <TUIC/polygon.h>
+#include "grid_shapes_inline.h"
+#include "math_inline.h"
+#include <stdlib.h>
+
+
+TuiEllipse tuiEllipse(const int center_x, const int center_y, const float radius_x, const float radius_y)
+{
+	TuiEllipse ret = { center_x, center_y, radius_x, radius_y };
+	return ret;
+}
+
+TuiPoint2 tuiEllipseGetCenterPoint2(const TuiEllipse ellipse)
+{
+	TuiPoint2 ret = { ellipse.center_x, ellipse.center_y };
+	return ret;
+}
+
+int tuiEllipseGetLeftX(const TuiEllipse ellipse)
+{
+	const int left_x = ellipse.center_x - (int)floorf(fabsf(ellipse.radius_x));
+	return left_x;
+}
+
+int tuiEllipseGetRightX(const TuiEllipse ellipse)
+{
+	const int right_x = ellipse.center_x + (int)floorf(fabsf(ellipse.radius_x));
+	return right_x;
+}
+
+int tuiEllipseGetTopY(const TuiEllipse ellipse)
+{
+	const int top_y = ellipse.center_y - (int)floorf(fabsf(ellipse.radius_y));
+	return top_y;
+}
+
+int tuiEllipseGetBottomY(const TuiEllipse ellipse)
+{
+	const int bottom_y = ellipse.center_y + (int)floorf(fabsf(ellipse.radius_y));
+	return bottom_y;
+}
+
+int tuiEllipseGetTileWidth(const TuiEllipse ellipse)
+{
+	const int tile_width = (int)floorf(fabsf(ellipse.radius_x)) * 2 + 1;
+	return tile_width;
+}
+
+int tuiEllipseGetTileHeight(const TuiEllipse ellipse)
+{
+	const int tile_height = (int)floorf(fabsf(ellipse.radius_y)) * 2 + 1;
+	return tile_height;
+}
+
+TuiRect tuiEllipseGetBoundingRect(const TuiEllipse ellipse)
+{
+	const int left_x = tuiEllipseGetLeftX(ellipse);
+	const int top_y = tuiEllipseGetTopY(ellipse);
+	const int tile_width = tuiEllipseGetTileWidth(ellipse);
+	const int tile_height = tuiEllipseGetTileHeight(ellipse);
+	const TuiRect ret = tuiRect(left_x, top_y, tile_width, tile_height);
+	return ret;
+}
+
+TuiPoint2 tuiEllipseGetLeftPoint2(const TuiEllipse ellipse)
+{
+	TuiPoint2 ret = { tuiEllipseGetLeftX(ellipse), ellipse.center_y };
+	return ret;
+}
+
+TuiPoint2 tuiEllipseGetRightPoint2(const TuiEllipse ellipse)
+{
+	TuiPoint2 ret = { tuiEllipseGetRightX(ellipse), ellipse.center_y };
+	return ret;
+}
+
+TuiPoint2 tuiEllipseGetTopPoint2(const TuiEllipse ellipse)
+{
+	TuiPoint2 ret = { ellipse.center_x, tuiEllipseGetTopY(ellipse) };
+	return ret;
+}
+
+TuiPoint2 tuiEllipseGetBottomPoint2(const TuiEllipse ellipse)
+{
+	TuiPoint2 ret = { ellipse.center_x, tuiEllipseGetBottomY(ellipse) };
+	return ret;
+}
+
+TuiBoolean tuiEllipseIsDegenerate(const TuiEllipse ellipse)
+{
+	return (fabsf(ellipse.radius_x) < 0.5f || fabsf(ellipse.radius_y) < 0.5f);
+}
+
+TuiBoolean tuiEllipseContainsPoint2(const TuiEllipse ellipse, const TuiPoint2 point2)
+{
+	int row_left_x, row_right_x;
+	if (!_tuiEllipseGetRowSpan(ellipse.center_x, ellipse.center_y, ellipse.radius_x, ellipse.radius_y, point2.y, &row_left_x, &row_right_x)) return TUI_FALSE;
+	return (point2.x >= row_left_x && point2.x <= row_right_x);
+}
+
+TuiBoolean tuiEllipseContainsLine(const TuiEllipse ellipse, const TuiLine line)
+{
+	if (tuiEllipseIsDegenerate(ellipse)) return TUI_FALSE;
+	return tuiEllipseContainsPoint2(ellipse, tuiLineGetStartPoint2(line)) && tuiEllipseContainsPoint2(ellipse, tuiLineGetEndPoint2(line));
+}
+
+TuiBoolean tuiEllipseContainsRect(const TuiEllipse ellipse, const TuiRect rect)
+{
+	if (tuiEllipseIsDegenerate(ellipse) || tuiRectIsDegenerate(rect)) return TUI_FALSE;
+	return
+		tuiEllipseContainsPoint2(ellipse, tuiRectGetTopRightCornerPoint2(rect)) &&
+		tuiEllipseContainsPoint2(ellipse, tuiRectGetTopLeftCornerPoint2(rect)) &&
+		tuiEllipseContainsPoint2(ellipse, tuiRectGetBottomRightCornerPoint2(rect)) &&
+		tuiEllipseContainsPoint2(ellipse, tuiRectGetBottomLeftCornerPoint2(rect));
+}
+
+TuiBoolean tuiEllipseIntersectsLine(const TuiEllipse ellipse, const TuiLine line)
+{
+	if (tuiEllipseIsDegenerate(ellipse)) return TUI_FALSE;
+	// scale the line so the ellipse becomes a unit circle at the origin
+	const float abs_radius_x = fabsf(ellipse.radius_x);
+	const float abs_radius_y = fabsf(ellipse.radius_y);
+	const float start_x = (float)(line.start_x - ellipse.center_x) / abs_radius_x;
+	const float start_y = (float)(line.start_y - ellipse.center_y) / abs_radius_y;
+	const float translation_x = (float)(line.end_x - line.start_x) / abs_radius_x;
+	const float translation_y = (float)(line.end_y - line.start_y) / abs_radius_y;
+	const float translation_length_squared = translation_x * translation_x + translation_y * translation_y;
+	float closest_percent = 0.0f;
+	if (translation_length_squared > 0.0f)
+	{
+		closest_percent = -(start_x * translation_x + start_y * translation_y) / translation_length_squared;
+		closest_percent = CLAMP(closest_percent, 0.0f, 1.0f);
+	}
+	const float closest_x = start_x + translation_x * closest_percent;
+	const float closest_y = start_y + translation_y * closest_percent;
+	return (closest_x * closest_x + closest_y * closest_y) <= 1.0f;
+}
+
+TuiBoolean tuiEllipseIntersectsRect(const TuiEllipse ellipse, const TuiRect rect)
+{
+	if (tuiEllipseIsDegenerate(ellipse) || tuiRectIsDegenerate(rect)) return TUI_FALSE;
+	const TuiPoint2 rect_top_left = tuiRectGetTopLeftCornerPoint2(rect);
+	const TuiPoint2 rect_bottom_right = tuiRectGetBottomRightCornerPoint2(rect);
+	// an axis aligned ellipse is closest to the rect tile that is closest to its center
+	const int closest_x = CLAMP(ellipse.center_x, rect_top_left.x, rect_bottom_right.x);
+	const int closest_y = CLAMP(ellipse.center_y, rect_top_left.y, rect_bottom_right.y);
+	return tuiEllipseContainsPoint2(ellipse, tuiPoint2(closest_x, closest_y));
+}
+
+TuiBoolean tuiEllipseIntersectsCircle(const TuiEllipse ellipse, const TuiCircle circle)
+{
+	if (tuiEllipseIsDegenerate(ellipse) || tuiCircleIsDegenerate(circle)) return TUI_FALSE;
+	const int top_y = MAX(tuiEllipseGetTopY(ellipse), tuiCircleGetTopY(circle));
+	const int bottom_y = MIN(tuiEllipseGetBottomY(ellipse), tuiCircleGetBottomY(circle));
+	int ellipse_span_xs[2];
+	int circle_span_xs[2];
+	for (int row_y = top_y; row_y <= bottom_y; row_y++)
+	{
+		if (!_tuiEllipseGetRowSpan(ellipse.center_x, ellipse.center_y, ellipse.radius_x, ellipse.radius_y, row_y, &ellipse_span_xs[0], &ellipse_span_xs[1])) continue;
+		if (!_tuiCircleGetRowSpan(circle.center_x, circle.center_y, circle.radius, row_y, &circle_span_xs[0], &circle_span_xs[1])) continue;
+		if (_tuiSpanListsOverlap(ellipse_span_xs, 1, circle_span_xs, 1)) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
+
+TuiBoolean tuiEllipseIntersectsEllipse(const TuiEllipse ellipse_1, const TuiEllipse ellipse_2)
+{
+	if (tuiEllipseIsDegenerate(ellipse_1) || tuiEllipseIsDegenerate(ellipse_2)) return TUI_FALSE;
+	const int top_y = MAX(tuiEllipseGetTopY(ellipse_1), tuiEllipseGetTopY(ellipse_2));
+	const int bottom_y = MIN(tuiEllipseGetBottomY(ellipse_1), tuiEllipseGetBottomY(ellipse_2));
+	int span_xs_1[2];
+	int span_xs_2[2];
+	for (int row_y = top_y; row_y <= bottom_y; row_y++)
+	{
+		if (!_tuiEllipseGetRowSpan(ellipse_1.center_x, ellipse_1.center_y, ellipse_1.radius_x, ellipse_1.radius_y, row_y, &span_xs_1[0], &span_xs_1[1])) continue;
+		if (!_tuiEllipseGetRowSpan(ellipse_2.center_x, ellipse_2.center_y, ellipse_2.radius_x, ellipse_2.radius_y, row_y, &span_xs_2[0], &span_xs_2[1])) continue;
+		if (_tuiSpanListsOverlap(span_xs_1, 1, span_xs_2, 1)) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
+
+TuiBoolean tuiEllipseIntersectsPolygon(const TuiEllipse ellipse, const TuiPolygon polygon)
+{
+	return tuiPolygonIntersectsEllipse(polygon, ellipse);
+}
\ No newline at end of file
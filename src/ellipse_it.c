@@ -0,0 +1,92 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/ellipse_it.h>
+#include <TUIC/ellipse.h>
+#include "grid_shapes_inline.h"
+#include "math_inline.h"
+
+#include <assert.h>
+
+
+TuiEllipseIt tuiEllipseIt(const TuiEllipse ellipse)
+{
+	const TuiBoolean degenerate = tuiEllipseIsDegenerate(ellipse);
+	const int top_y = (degenerate) ? ellipse.center_y : tuiEllipseGetTopY(ellipse);
+	const int bottom_y = (degenerate) ? ellipse.center_y - 1 : tuiEllipseGetBottomY(ellipse);
+	int first_row_left_x = ellipse.center_x;
+	int first_row_right_x = ellipse.center_x;
+	_tuiEllipseGetRowSpan(ellipse.center_x, ellipse.center_y, ellipse.radius_x, ellipse.radius_y, top_y, &first_row_left_x, &first_row_right_x);
+	TuiEllipseIt ret = { ellipse.radius_x, ellipse.radius_y, ellipse.center_x, ellipse.center_y, top_y, bottom_y, first_row_left_x, first_row_right_x, first_row_left_x, top_y };
+	return ret;
+}
+
+TuiBoolean tuiEllipseItDone(const TuiEllipseIt it)
+{
+	return (it.cur_y_position > it.bottom_y);
+}
+
+void tuiEllipseItStepForward(TuiEllipseIt* const it)
+{
+	assert(it != NULL);
+	if (it->cur_x_position == it->row_right_x)
+	{
+		tuiEllipseItStepSpan(it);
+	}
+	else
+	{
+		it->cur_x_position++;
+	}
+}
+
+void tuiEllipseItStepSpan(TuiEllipseIt* const it)
+{
+	assert(it != NULL);
+	it->cur_y_position++;
+	if (it->cur_y_position > it->bottom_y) return;
+	_tuiEllipseGetRowSpan(it->center_x, it->center_y, it->radius_x, it->radius_y, it->cur_y_position, &it->row_left_x, &it->row_right_x);
+	it->cur_x_position = it->row_left_x;
+}
+
+void tuiEllipseItSetStart(TuiEllipseIt* const it)
+{
+	assert(it != NULL);
+	it->cur_y_position = it->top_y;
+	if (it->cur_y_position > it->bottom_y) return;
+	_tuiEllipseGetRowSpan(it->center_x, it->center_y, it->radius_x, it->radius_y, it->cur_y_position, &it->row_left_x, &it->row_right_x);
+	it->cur_x_position = it->row_left_x;
+}
+
+TuiEllipse tuiEllipseItGetEllipse(const TuiEllipseIt it)
+{
+	TuiEllipse ret = { it.center_x, it.center_y, it.radius_x, it.radius_y };
+	return ret;
+}
+
+TuiPoint2 tuiEllipseItGetPoint2(const TuiEllipseIt it)
+{
+	TuiPoint2 ret = { it.cur_x_position, it.cur_y_position };
+	return ret;
+}
+
+TuiSpan tuiEllipseItGetSpan(const TuiEllipseIt it)
+{
+	TuiSpan ret = { it.cur_y_position, it.cur_x_position, it.row_right_x };
+	return ret;
+}
\ No newline at end of file
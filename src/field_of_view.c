@@ -0,0 +1,213 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/field_of_view.h>
+#include "objects.h"
+#include "parallel.h"
+#include "math_inline.h"
+
+#include <assert.h>
+
+
+// The four directions a field of view is scanned in. Each quadrant is a cone of rows moving away from the viewer.
+typedef enum TuiFieldOfViewQuadrant
+{
+	TUI_FIELD_OF_VIEW_QUADRANT_NORTH = 0,
+	TUI_FIELD_OF_VIEW_QUADRANT_EAST = 1,
+	TUI_FIELD_OF_VIEW_QUADRANT_SOUTH = 2,
+	TUI_FIELD_OF_VIEW_QUADRANT_WEST = 3
+} TuiFieldOfViewQuadrant;
+
+// The state shared by every row scanned for a single viewer.
+typedef struct TuiFieldOfViewScan
+{
+	const uint8_t* BlockingData;
+
+	uint8_t* VisibleData;
+
+	int Width;
+
+	int Height;
+
+	int OriginX;
+
+	int OriginY;
+
+	int MaxDepth;
+
+	double RadiusSquared;
+
+	TuiFieldOfViewQuadrant Quadrant;
+} TuiFieldOfViewScan;
+
+// A slope from the viewer stored as an exact fraction so rows never disagree about which tiles a slope includes. The denominator is always positive.
+typedef struct TuiFieldOfViewSlope
+{
+	int64_t Numerator;
+
+	int64_t Denominator;
+} TuiFieldOfViewSlope;
+
+static inline int64_t _tuiFloorDivide(const int64_t numerator, const int64_t denominator)
+{
+	const int64_t quotient = numerator / denominator;
+	return (numerator % denominator != 0 && numerator < 0) ? quotient - 1 : quotient;
+}
+
+// Get the slope from the viewer to the near edge of a tile, the start of a run of tiles.
+static inline TuiFieldOfViewSlope _tuiFieldOfViewTileSlope(const int depth, const int column)
+{
+	TuiFieldOfViewSlope slope = { 2 * (int64_t)column - 1, 2 * (int64_t)depth };
+	return slope;
+}
+
+// Get the tile position of a depth and column in the quadrant being scanned.
+static inline void _tuiFieldOfViewGetTile(const TuiFieldOfViewScan* const scan, const int depth, const int column, int* const x, int* const y)
+{
+	switch (scan->Quadrant)
+	{
+	case TUI_FIELD_OF_VIEW_QUADRANT_NORTH:
+		*x = scan->OriginX + column;
+		*y = scan->OriginY - depth;
+		return;
+	case TUI_FIELD_OF_VIEW_QUADRANT_EAST:
+		*x = scan->OriginX + depth;
+		*y = scan->OriginY + column;
+		return;
+	case TUI_FIELD_OF_VIEW_QUADRANT_SOUTH:
+		*x = scan->OriginX + column;
+		*y = scan->OriginY + depth;
+		return;
+	default:
+		*x = scan->OriginX - depth;
+		*y = scan->OriginY + column;
+		return;
+	}
+}
+
+// Scan one row of a quadrant between two slopes, revealing its tiles and scanning the next row once for every run of floor tiles.
+static void _tuiFieldOfViewScanRow(const TuiFieldOfViewScan* const scan, const int depth, TuiFieldOfViewSlope start_slope, const TuiFieldOfViewSlope end_slope)
+{
+	if (depth > scan->MaxDepth) return;
+	// columns from depth * start_slope rounded with ties up to depth * end_slope rounded with ties down
+	const int min_column = (int)_tuiFloorDivide(2 * depth * start_slope.Numerator + start_slope.Denominator, 2 * start_slope.Denominator);
+	const int max_column = (int)-_tuiFloorDivide(end_slope.Denominator - 2 * depth * end_slope.Numerator, 2 * end_slope.Denominator);
+	int prev_tile_state = -1; // -1 for no tile yet, 0 for floor, 1 for wall
+	for (int column = min_column; column <= max_column; column++)
+	{
+		int x, y;
+		_tuiFieldOfViewGetTile(scan, depth, column, &x, &y);
+		const TuiBoolean in_mask = (x >= 0 && y >= 0 && x < scan->Width && y < scan->Height);
+		const size_t tile_index = (in_mask) ? (size_t)y * (size_t)scan->Width + (size_t)x : 0;
+		const TuiBoolean is_wall = (!in_mask || scan->BlockingData[tile_index] != 0);
+		const TuiBoolean is_symmetric =
+			((int64_t)column * start_slope.Denominator >= (int64_t)depth * start_slope.Numerator) &&
+			((int64_t)column * end_slope.Denominator <= (int64_t)depth * end_slope.Numerator);
+		const TuiBoolean in_radius = ((double)column * (double)column + (double)depth * (double)depth <= scan->RadiusSquared);
+		if (in_mask && in_radius && (is_wall || is_symmetric))
+		{
+			scan->VisibleData[tile_index] = 1;
+		}
+		if (prev_tile_state == 1 && !is_wall)
+		{
+			start_slope = _tuiFieldOfViewTileSlope(depth, column);
+		}
+		if (prev_tile_state == 0 && is_wall)
+		{
+			_tuiFieldOfViewScanRow(scan, depth + 1, start_slope, _tuiFieldOfViewTileSlope(depth, column));
+		}
+		prev_tile_state = (is_wall) ? 1 : 0;
+	}
+	if (prev_tile_state == 0)
+	{
+		_tuiFieldOfViewScanRow(scan, depth + 1, start_slope, end_slope);
+	}
+}
+
+static void _tuiFieldOfViewComputeUnchecked(TuiGridMask blocking_mask, const TuiCircle view_circle, TuiGridMask visible_mask)
+{
+	const double abs_radius = fabs((double)view_circle.radius);
+	TuiFieldOfViewScan scan;
+	scan.BlockingData = blocking_mask->Data;
+	scan.VisibleData = visible_mask->Data;
+	scan.Width = blocking_mask->Width;
+	scan.Height = blocking_mask->Height;
+	scan.OriginX = view_circle.center_x;
+	scan.OriginY = view_circle.center_y;
+	scan.MaxDepth = (int)MIN(floor(abs_radius), (double)MAX(blocking_mask->Width, blocking_mask->Height));
+	scan.RadiusSquared = abs_radius * abs_radius;
+	if (scan.OriginX >= 0 && scan.OriginY >= 0 && scan.OriginX < scan.Width && scan.OriginY < scan.Height)
+	{
+		scan.VisibleData[(size_t)scan.OriginY * (size_t)scan.Width + (size_t)scan.OriginX] = 1;
+	}
+	const TuiFieldOfViewSlope start_slope = { -1, 1 };
+	const TuiFieldOfViewSlope end_slope = { 1, 1 };
+	for (int quadrant = TUI_FIELD_OF_VIEW_QUADRANT_NORTH; quadrant <= TUI_FIELD_OF_VIEW_QUADRANT_WEST; quadrant++)
+	{
+		scan.Quadrant = (TuiFieldOfViewQuadrant)quadrant;
+		_tuiFieldOfViewScanRow(&scan, 1, start_slope, end_slope);
+	}
+}
+
+TuiResult tuiFieldOfViewCompute(TuiGridMask blocking_mask, const TuiCircle view_circle, TuiGridMask visible_mask)
+{
+	assert(blocking_mask != NULL);
+	assert(visible_mask != NULL);
+	if (blocking_mask == visible_mask || blocking_mask->Width != visible_mask->Width || blocking_mask->Height != visible_mask->Height)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	_tuiFieldOfViewComputeUnchecked(blocking_mask, view_circle, visible_mask);
+	return TUI_RESULT_OK;
+}
+
+typedef struct TuiFieldOfViewJobs
+{
+	TuiGridMask BlockingMask;
+
+	const TuiCircle* ViewCircles;
+
+	TuiGridMask* VisibleMasks;
+} TuiFieldOfViewJobs;
+
+static void _tuiFieldOfViewJob(void* user_data, int job_index)
+{
+	const TuiFieldOfViewJobs* jobs = (const TuiFieldOfViewJobs*)user_data;
+	_tuiFieldOfViewComputeUnchecked(jobs->BlockingMask, jobs->ViewCircles[job_index], jobs->VisibleMasks[job_index]);
+}
+
+TuiResult tuiFieldOfViewComputeMany(TuiGridMask blocking_mask, const TuiCircle* view_circles, TuiGridMask* visible_masks, const int view_count, const int thread_count)
+{
+	assert(blocking_mask != NULL);
+	if (view_count < 0 || (view_count > 0 && (view_circles == NULL || visible_masks == NULL)))
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	for (int view_i = 0; view_i < view_count; view_i++)
+	{
+		const TuiGridMask visible_mask = visible_masks[view_i];
+		if (visible_mask == NULL || visible_mask == blocking_mask || visible_mask->Width != blocking_mask->Width || visible_mask->Height != blocking_mask->Height)
+		{
+			return TUI_RESULT_ERROR_INVALID_VALUE;
+		}
+	}
+	TuiFieldOfViewJobs jobs = { blocking_mask, view_circles, visible_masks };
+	tui_parallel_for(view_count, thread_count, _tuiFieldOfViewJob, &jobs);
+	return TUI_RESULT_OK;
+}
\ No newline at end of file
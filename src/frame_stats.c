@@ -0,0 +1,74 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/tuic.h>
+#include "objects.h"
+#include "opengl33.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+TuiResult tuiSetFrameTimingEnabled(TuiBoolean enabled)
+{
+	TuiSystem system = tui_get_system();
+	if (system == NULL)
+	{
+		return TUI_RESULT_ERROR_NOT_INITIALIZED;
+	}
+	if (tui_is_software_backend())
+	{
+		// Frame timing measures GPU time with timer queries, which the software backend has none of.
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
+	tuiFrameTimingSetEnabled_Opengl33((enabled != TUI_FALSE) ? TUI_TRUE : TUI_FALSE);
+	return TUI_RESULT_OK;
+}
+
+TuiBoolean tuiIsFrameTimingEnabled()
+{
+	if (tui_is_software_backend())
+	{
+		return TUI_FALSE;
+	}
+	return tuiFrameTimingIsEnabled_Opengl33();
+}
+
+TuiResult tuiGetFrameStats(TuiFrameStats* stats)
+{
+	assert(stats != NULL);
+	TuiSystem system = tui_get_system();
+	if (system == NULL)
+	{
+		return TUI_RESULT_ERROR_NOT_INITIALIZED;
+	}
+	if (tui_is_software_backend())
+	{
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
+	if (tuiFrameTimingGetStats_Opengl33(stats) == TUI_FALSE)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	return TUI_RESULT_OK;
+}
+
+void tuiSetDrawTimingCallback(tuiDrawTimingFunction callback)
+{
+	tuiFrameTimingSetCallback_Opengl33(callback);
+}
\ No newline at end of file
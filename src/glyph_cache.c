@@ -0,0 +1,374 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/glyph_cache.h>
+#include <TUIC/atlas_builder.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "math_inline.h"
+
+#include <assert.h>
+#include <string.h>
+
+#define TUI_GLYPH_CACHE_NONE -1
+
+static inline uint32_t _tuiGlyphCacheHash(const TuiGlyphCache glyph_cache, const uint32_t codepoint)
+{
+	return (codepoint * 2654435761u) & glyph_cache->TableMask;
+}
+
+// Get the table position holding a codepoint, or the empty position where it would be inserted.
+static inline uint32_t _tuiGlyphCacheFind(const TuiGlyphCache glyph_cache, const uint32_t codepoint)
+{
+	uint32_t table_i = _tuiGlyphCacheHash(glyph_cache, codepoint);
+	while (glyph_cache->Table[table_i] != TUI_GLYPH_CACHE_NONE && glyph_cache->Slots[glyph_cache->Table[table_i]].Codepoint != codepoint)
+	{
+		table_i = (table_i + 1) & glyph_cache->TableMask;
+	}
+	return table_i;
+}
+
+// Remove a table entry by shifting later entries of its probe run back, so lookups never need tombstones.
+static void _tuiGlyphCacheTableRemove(TuiGlyphCache glyph_cache, uint32_t table_i)
+{
+	uint32_t next_i = table_i;
+	while (TUI_TRUE)
+	{
+		next_i = (next_i + 1) & glyph_cache->TableMask;
+		const int slot = glyph_cache->Table[next_i];
+		if (slot == TUI_GLYPH_CACHE_NONE)
+		{
+			break;
+		}
+		const uint32_t home_i = _tuiGlyphCacheHash(glyph_cache, glyph_cache->Slots[slot].Codepoint);
+		// Move the entry back only if the emptied position is between its home and where it is now.
+		if (((next_i - home_i) & glyph_cache->TableMask) >= ((next_i - table_i) & glyph_cache->TableMask))
+		{
+			glyph_cache->Table[table_i] = slot;
+			table_i = next_i;
+		}
+	}
+	glyph_cache->Table[table_i] = TUI_GLYPH_CACHE_NONE;
+}
+
+static inline void _tuiGlyphCacheUnlink(TuiGlyphCache glyph_cache, const int slot)
+{
+	TuiGlyphCacheSlot* cache_slot = &glyph_cache->Slots[slot];
+	if (cache_slot->Previous != TUI_GLYPH_CACHE_NONE)
+	{
+		glyph_cache->Slots[cache_slot->Previous].Next = cache_slot->Next;
+	}
+	else
+	{
+		glyph_cache->MostRecentSlot = cache_slot->Next;
+	}
+	if (cache_slot->Next != TUI_GLYPH_CACHE_NONE)
+	{
+		glyph_cache->Slots[cache_slot->Next].Previous = cache_slot->Previous;
+	}
+	else
+	{
+		glyph_cache->LeastRecentSlot = cache_slot->Previous;
+	}
+}
+
+// Move a slot to the most recently used end of the eviction list and pin it for the current frame.
+static inline void _tuiGlyphCacheTouch(TuiGlyphCache glyph_cache, const int slot, const TuiBoolean linked)
+{
+	if (linked)
+	{
+		_tuiGlyphCacheUnlink(glyph_cache, slot);
+	}
+	TuiGlyphCacheSlot* cache_slot = &glyph_cache->Slots[slot];
+	cache_slot->Frame = glyph_cache->Frame;
+	cache_slot->Previous = TUI_GLYPH_CACHE_NONE;
+	cache_slot->Next = glyph_cache->MostRecentSlot;
+	if (glyph_cache->MostRecentSlot != TUI_GLYPH_CACHE_NONE)
+	{
+		glyph_cache->Slots[glyph_cache->MostRecentSlot].Previous = slot;
+	}
+	else
+	{
+		glyph_cache->LeastRecentSlot = slot;
+	}
+	glyph_cache->MostRecentSlot = slot;
+}
+
+TuiResult tuiGlyphCacheCreate(TuiGlyphCache* glyph_cache, const int page_width, const int page_height, const int page_count, const int cell_width, const int cell_height, const int channel_count, tuiGlyphRasterizeFunction rasterize_function, void* user_data)
+{
+	assert(glyph_cache != NULL);
+	if (page_width < 1 || page_height < 1 || page_count < 1 || cell_width < 1 || cell_height < 1 || cell_width > page_width || cell_height > page_height || channel_count < 1 || channel_count > 4 || rasterize_function == NULL)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	*glyph_cache = (TuiGlyphCache)tuiAllocate(sizeof(TuiGlyphCache_s));
+	if (*glyph_cache == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*glyph_cache, 0, sizeof(TuiGlyphCache_s));
+	TuiGlyphCache cache = *glyph_cache;
+	cache->PageWidth = page_width;
+	cache->PageHeight = page_height;
+	cache->PageCount = page_count;
+	cache->CellWidth = cell_width;
+	cache->CellHeight = cell_height;
+	cache->ChannelCount = channel_count;
+	cache->CellsWide = page_width / cell_width;
+	cache->SlotCount = cache->CellsWide * (page_height / cell_height) * page_count;
+	cache->MostRecentSlot = TUI_GLYPH_CACHE_NONE;
+	cache->LeastRecentSlot = TUI_GLYPH_CACHE_NONE;
+	cache->EmptySlot = TUI_GLYPH_CACHE_NONE;
+	for (int empty_i = 0; empty_i < TUI_GLYPH_CACHE_EMPTY_CODEPOINT_COUNT; empty_i++)
+	{
+		cache->EmptyCodepoints[empty_i] = UINT32_MAX; // past the last Unicode codepoint
+	}
+	cache->Frame = 1;
+	cache->RasterizeFunction = rasterize_function;
+	cache->RasterizeUserData = user_data;
+	// The table is kept at most half full so probe runs stay short.
+	uint32_t table_size = 2;
+	while (table_size < (uint32_t)cache->SlotCount * 2)
+	{
+		table_size *= 2;
+	}
+	cache->TableMask = table_size - 1;
+	const size_t cell_size = (size_t)cell_width * (size_t)cell_height * (size_t)channel_count;
+	cache->Slots = (TuiGlyphCacheSlot*)tuiAllocate((size_t)cache->SlotCount * sizeof(TuiGlyphCacheSlot));
+	cache->Table = (int*)tuiAllocate((size_t)table_size * sizeof(int));
+	cache->StpqpCoordinates = (float*)tuiAllocate((size_t)cache->SlotCount * TUI_STPQP_COORDINATES_PER_GLYPH * sizeof(float));
+	cache->DirtySlots = (int*)tuiAllocate((size_t)cache->SlotCount * sizeof(int));
+	cache->RasterPixels = (uint8_t*)tuiAllocate(cell_size);
+	if (cache->Slots == NULL || cache->Table == NULL || cache->StpqpCoordinates == NULL || cache->DirtySlots == NULL || cache->RasterPixels == NULL)
+	{
+		tuiGlyphCacheDestroy(cache);
+		*glyph_cache = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	for (uint32_t table_i = 0; table_i < table_size; table_i++)
+	{
+		cache->Table[table_i] = TUI_GLYPH_CACHE_NONE;
+	}
+	memset(cache->StpqpCoordinates, 0, (size_t)cache->SlotCount * TUI_STPQP_COORDINATES_PER_GLYPH * sizeof(float));
+	return TUI_RESULT_OK;
+}
+
+void tuiGlyphCacheDestroy(TuiGlyphCache glyph_cache)
+{
+	assert(glyph_cache != NULL);
+	tuiFree(glyph_cache->Slots);
+	tuiFree(glyph_cache->Table);
+	tuiFree(glyph_cache->StpqpCoordinates);
+	tuiFree(glyph_cache->DirtySlots);
+	tuiFree(glyph_cache->StagingPixels);
+	tuiFree(glyph_cache->RasterPixels);
+	tuiFree(glyph_cache);
+}
+
+int tuiGlyphCacheGetGlyph(TuiGlyphCache glyph_cache, uint32_t codepoint)
+{
+	assert(glyph_cache != NULL);
+	uint32_t table_i = _tuiGlyphCacheFind(glyph_cache, codepoint);
+	if (glyph_cache->Table[table_i] != TUI_GLYPH_CACHE_NONE)
+	{
+		glyph_cache->HitCount++;
+		_tuiGlyphCacheTouch(glyph_cache, glyph_cache->Table[table_i], TUI_TRUE);
+		return glyph_cache->Table[table_i];
+	}
+	uint32_t* empty_codepoint = &glyph_cache->EmptyCodepoints[codepoint % TUI_GLYPH_CACHE_EMPTY_CODEPOINT_COUNT];
+	if (glyph_cache->EmptySlot != TUI_GLYPH_CACHE_NONE && *empty_codepoint == codepoint)
+	{
+		glyph_cache->HitCount++;
+		return glyph_cache->EmptySlot;
+	}
+	glyph_cache->MissCount++;
+
+	// Make sure there is a slot and staging memory for the glyph before rasterizing it.
+	const TuiBoolean evict = (glyph_cache->UsedSlotCount == glyph_cache->SlotCount);
+	if (evict && (glyph_cache->LeastRecentSlot == TUI_GLYPH_CACHE_NONE || glyph_cache->Slots[glyph_cache->LeastRecentSlot].Frame == glyph_cache->Frame))
+	{
+		return TUI_GLYPH_CACHE_NONE;
+	}
+	const size_t cell_size = (size_t)glyph_cache->CellWidth * (size_t)glyph_cache->CellHeight * (size_t)glyph_cache->ChannelCount;
+	if ((size_t)(glyph_cache->DirtyCount + 1) * cell_size > glyph_cache->StagingCapacity)
+	{
+		const size_t staging_capacity = MAX(glyph_cache->StagingCapacity * 2, cell_size * 16);
+		uint8_t* staging_pixels = (uint8_t*)tuiReallocate(glyph_cache->StagingPixels, staging_capacity);
+		if (staging_pixels == NULL)
+		{
+			return TUI_GLYPH_CACHE_NONE;
+		}
+		glyph_cache->StagingPixels = staging_pixels;
+		glyph_cache->StagingCapacity = staging_capacity;
+	}
+	memset(glyph_cache->RasterPixels, 0, cell_size);
+	int width = 0;
+	int height = 0;
+	if (!glyph_cache->RasterizeFunction(glyph_cache->RasterizeUserData, codepoint, glyph_cache->CellWidth, glyph_cache->CellHeight, glyph_cache->ChannelCount, glyph_cache->RasterPixels, &width, &height))
+	{
+		return TUI_GLYPH_CACHE_NONE;
+	}
+
+	// Glyphs with no pixels, like spaces, all share one blank slot instead of taking a slot each.
+	const TuiBoolean empty = (width <= 0 || height <= 0);
+	if (empty && glyph_cache->EmptySlot != TUI_GLYPH_CACHE_NONE)
+	{
+		*empty_codepoint = codepoint;
+		return glyph_cache->EmptySlot;
+	}
+	int slot;
+	if (evict)
+	{
+		slot = glyph_cache->LeastRecentSlot;
+		glyph_cache->EvictionCount++;
+		_tuiGlyphCacheTableRemove(glyph_cache, _tuiGlyphCacheFind(glyph_cache, glyph_cache->Slots[slot].Codepoint));
+		table_i = _tuiGlyphCacheFind(glyph_cache, codepoint);
+		if (empty)
+		{
+			_tuiGlyphCacheUnlink(glyph_cache, slot);
+		}
+		else
+		{
+			_tuiGlyphCacheTouch(glyph_cache, slot, TUI_TRUE);
+		}
+	}
+	else
+	{
+		slot = glyph_cache->UsedSlotCount++;
+		if (!empty)
+		{
+			_tuiGlyphCacheTouch(glyph_cache, slot, TUI_FALSE);
+		}
+	}
+	glyph_cache->Slots[slot].Codepoint = codepoint;
+	if (empty)
+	{
+		// The empty slot is kept out of the table and the eviction list, so it is never evicted.
+		memset(glyph_cache->RasterPixels, 0, cell_size);
+		width = glyph_cache->CellWidth;
+		height = glyph_cache->CellHeight;
+		glyph_cache->EmptySlot = slot;
+		*empty_codepoint = codepoint;
+	}
+	else
+	{
+		glyph_cache->Table[table_i] = slot;
+	}
+
+	// An evicted slot can not already be dirty, because glyphs used since the last clear are never evicted.
+	memcpy(&glyph_cache->StagingPixels[(size_t)glyph_cache->DirtyCount * cell_size], glyph_cache->RasterPixels, cell_size);
+	glyph_cache->DirtySlots[glyph_cache->DirtyCount++] = slot;
+
+	const int cells_per_page = glyph_cache->CellsWide * (glyph_cache->PageHeight / glyph_cache->CellHeight);
+	const int cell = slot % cells_per_page;
+	const int x = (cell % glyph_cache->CellsWide) * glyph_cache->CellWidth;
+	const int y = (cell / glyph_cache->CellsWide) * glyph_cache->CellHeight;
+	width = MIN(width, glyph_cache->CellWidth);
+	height = MIN(height, glyph_cache->CellHeight);
+	float* coordinates = &glyph_cache->StpqpCoordinates[(size_t)slot * TUI_STPQP_COORDINATES_PER_GLYPH];
+	coordinates[0] = (float)x / (float)glyph_cache->PageWidth;
+	coordinates[1] = (float)y / (float)glyph_cache->PageHeight;
+	coordinates[2] = (float)(x + width) / (float)glyph_cache->PageWidth;
+	coordinates[3] = (float)(y + height) / (float)glyph_cache->PageHeight;
+	coordinates[4] = (float)(slot / cells_per_page);
+	return slot;
+}
+
+void tuiGlyphCacheGetDimensions(TuiGlyphCache glyph_cache, int* page_width, int* page_height, int* page_count)
+{
+	assert(glyph_cache != NULL);
+	if (page_width != NULL)
+	{
+		*page_width = glyph_cache->PageWidth;
+	}
+	if (page_height != NULL)
+	{
+		*page_height = glyph_cache->PageHeight;
+	}
+	if (page_count != NULL)
+	{
+		*page_count = glyph_cache->PageCount;
+	}
+}
+
+int tuiGlyphCacheGetSlotCount(TuiGlyphCache glyph_cache)
+{
+	assert(glyph_cache != NULL);
+	return glyph_cache->SlotCount;
+}
+
+const int* tuiGlyphCacheGetDirtyGlyphs(TuiGlyphCache glyph_cache, int* dirty_count)
+{
+	assert(glyph_cache != NULL);
+	assert(dirty_count != NULL);
+	*dirty_count = glyph_cache->DirtyCount;
+	return glyph_cache->DirtySlots;
+}
+
+const uint8_t* tuiGlyphCacheGetDirtyGlyphPixels(TuiGlyphCache glyph_cache)
+{
+	assert(glyph_cache != NULL);
+	return glyph_cache->StagingPixels;
+}
+
+void tuiGlyphCacheClearDirtyGlyphs(TuiGlyphCache glyph_cache)
+{
+	assert(glyph_cache != NULL);
+	glyph_cache->DirtyCount = 0;
+	glyph_cache->Frame++;
+	if (glyph_cache->Frame == 0)
+	{
+		for (int slot = 0; slot < glyph_cache->UsedSlotCount; slot++)
+		{
+			glyph_cache->Slots[slot].Frame = 0;
+		}
+		glyph_cache->Frame = 1;
+	}
+}
+
+const float* tuiGlyphCacheGetStpqpCoordinates(TuiGlyphCache glyph_cache)
+{
+	assert(glyph_cache != NULL);
+	return glyph_cache->StpqpCoordinates;
+}
+
+void tuiGlyphCacheGetStatistics(TuiGlyphCache glyph_cache, size_t* hit_count, size_t* miss_count, size_t* eviction_count)
+{
+	assert(glyph_cache != NULL);
+	if (hit_count != NULL)
+	{
+		*hit_count = glyph_cache->HitCount;
+	}
+	if (miss_count != NULL)
+	{
+		*miss_count = glyph_cache->MissCount;
+	}
+	if (eviction_count != NULL)
+	{
+		*eviction_count = glyph_cache->EvictionCount;
+	}
+}
+
+void tuiGlyphCacheResetStatistics(TuiGlyphCache glyph_cache)
+{
+	assert(glyph_cache != NULL);
+	glyph_cache->HitCount = 0;
+	glyph_cache->MissCount = 0;
+	glyph_cache->EvictionCount = 0;
+}
\ No newline at end of file
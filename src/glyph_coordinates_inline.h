@@ -0,0 +1,42 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef TUIC_GLYPH_COORDINATES_INLINE_H //header guard
+#define TUIC_GLYPH_COORDINATES_INLINE_H
+#include <stddef.h>
+#include <stdint.h>
+
+//Pack the stpqp coordinates of a glyph into four uint32 values: the left and top pixel in the first, the right and bottom pixel in the second, and the page in the third. Shared by the Opengl33 and software backends so both sample the same texels.
+static inline void _tuiPackGlyphCoordinates(size_t page_width, size_t page_height, const float* stpqp_coordinates, uint32_t* packed_coordinates)
+{
+	uint32_t pixels[4];
+	for (int i = 0; i < 4; i++)
+	{
+		const float page_size = (float)((i % 2 == 0) ? page_width : page_height);
+		float pixel = stpqp_coordinates[i] * page_size + 0.5f;
+		pixel = (pixel < 0.0f) ? 0.0f : ((pixel > 65535.0f) ? 65535.0f : pixel);
+		pixels[i] = (uint32_t)pixel;
+	}
+	packed_coordinates[0] = pixels[0] | (pixels[1] << 16);
+	packed_coordinates[1] = pixels[2] | (pixels[3] << 16);
+	packed_coordinates[2] = (uint32_t)stpqp_coordinates[4];
+	packed_coordinates[3] = 0;
+}
+
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/grid_mask.h>
+#include <TUIC/allocation.h>
+#include <TUIC/composite_shape_it.h>
+#include "objects.h"
+#include "math_inline.h"
+
+#include <assert.h>
+#include <string.h>
+
+
+TuiResult tuiGridMaskCreate(TuiGridMask* grid_mask, const int width, const int height)
+{
+	assert(grid_mask != NULL);
+	if (width < 1 || height < 1)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	*grid_mask = (TuiGridMask)tuiAllocate(sizeof(TuiGridMask_s));
+	if (*grid_mask == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	(*grid_mask)->Width = width;
+	(*grid_mask)->Height = height;
+	(*grid_mask)->Data = (uint8_t*)tuiAllocate((size_t)width * (size_t)height);
+	if ((*grid_mask)->Data == NULL)
+	{
+		tuiFree(*grid_mask);
+		*grid_mask = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset((*grid_mask)->Data, 0, (size_t)width * (size_t)height);
+	return TUI_RESULT_OK;
+}
+
+void tuiGridMaskDestroy(TuiGridMask grid_mask)
+{
+	assert(grid_mask != NULL);
+	tuiFree(grid_mask->Data);
+	tuiFree(grid_mask);
+}
+
+void tuiGridMaskGetDimensions(TuiGridMask grid_mask, int* width, int* height)
+{
+	assert(grid_mask != NULL);
+	if (width != NULL)
+	{
+		*width = grid_mask->Width;
+	}
+	if (height != NULL)
+	{
+		*height = grid_mask->Height;
+	}
+}
+
+void tuiGridMaskClear(TuiGridMask grid_mask, const TuiBoolean value)
+{
+	assert(grid_mask != NULL);
+	memset(grid_mask->Data, (value) ? 1 : 0, (size_t)grid_mask->Width * (size_t)grid_mask->Height);
+}
+
+TuiBoolean tuiGridMaskGet(TuiGridMask grid_mask, const int x, const int y)
+{
+	assert(grid_mask != NULL);
+	if (x < 0 || y < 0 || x >= grid_mask->Width || y >= grid_mask->Height)
+	{
+		return TUI_FALSE;
+	}
+	return grid_mask->Data[(size_t)y * (size_t)grid_mask->Width + (size_t)x];
+}
+
+void tuiGridMaskSet(TuiGridMask grid_mask, const int x, const int y, const TuiBoolean value)
+{
+	assert(grid_mask != NULL);
+	if (x < 0 || y < 0 || x >= grid_mask->Width || y >= grid_mask->Height)
+	{
+		return;
+	}
+	grid_mask->Data[(size_t)y * (size_t)grid_mask->Width + (size_t)x] = (value) ? 1 : 0;
+}
+
+void tuiGridMaskSetCompositeShape(TuiGridMask grid_mask, const TuiCompositeShape composite_shape, const TuiBoolean value)
+{
+	assert(grid_mask != NULL);
+	TUI_COMPOSITE_SHAPE_ITERATE_SPANS(composite_shape, it)
+	{
+		const TuiSpan span = tuiCompositeShapeItGetSpan(it);
+		if (span.y < 0 || span.y >= grid_mask->Height) continue;
+		const int left_x = MAX(span.left_x, 0);
+		const int right_x = MIN(span.right_x, grid_mask->Width - 1);
+		if (left_x > right_x) continue;
+		memset(&grid_mask->Data[(size_t)span.y * (size_t)grid_mask->Width + (size_t)left_x], (value) ? 1 : 0, (size_t)(right_x - left_x + 1));
+	}
+}
+
+uint8_t* tuiGridMaskGetData(TuiGridMask grid_mask)
+{
+	assert(grid_mask != NULL);
+	return grid_mask->Data;
+}
\ No newline at end of file
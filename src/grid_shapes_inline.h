@@ -23,6 +23,8 @@
 #include <TUIC/boolean.h>
 #include "math_inline.h"
 #include <stdlib.h> // for abs in mac
+#include <string.h>
+#include <limits.h>
 
 
 // The orientation of three points.
@@ -125,4 +127,350 @@ static inline float _tuiIntPointLineDistance(const int p_x, const int p_y, const
 	}
 }
 
+// Insert the tile span from left_x to right_x into a sorted list of disjoint spans, merging it with every span it overlaps or touches. If the list is full, the span is merged into its closest neighbour instead.
+static inline void _tuiSpanListInsert(int* const span_xs, int* const span_count, const int span_capacity, int left_x, int right_x)
+{
+	int index = 0;
+	while (index < *span_count && span_xs[index * 2 + 1] + 1 < left_x)
+	{
+		index++;
+	}
+	int merge_end = index;
+	while (merge_end < *span_count && span_xs[merge_end * 2] <= right_x + 1)
+	{
+		left_x = MIN(left_x, span_xs[merge_end * 2]);
+		right_x = MAX(right_x, span_xs[merge_end * 2 + 1]);
+		merge_end++;
+	}
+	const int merge_count = merge_end - index;
+	if (merge_count == 0 && *span_count == span_capacity)
+	{
+		const int neighbour_index = (index == *span_count) ? index - 1 : index;
+		span_xs[neighbour_index * 2] = MIN(left_x, span_xs[neighbour_index * 2]);
+		span_xs[neighbour_index * 2 + 1] = MAX(right_x, span_xs[neighbour_index * 2 + 1]);
+		return;
+	}
+	if (merge_count == 0)
+	{
+		for (int move_index = *span_count; move_index > index; move_index--)
+		{
+			span_xs[move_index * 2] = span_xs[move_index * 2 - 2];
+			span_xs[move_index * 2 + 1] = span_xs[move_index * 2 - 1];
+		}
+		(*span_count)++;
+	}
+	else if (merge_count > 1)
+	{
+		const int removed_count = merge_count - 1;
+		for (int move_index = index + 1; move_index + removed_count < *span_count; move_index++)
+		{
+			span_xs[move_index * 2] = span_xs[(move_index + removed_count) * 2];
+			span_xs[move_index * 2 + 1] = span_xs[(move_index + removed_count) * 2 + 1];
+		}
+		*span_count -= removed_count;
+	}
+	span_xs[index * 2] = left_x;
+	span_xs[index * 2 + 1] = right_x;
+}
+// Get if two sorted lists of disjoint spans on the same row share any tile.
+static inline TuiBoolean _tuiSpanListsOverlap(const int* const span_xs_1, const int span_count_1, const int* const span_xs_2, const int span_count_2)
+{
+	int index_1 = 0;
+	int index_2 = 0;
+	while (index_1 < span_count_1 && index_2 < span_count_2)
+	{
+		const int left_x_1 = span_xs_1[index_1 * 2];
+		const int right_x_1 = span_xs_1[index_1 * 2 + 1];
+		const int left_x_2 = span_xs_2[index_2 * 2];
+		const int right_x_2 = span_xs_2[index_2 * 2 + 1];
+		if (left_x_1 <= right_x_2 && left_x_2 <= right_x_1) return TUI_TRUE;
+		if (right_x_1 < right_x_2)
+		{
+			index_1++;
+		}
+		else
+		{
+			index_2++;
+		}
+	}
+	return TUI_FALSE;
+}
+// Get if a polygon has vertices and no more than the maximum amount of them.
+static inline TuiBoolean _tuiPolygonIsValid(const TuiPoint2* const points, const int point_count)
+{
+	return (points != TUI_NULL && point_count > 0 && point_count <= TUI_POLYGON_MAX_POINT_COUNT);
+}
+// Get the sorted disjoint spans of a polygon on a row in a single pass over its edges. A tile is in the polygon if its position is inside of or on the border of the polygon. Returns the span count, which is at most TUI_POLYGON_IT_MAX_ROW_SPANS for a valid polygon.
+static inline int _tuiPolygonGetRowSpans(const TuiPoint2* const points, const int point_count, const int y, int* const span_xs, const int span_capacity)
+{
+	if (!_tuiPolygonIsValid(points, point_count)) return 0;
+	double crossings[TUI_POLYGON_MAX_POINT_COUNT]; // every edge crosses a row at most once
+	int crossing_count = 0;
+	int span_count = 0;
+	for (int point_i = 0; point_i < point_count; point_i++)
+	{
+		const TuiPoint2 edge_start = points[point_i];
+		const TuiPoint2 edge_end = points[(point_i + 1 == point_count) ? 0 : point_i + 1];
+		if (edge_start.y == y)
+		{
+			const int border_left_x = (edge_end.y == y) ? MIN(edge_start.x, edge_end.x) : edge_start.x;
+			const int border_right_x = (edge_end.y == y) ? MAX(edge_start.x, edge_end.x) : edge_start.x;
+			_tuiSpanListInsert(span_xs, &span_count, span_capacity, border_left_x, border_right_x);
+		}
+		const TuiBoolean edge_crosses_row = (edge_start.y <= y && y < edge_end.y) || (edge_end.y <= y && y < edge_start.y); // half open so shared vertices are only counted once
+		if (edge_crosses_row)
+		{
+			const double crossing_x = (double)edge_start.x + (double)(y - edge_start.y) * (double)(edge_end.x - edge_start.x) / (double)(edge_end.y - edge_start.y);
+			int insert_index = crossing_count++;
+			while (insert_index > 0 && crossings[insert_index - 1] > crossing_x)
+			{
+				crossings[insert_index] = crossings[insert_index - 1];
+				insert_index--;
+			}
+			crossings[insert_index] = crossing_x;
+		}
+	}
+	for (int crossing_i = 0; crossing_i + 1 < crossing_count; crossing_i += 2) // even odd fill rule
+	{
+		const int inside_left_x = (int)ceil(crossings[crossing_i]);
+		const int inside_right_x = (int)floor(crossings[crossing_i + 1]);
+		if (inside_left_x <= inside_right_x)
+		{
+			_tuiSpanListInsert(span_xs, &span_count, span_capacity, inside_left_x, inside_right_x);
+		}
+	}
+	return span_count;
+}
+// Get the span of an ellipse on a row. Returns if the row has a span.
+static inline TuiBoolean _tuiEllipseGetRowSpan(const int center_x, const int center_y, const float radius_x, const float radius_y, const int y, int* const left_x, int* const right_x)
+{
+	const float abs_radius_x = fabsf(radius_x);
+	const float abs_radius_y = fabsf(radius_y);
+	if (abs_radius_x < 0.5f || abs_radius_y < 0.5f) return TUI_FALSE;
+	const float row_y_ratio = (float)(y - center_y) / abs_radius_y;
+	const float row_x_ratio_squared = 1.0f - row_y_ratio * row_y_ratio; // ellipse equation
+	if (row_x_ratio_squared < 0.0f) return TUI_FALSE;
+	const int row_x_distance = (int)floorf(abs_radius_x * sqrtf(row_x_ratio_squared));
+	*left_x = center_x - row_x_distance;
+	*right_x = center_x + row_x_distance;
+	return TUI_TRUE;
+}
+// Get the span of a circle on a row the same way a circle iterator does. Returns if the row has a span.
+static inline TuiBoolean _tuiCircleGetRowSpan(const int center_x, const int center_y, const float radius, const int y, int* const left_x, int* const right_x)
+{
+	const int abs_rounded_radius = (int)roundf(fabsf(radius));
+	if (y < center_y - abs_rounded_radius || y > center_y + abs_rounded_radius) return TUI_FALSE;
+	const float row_y_distance = (float)(y - center_y);
+	const float row_x_distance_squared = radius * radius - row_y_distance * row_y_distance;
+	if (row_x_distance_squared < 0.0f) return TUI_FALSE;
+	const float row_x_distance = sqrtf(row_x_distance_squared); // pythagorean theorem
+	*left_x = center_x - (int)ceilf(row_x_distance);
+	*right_x = center_x + (int)floorf(row_x_distance);
+	return TUI_TRUE;
+}
+// Get if a tile is covered after combining its coverage in two shapes with a shape operation.
+static inline TuiBoolean _tuiShapeOperationApply(const TuiShapeOperation shape_operation, const TuiBoolean in_shape_1, const TuiBoolean in_shape_2)
+{
+	switch (shape_operation)
+	{
+	case TUI_SHAPE_OPERATION_UNION:
+		return in_shape_1 || in_shape_2;
+	case TUI_SHAPE_OPERATION_INTERSECTION:
+		return in_shape_1 && in_shape_2;
+	case TUI_SHAPE_OPERATION_DIFFERENCE:
+		return in_shape_1 && !in_shape_2;
+	case TUI_SHAPE_OPERATION_XOR:
+		return in_shape_1 != in_shape_2;
+	default:
+		return in_shape_1;
+	}
+}
+// Combine two sorted lists of disjoint spans on the same row with a shape operation in a single merge pass. The result is sorted and disjoint. If the result is full, the remaining tiles are merged into its last span. Returns the span count.
+static inline int _tuiSpanListsCombine(const int* const span_xs_1, const int span_count_1, const int* const span_xs_2, const int span_count_2, const TuiShapeOperation shape_operation, int* const out_span_xs, const int out_span_capacity)
+{
+	int index_1 = 0;
+	int index_2 = 0;
+	TuiBoolean in_shape_1 = TUI_FALSE;
+	TuiBoolean in_shape_2 = TUI_FALSE;
+	TuiBoolean was_covered = TUI_FALSE;
+	int span_left_x = 0;
+	int out_span_count = 0;
+	while (index_1 < span_count_1 || index_2 < span_count_2)
+	{
+		// each span is half open here, so it enters at its left x and leaves one past its right x
+		const int event_x_1 = (index_1 == span_count_1) ? INT_MAX : ((in_shape_1) ? span_xs_1[index_1 * 2 + 1] + 1 : span_xs_1[index_1 * 2]);
+		const int event_x_2 = (index_2 == span_count_2) ? INT_MAX : ((in_shape_2) ? span_xs_2[index_2 * 2 + 1] + 1 : span_xs_2[index_2 * 2]);
+		const int event_x = MIN(event_x_1, event_x_2);
+		if (event_x_1 == event_x)
+		{
+			if (in_shape_1) index_1++;
+			in_shape_1 = !in_shape_1;
+		}
+		if (event_x_2 == event_x)
+		{
+			if (in_shape_2) index_2++;
+			in_shape_2 = !in_shape_2;
+		}
+		const TuiBoolean is_covered = _tuiShapeOperationApply(shape_operation, in_shape_1, in_shape_2);
+		if (is_covered && !was_covered)
+		{
+			span_left_x = event_x;
+		}
+		else if (!is_covered && was_covered)
+		{
+			if (out_span_count < out_span_capacity)
+			{
+				out_span_xs[out_span_count * 2] = span_left_x;
+				out_span_count++;
+			}
+			out_span_xs[out_span_count * 2 - 1] = event_x - 1;
+		}
+		was_covered = is_covered;
+	}
+	return out_span_count;
+}
+// Remove every tile outside of the columns from left_x to right_x from a sorted list of disjoint spans. Returns the new span count.
+static inline int _tuiSpanListClip(int* const span_xs, const int span_count, const int left_x, const int right_x)
+{
+	int clipped_span_count = 0;
+	for (int span_i = 0; span_i < span_count; span_i++)
+	{
+		const int clipped_left_x = MAX(span_xs[span_i * 2], left_x);
+		const int clipped_right_x = MIN(span_xs[span_i * 2 + 1], right_x);
+		if (clipped_left_x <= clipped_right_x)
+		{
+			span_xs[clipped_span_count * 2] = clipped_left_x;
+			span_xs[clipped_span_count * 2 + 1] = clipped_right_x;
+			clipped_span_count++;
+		}
+	}
+	return clipped_span_count;
+}
+// Get the spans of a rect on a row. Returns the span count.
+static inline int _tuiRectGetRowSpans(const TuiRect rect, const int y, int* const span_xs)
+{
+	if (rect.width == 0 || rect.height == 0) return 0;
+	if (y < rect.y || y > rect.y + abs(rect.height) - 1) return 0;
+	span_xs[0] = rect.x;
+	span_xs[1] = rect.x + abs(rect.width) - 1;
+	return 1;
+}
+// Get the spans of a box on a row. Rows within the border depth of the top or bottom are solid, every other row has a span on each side. Returns the span count.
+static inline int _tuiBoxGetRowSpans(const TuiBox box, const int y, int* const span_xs)
+{
+	if (box.width == 0 || box.height == 0 || box.depth == 0) return 0;
+	const int abs_depth = abs(box.depth);
+	const int right_x = box.x + abs(box.width) - 1;
+	const int bottom_y = box.y + abs(box.height) - 1;
+	if (y < box.y || y > bottom_y) return 0;
+	span_xs[0] = box.x;
+	span_xs[1] = right_x;
+	const TuiBoolean solid_row = (y < box.y + abs_depth || y > bottom_y - abs_depth || box.x + abs_depth > right_x - abs_depth);
+	if (solid_row) return 1;
+	span_xs[1] = box.x + abs_depth - 1;
+	span_xs[2] = right_x - abs_depth + 1;
+	span_xs[3] = right_x;
+	return 2;
+}
+// Get the spans of a ring on a row as the row span of its outer circle minus the row span of its inner circle. Returns the span count.
+static inline int _tuiRingGetRowSpans(const TuiRing ring, const int y, int* const span_xs)
+{
+	const float abs_radius = fabsf(ring.radius);
+	const float abs_depth = fabsf(ring.depth);
+	if (abs_radius < 0.5f || abs_depth < 0.5f || abs_radius < abs_depth) return 0;
+	int outer_left_x, outer_right_x;
+	if (!_tuiCircleGetRowSpan(ring.center_x, ring.center_y, abs_radius, y, &outer_left_x, &outer_right_x)) return 0;
+	const float inner_radius = abs_radius - abs_depth;
+	int inner_left_x, inner_right_x;
+	if (inner_radius < 0.5f || !_tuiCircleGetRowSpan(ring.center_x, ring.center_y, inner_radius, y, &inner_left_x, &inner_right_x))
+	{
+		span_xs[0] = outer_left_x;
+		span_xs[1] = outer_right_x;
+		return 1;
+	}
+	int span_count = 0;
+	if (outer_left_x < inner_left_x)
+	{
+		span_xs[span_count * 2] = outer_left_x;
+		span_xs[span_count * 2 + 1] = inner_left_x - 1;
+		span_count++;
+	}
+	if (inner_right_x < outer_right_x)
+	{
+		span_xs[span_count * 2] = inner_right_x + 1;
+		span_xs[span_count * 2 + 1] = outer_right_x;
+		span_count++;
+	}
+	return span_count;
+}
+// Get the sorted disjoint spans of any grid shape on a row. The span capacity must be at least 2. Returns the span count.
+static inline int _tuiShapeGetRowSpans(const TuiShape* const shape, const int y, int* const span_xs, const int span_capacity)
+{
+	int span_count = 0;
+	switch (shape->type)
+	{
+	case TUI_SHAPE_TYPE_RECT:
+		return _tuiRectGetRowSpans(shape->rect, y, span_xs);
+	case TUI_SHAPE_TYPE_BOX:
+		return _tuiBoxGetRowSpans(shape->box, y, span_xs);
+	case TUI_SHAPE_TYPE_CROP_BOX:
+	{
+		const TuiCropBox crop_box = shape->crop_box;
+		const TuiRect crop_rect = { crop_box.crop_x, crop_box.crop_y, crop_box.crop_width, crop_box.crop_height };
+		int crop_span_xs[2];
+		if (_tuiRectGetRowSpans(crop_rect, y, crop_span_xs) == 0) return 0;
+		const TuiBox box = { crop_box.x, crop_box.y, crop_box.width, crop_box.height, crop_box.depth };
+		span_count = _tuiBoxGetRowSpans(box, y, span_xs);
+		return _tuiSpanListClip(span_xs, span_count, crop_span_xs[0], crop_span_xs[1]);
+	}
+	case TUI_SHAPE_TYPE_CIRCLE:
+		if (fabsf(shape->circle.radius) <= 0.5f) return 0;
+		return (_tuiCircleGetRowSpan(shape->circle.center_x, shape->circle.center_y, shape->circle.radius, y, &span_xs[0], &span_xs[1])) ? 1 : 0;
+	case TUI_SHAPE_TYPE_CROP_CIRCLE:
+	{
+		const TuiCropCircle crop_circle = shape->crop_circle;
+		const TuiRect crop_rect = { crop_circle.crop_x, crop_circle.crop_y, crop_circle.crop_width, crop_circle.crop_height };
+		int crop_span_xs[2];
+		if (_tuiRectGetRowSpans(crop_rect, y, crop_span_xs) == 0) return 0;
+		if (fabsf(crop_circle.radius) <= 0.5f) return 0;
+		span_count = (_tuiCircleGetRowSpan(crop_circle.center_x, crop_circle.center_y, crop_circle.radius, y, &span_xs[0], &span_xs[1])) ? 1 : 0;
+		return _tuiSpanListClip(span_xs, span_count, crop_span_xs[0], crop_span_xs[1]);
+	}
+	case TUI_SHAPE_TYPE_RING:
+		return _tuiRingGetRowSpans(shape->ring, y, span_xs);
+	case TUI_SHAPE_TYPE_CROP_RING:
+	{
+		const TuiCropRing crop_ring = shape->crop_ring;
+		const TuiRect crop_rect = { crop_ring.crop_x, crop_ring.crop_y, crop_ring.crop_width, crop_ring.crop_height };
+		int crop_span_xs[2];
+		if (_tuiRectGetRowSpans(crop_rect, y, crop_span_xs) == 0) return 0;
+		const TuiRing ring = { crop_ring.center_x, crop_ring.center_y, crop_ring.radius, crop_ring.depth };
+		span_count = _tuiRingGetRowSpans(ring, y, span_xs);
+		return _tuiSpanListClip(span_xs, span_count, crop_span_xs[0], crop_span_xs[1]);
+	}
+	case TUI_SHAPE_TYPE_POLYGON:
+		return _tuiPolygonGetRowSpans(shape->polygon.points, shape->polygon.point_count, y, span_xs, span_capacity);
+	case TUI_SHAPE_TYPE_ELLIPSE:
+		return (_tuiEllipseGetRowSpan(shape->ellipse.center_x, shape->ellipse.center_y, shape->ellipse.radius_x, shape->ellipse.radius_y, y, &span_xs[0], &span_xs[1])) ? 1 : 0;
+	default:
+		return 0;
+	}
+}
+// Get the sorted disjoint spans of a composite shape on a row by folding the row spans of each shape into the result from left to right. Returns the span count.
+static inline int _tuiCompositeShapeGetRowSpans(const TuiShape* const shapes, const TuiShapeOperation* const operations, const int shape_count, const int y, int* const span_xs)
+{
+	if (shapes == TUI_NULL || shape_count <= 0) return 0;
+	int shape_span_xs[TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS * 2];
+	int combined_span_xs[TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS * 2];
+	int span_count = _tuiShapeGetRowSpans(&shapes[0], y, span_xs, TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS);
+	for (int shape_i = 1; shape_i < shape_count; shape_i++)
+	{
+		const TuiShapeOperation shape_operation = operations[shape_i - 1];
+		if (span_count == 0 && shape_operation != TUI_SHAPE_OPERATION_UNION && shape_operation != TUI_SHAPE_OPERATION_XOR) continue;
+		const int shape_span_count = _tuiShapeGetRowSpans(&shapes[shape_i], y, shape_span_xs, TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS);
+		span_count = _tuiSpanListsCombine(span_xs, span_count, shape_span_xs, shape_span_count, shape_operation, combined_span_xs, TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS);
+		memcpy(span_xs, combined_span_xs, sizeof(int) * 2 * (size_t)span_count);
+	}
+	return span_count;
+}
 #endif //header guard
\ No newline at end of file
@@ -28,6 +28,9 @@ extern "C" {
 #include <TUIC/types.h>
 #include <GLFW/glfw3.h>
 #include <TUIC/desktop_callback.h>
+#include <TUIC/glyph_metrics.h>
+#include <TUIC/glyph_cache.h>
+#include <TUIC/graphics_backend.h>
 
 typedef struct TuiSystem_s
 {
@@ -37,6 +40,10 @@ typedef struct TuiSystem_s
 
 	tuiMonitorConnectedFunction MonitorConnectedCallback;
 
+	TuiGraphicsBackend GraphicsBackend;
+
+	TuiBoolean Headless;
+
 	void* ApiData;
 } TuiSystem_s;
 
@@ -44,6 +51,9 @@ typedef TuiSystem_s* TuiSystem;
 
 TuiSystem tui_get_system();
 
+// Get if TUIC is initialized with TUI_GRAPHICS_BACKEND_SOFTWARE, so panels, textures and atlases go to the *_Software functions instead of the *_Opengl33 ones.
+TuiBoolean tui_is_software_backend();
+
 typedef struct TuiWindow_s
 {
 	void* UserPointer;
@@ -123,9 +133,225 @@ typedef struct TuiAtlas_s
 
 	size_t GlyphCount;
 
+	int GridColumns;
+
+	int GridRows;
+
+	TuiBoolean DistanceField;
+
+	TuiGlyphMetrics* GlyphMetrics;
+
+	int KerningPairCount;
+
+	uint32_t* KerningKeys;
+
+	int* KerningAdjustments;
+
+	uint32_t MetricsVersion;
+
+	char* Label;
+
 	void* ApiData;
 } TuiAtlas_s;
 
+typedef struct TuiAtlasBuilderGlyph
+{
+	int Width;
+
+	int Height;
+
+	size_t PixelOffset;
+
+	int PageX;
+
+	int PageY;
+
+	int Page;
+} TuiAtlasBuilderGlyph;
+
+typedef struct TuiAtlasBuilder_s
+{
+	int PageWidth;
+
+	int PageHeight;
+
+	int ChannelCount;
+
+	int Padding;
+
+	int GlyphCount;
+
+	int GlyphCapacity;
+
+	TuiAtlasBuilderGlyph* Glyphs;
+
+	size_t GlyphPixelsSize;
+
+	size_t GlyphPixelsCapacity;
+
+	uint8_t* GlyphPixels;
+
+	int PageCount;
+
+	uint8_t* PixelData;
+
+	float* StpqpCoordinates;
+} TuiAtlasBuilder_s;
+
+typedef struct TuiAtlasCache_s
+{
+	const uint8_t* MappedData;
+
+	size_t MappedSize;
+
+	void* MappingHandle;
+
+	int Width;
+
+	int Height;
+
+	int Pages;
+
+	int ChannelCount;
+
+	int GlyphCount;
+
+	const uint8_t* PixelData;
+
+	const float* StpqpCoordinates;
+} TuiAtlasCache_s;
+
+typedef struct TuiGlyphCacheSlot
+{
+	uint32_t Codepoint;
+
+	uint32_t Frame;
+
+	int Previous;
+
+	int Next;
+} TuiGlyphCacheSlot;
+
+// Codepoints remembered as rasterizing to an empty glyph, so they are not rasterized again on every lookup.
+#define TUI_GLYPH_CACHE_EMPTY_CODEPOINT_COUNT 64
+
+typedef struct TuiGlyphCache_s
+{
+	int PageWidth;
+
+	int PageHeight;
+
+	int PageCount;
+
+	int CellWidth;
+
+	int CellHeight;
+
+	int ChannelCount;
+
+	int CellsWide;
+
+	int SlotCount;
+
+	int UsedSlotCount;
+
+	TuiGlyphCacheSlot* Slots;
+
+	int MostRecentSlot;
+
+	int LeastRecentSlot;
+
+	int* Table;
+
+	uint32_t TableMask;
+
+	float* StpqpCoordinates;
+
+	int DirtyCount;
+
+	int* DirtySlots;
+
+	size_t StagingCapacity;
+
+	uint8_t* StagingPixels;
+
+	uint8_t* RasterPixels;
+
+	uint32_t Frame;
+
+	tuiGlyphRasterizeFunction RasterizeFunction;
+
+	void* RasterizeUserData;
+
+	size_t HitCount;
+
+	size_t MissCount;
+
+	size_t EvictionCount;
+
+	int EmptySlot;
+
+	uint32_t EmptyCodepoints[TUI_GLYPH_CACHE_EMPTY_CODEPOINT_COUNT];
+} TuiGlyphCache_s;
+
+typedef struct TuiTextRunCacheEntry
+{
+	uint64_t Hash;
+
+	TuiAtlas Atlas;
+
+	uint32_t MetricsVersion;
+
+	int GlyphCount;
+
+	int Width;
+
+	uint16_t* Glyphs;
+
+	int GlyphCapacity;
+} TuiTextRunCacheEntry;
+
+typedef struct TuiTextRunCache_s
+{
+	TuiTextRunCacheEntry* Entries;
+
+	int EntryMask;
+
+	size_t HitCount;
+
+	size_t MissCount;
+} TuiTextRunCache_s;
+
+typedef struct TuiBitmapFont_s
+{
+	int GlyphWidth;
+
+	int GlyphHeight;
+
+	int GlyphCount;
+
+	int RowSize;
+
+	uint8_t* GlyphBits;
+
+	int MappingCount;
+
+	uint32_t* MappedCodepoints;
+
+	int* MappedGlyphs;
+} TuiBitmapFont_s;
+
+typedef struct TuiTrueTypeFont_s
+{
+	void* FontInfo;
+
+	float Scale;
+
+	int Ascent;
+
+	float DistanceFieldSpread;
+} TuiTrueTypeFont_s;
+
 typedef struct TuiTexture_s
 {
 
@@ -145,9 +371,138 @@ typedef struct TuiPanel_s
 
 	size_t PixelHeight;
 
+	TuiBoolean DepthStencil;
+
+	char* Label;
+
 	void* ApiData;
 } TuiPanel_s;
 
+typedef enum TuiDrawCommandType
+{
+	TUI_DRAW_COMMAND_CONSOLE,
+	TUI_DRAW_COMMAND_PANEL,
+	TUI_DRAW_COMMAND_TEXTURE,
+	TUI_DRAW_COMMAND_WINDOW
+} TuiDrawCommandType;
+
+typedef struct TuiDrawCommand
+{
+	TuiDrawCommandType Type;
+
+	TuiPanel Target;
+
+	TuiAtlas Atlas;
+
+	TuiConsole Console;
+
+	TuiPanel SubjectPanel;
+
+	TuiTexture Texture;
+
+	TuiWindow Window;
+
+	int LeftX;
+
+	int RightX;
+
+	int TopY;
+
+	int BottomY;
+
+	int Pass;
+
+	int TargetOrder;
+
+	int Sequence;
+} TuiDrawCommand;
+
+typedef struct TuiDrawListTarget
+{
+	TuiPanel Panel;
+
+	int LastWritePass;
+
+	int LastReadPass;
+} TuiDrawListTarget;
+
+typedef struct TuiDrawList_s
+{
+	TuiDrawCommand* Commands;
+
+	int CommandCount;
+
+	int CommandCapacity;
+
+	TuiDrawCommand* SortedCommands;
+
+	TuiDrawListTarget* Targets;
+
+	int SortedCapacity;
+} TuiDrawList_s;
+
+typedef struct TuiPixelReadback_s
+{
+	int PixelWidth;
+
+	int PixelHeight;
+
+	TuiBoolean Captured;
+
+	TuiBoolean Pending;
+
+	TuiBoolean Mapped;
+
+	void* ApiData;
+} TuiPixelReadback_s;
+
+typedef struct TuiGridMask_s
+{
+	int Width;
+
+	int Height;
+
+	uint8_t* Data;
+} TuiGridMask_s;
+
+typedef struct TuiPathNode
+{
+	int32_t Cost;
+
+	int32_t Priority;
+
+	int32_t Parent;
+
+	int32_t Next;
+
+	int32_t Previous;
+
+	uint32_t Generation;
+
+	uint8_t Closed;
+} TuiPathNode;
+
+typedef struct TuiPathfinder_s
+{
+	int Width;
+
+	int Height;
+
+	TuiPathNode* Nodes;
+
+	int32_t* BucketHeads;
+
+	int32_t BucketMask;
+
+	int32_t CurrentPriority;
+
+	int QueuedCount;
+
+	uint32_t Generation;
+
+	int32_t LastPathCost;
+} TuiPathfinder_s;
+
 typedef struct TuiConsole_s
 {
 	size_t PixelWidth;
@@ -169,6 +524,8 @@ typedef struct TuiConsole_s
     size_t TileDataCount;
 	
     uint8_t* TileData;
+
+    char* Label;
 } TuiConsole_s;
 
 #ifdef __cplusplus // extern C guard
@@ -40,9 +40,14 @@ TuiErrorCode tuiWindowDrawWindow_Opengl33(TuiWindow window, TuiWindow subject_wi
 TuiErrorCode tuiWindowRender_Opengl33(TuiWindow window);
 TuiErrorCode tuiAtlasCreate_Opengl33(TuiAtlas atlas, const uint8_t* const pixel_data, const float* const stpqp_coordinates);
 TuiErrorCode tuiAtlasDestroy_Opengl33(TuiAtlas atlas);
+TuiResult tuiAtlasCreateGlyphCache_Opengl33(TuiAtlas atlas, const float* stpqp_coordinates);
+TuiResult tuiAtlasUpdateGlyph_Opengl33(TuiAtlas atlas, int glyph_index, int page, int x, int y, int cell_width, int cell_height, const uint8_t* pixels, const float* stpqp_coordinates);
+TuiResult tuiAtlasSetDistanceField_Opengl33(TuiAtlas atlas, TuiBoolean distance_field);
+TuiResult tuiAtlasSetLabel_Opengl33(TuiAtlas atlas);
 TuiErrorCode tuiTextureCreate_Opengl33(TuiTexture texture, const uint8_t* pixels);
 TuiErrorCode tuiTextureDestroy_Opengl33(TuiTexture texture);
 TuiErrorCode tuiTextureSetPixels_Opengl33(TuiTexture texture, size_t pixel_width, size_t pixel_height, size_t channel_count, const uint8_t* pixels);
+TuiResult tuiTextureUpdateRegion_Opengl33(TuiTexture texture, const uint8_t* pixels, int x, int y, int width, int height, size_t row_pitch);
 TuiErrorCode tuiPaletteCreate_Opengl33(TuiPalette palette, const uint8_t* color_data);
 TuiErrorCode tuiPaletteDestroy_Opengl33(TuiPalette palette);
 TuiErrorCode tuiPanelCreate_Opengl33(TuiPanel panel);
@@ -55,6 +60,26 @@ TuiErrorCode tuiPanelDrawTexture_Opengl33(TuiPanel panel, TuiTexture texture, in
 TuiErrorCode tuiPanelDrawAtlas_Opengl33(TuiPanel panel, TuiAtlas atlas, int left_x, int right_x, int top_y, int bottom_y);
 TuiErrorCode tuiPanelDrawWindow_Opengl33(TuiPanel panel, TuiWindow window, int left_x, int right_x, int top_y, int bottom_y);
 TuiErrorCode tuiPanelSetSize_Opengl33(TuiPanel panel, size_t new_width, size_t new_height);
+TuiResult tuiPanelSetDepthStencil_Opengl33(TuiPanel panel, TuiBoolean depth_stencil);
+TuiResult tuiPanelSetLabel_Opengl33(TuiPanel panel);
+TuiResult tuiPanelDrawCommands_Opengl33(TuiPanel panel, const struct TuiDrawCommand* commands, int command_count);
+TuiResult tuiPanelDrawConsoles_Opengl33(TuiPanel panel, const struct TuiConsoleDraw* draws, int draw_count);
+TuiResult tuiPixelReadbackCreate_Opengl33(TuiPixelReadback pixel_readback);
+void tuiPixelReadbackDestroy_Opengl33(TuiPixelReadback pixel_readback);
+TuiResult tuiPixelReadbackCapturePanel_Opengl33(TuiPixelReadback pixel_readback, TuiPanel panel);
+TuiResult tuiPixelReadbackCaptureWindow_Opengl33(TuiPixelReadback pixel_readback, TuiWindow window);
+TuiBoolean tuiPixelReadbackPoll_Opengl33(TuiPixelReadback pixel_readback, TuiBoolean wait);
+TuiResult tuiPixelReadbackMap_Opengl33(TuiPixelReadback pixel_readback, const uint8_t** pixels);
+void tuiPixelReadbackUnmap_Opengl33(TuiPixelReadback pixel_readback);
+void tuiSystemGetStateStatistics_Opengl33(size_t* issued_call_count, size_t* skipped_call_count);
+void tuiSystemResetStateStatistics_Opengl33();
+TuiResult tuiSystemSetValidation_Opengl33(TuiGraphicsValidation validation);
+TuiGraphicsValidation tuiSystemGetValidation_Opengl33();
+void tuiSystemSetDebugMessageCallback_Opengl33(tuiGraphicsDebugMessageFunction callback);
+void tuiFrameTimingSetEnabled_Opengl33(TuiBoolean enabled);
+TuiBoolean tuiFrameTimingIsEnabled_Opengl33();
+TuiBoolean tuiFrameTimingGetStats_Opengl33(TuiFrameStats* stats);
+void tuiFrameTimingSetCallback_Opengl33(tuiDrawTimingFunction callback);
 #ifdef __cplusplus //extern C guard
 }
 #endif
@@ -21,10 +21,12 @@
 #include "objects.h"
 #include "image_inline.h"
 #include "opengl33.h"
+#include "software.h"
 #include "glfw_error_check.h"
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <assert.h>
 
 static size_t sPanelCount = 0;
@@ -45,7 +47,8 @@ TuiResult tuiPanelCreate(TuiPanel* panel, int pixel_width, int pixel_height)
 	memset(*panel, 0, sizeof(TuiPanel_s));
 	(*panel)->PixelWidth = pixel_width;
 	(*panel)->PixelHeight = pixel_height;
-	TuiResult result = tuiPanelCreate_Opengl33((*panel), pixel_width, pixel_height);
+	(*panel)->DepthStencil = TUI_TRUE;
+	TuiResult result = tui_is_software_backend() ? tuiPanelCreate_Software(*panel) : tuiPanelCreate_Opengl33((*panel), pixel_width, pixel_height);
 	if (result != TUI_RESULT_OK)
 	{
 		tuiFree(*panel);
@@ -59,7 +62,18 @@ TuiResult tuiPanelCreate(TuiPanel* panel, int pixel_width, int pixel_height)
 void tuiPanelDestroy(TuiPanel panel)
 {
 	assert(panel != NULL);
-	tuiPanelDestroy_Opengl33(panel);
+	if (tui_is_software_backend())
+	{
+		tuiPanelDestroy_Software(panel);
+	}
+	else
+	{
+		tuiPanelDestroy_Opengl33(panel);
+	}
+	if (panel->Label != NULL)
+	{
+		tuiFree(panel->Label);
+	}
 	tuiFree(panel);
 	sPanelCount--;
 }
@@ -69,6 +83,10 @@ TuiResult tuiPanelGetPixels(TuiPanel panel, uint8_t** pixels, int* pixel_width,
 	assert(panel != NULL);
 	assert(pixels != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelGetPixels_Software(panel, pixels, pixel_width, pixel_height);
+	}
 	return tuPanelGetPixels_Opengl33(panel, pixels, pixel_width, pixel_height);
 }
 
@@ -76,6 +94,10 @@ TuiResult tuiPanelClearColor(TuiPanel panel, uint8_t r, uint8_t g, uint8_t b, ui
 {
 	assert(panel != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelClearColor_Software(panel, r, g, b, a);
+	}
 	return tuiPanelClearColor_Opengl33(panel, r, g, b, a);
 }
 
@@ -83,6 +105,10 @@ TuiResult tuiPanelSetPixelDimensions(TuiPanel panel, int pixel_width, int pixel_
 {
 	assert(panel != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelSetPixelDimensions_Software(panel, pixel_width, pixel_height);
+	}
 	return tuiPanelSetPixelDimensions_Opengl33(panel, pixel_width, pixel_height);
 }
 
@@ -100,12 +126,75 @@ void tuiPanelGetPixelDimensions(TuiPanel panel, int* pixel_width, int* pixel_hei
 	}
 }
 
+TuiResult tuiPanelSetDepthStencil(TuiPanel panel, TuiBoolean depth_stencil)
+{
+	assert(panel != NULL);
+
+	depth_stencil = (depth_stencil != TUI_FALSE) ? TUI_TRUE : TUI_FALSE;
+	if (panel->DepthStencil == depth_stencil)
+	{
+		return TUI_RESULT_OK;
+	}
+	// Software panels are never drawn with depth or stencil tests, so only the flag changes.
+	TuiResult result = tui_is_software_backend() ? TUI_RESULT_OK : tuiPanelSetDepthStencil_Opengl33(panel, depth_stencil);
+	if (result != TUI_RESULT_OK)
+	{
+		return result;
+	}
+	panel->DepthStencil = depth_stencil;
+	return TUI_RESULT_OK;
+}
+
+TuiBoolean tuiPanelHasDepthStencil(TuiPanel panel)
+{
+	assert(panel != NULL);
+
+	return panel->DepthStencil;
+}
+
+TuiResult tuiPanelSetLabel(TuiPanel panel, const char* label)
+{
+	assert(panel != NULL);
+
+	char* label_copy = NULL;
+	if (label != NULL)
+	{
+		label_copy = (char*)tuiAllocate((strlen(label) + 1) * sizeof(char));
+		if (label_copy == NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		strcpy(label_copy, label);
+	}
+	if (panel->Label != NULL)
+	{
+		tuiFree(panel->Label);
+	}
+	panel->Label = label_copy;
+	if (tui_is_software_backend())
+	{
+		return TUI_RESULT_OK;
+	}
+	return tuiPanelSetLabel_Opengl33(panel);
+}
+
+const char* tuiPanelGetLabel(TuiPanel panel)
+{
+	assert(panel != NULL);
+
+	return panel->Label;
+}
+
 TuiResult tuiPanelDrawConsole(TuiPanel panel, TuiAtlas atlas, TuiConsole console)
 {
 	assert(panel != NULL);
 	assert(atlas != NULL);
 	assert(console != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelDrawConsole_Software(panel, atlas, console, 0, panel->PixelWidth, 0, panel->PixelHeight);
+	}
 	return tuiPanelDrawConsole_Opengl33(panel, atlas, console, 0, panel->PixelWidth, 0, panel->PixelHeight);
 }
 
@@ -115,14 +204,57 @@ TuiResult tuiPanelDrawConsoleTransformed(TuiPanel panel, TuiAtlas atlas, TuiCons
 	assert(atlas != NULL);
 	assert(console != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelDrawConsole_Software(panel, atlas, console, left_x, right_x, top_y, bottom_y);
+	}
 	return tuiPanelDrawConsole_Opengl33(panel, atlas, console, left_x, right_x, top_y, bottom_y);
 }
 
+TuiResult tuiPanelDrawConsoles(TuiPanel panel, const TuiConsoleDraw* draws, int draw_count)
+{
+	assert(panel != NULL);
+	assert(draws != NULL || draw_count == 0);
+	
+	if (draw_count < 0 || draw_count > TUI_PANEL_MAX_CONSOLE_DRAWS)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	for (int draw_i = 0; draw_i < draw_count; draw_i++)
+	{
+		assert(draws[draw_i].console != NULL);
+		assert(draws[draw_i].atlas != NULL);
+	}
+	if (draw_count == 0)
+	{
+		return TUI_RESULT_OK;
+	}
+	
+	if (tui_is_software_backend())
+	{
+		for (int draw_i = 0; draw_i < draw_count; draw_i++)
+		{
+			const TuiConsoleDraw* draw = &draws[draw_i];
+			TuiResult result = tuiPanelDrawConsole_Software(panel, draw->atlas, draw->console, draw->left_x, draw->right_x, draw->top_y, draw->bottom_y);
+			if (result != TUI_RESULT_OK)
+			{
+				return result;
+			}
+		}
+		return TUI_RESULT_OK;
+	}
+	return tuiPanelDrawConsoles_Opengl33(panel, draws, draw_count);
+}
+
 TuiResult tuiPanelDrawPanel(TuiPanel panel, TuiPanel subject_panel)
 {
 	assert(panel != NULL);
 	assert(subject_panel != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelDrawPanel_Software(panel, subject_panel, 0, panel->PixelWidth, 0, panel->PixelHeight);
+	}
 	return tuiPanelDrawPanel_Opengl33(panel, subject_panel, 0, panel->PixelWidth, 0, panel->PixelHeight);
 }
 
@@ -131,6 +263,10 @@ TuiResult tuiPanelDrawPanelTransformed(TuiPanel panel, TuiPanel subject_panel, i
 	assert(panel != NULL);
 	assert(subject_panel != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelDrawPanel_Software(panel, subject_panel, left_x, right_x, top_y, bottom_y);
+	}
 	return tuiPanelDrawPanel_Opengl33(panel, subject_panel, left_x, right_x, top_y, bottom_y);
 }
 
@@ -139,6 +275,10 @@ TuiResult tuiPanelDrawTexture(TuiPanel panel, TuiTexture texture)
 	assert(panel != NULL);
 	assert(texture != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelDrawTexture_Software(panel, texture, 0, panel->PixelWidth, 0, panel->PixelHeight);
+	}
 	return tuiPanelDrawTexture_Opengl33(panel, texture, 0, panel->PixelWidth, 0, panel->PixelHeight);
 }
 
@@ -147,6 +287,10 @@ TuiResult tuiPanelDrawTextureTransformed(TuiPanel panel, TuiTexture texture, int
 	assert(panel != NULL);
 	assert(texture != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return tuiPanelDrawTexture_Software(panel, texture, left_x, right_x, top_y, bottom_y);
+	}
 	return tuiPanelDrawTexture_Opengl33(panel, texture, left_x, right_x, top_y, bottom_y);
 }
 
@@ -155,6 +299,10 @@ TuiResult tuiPanelDrawWindow(TuiPanel panel, TuiWindow window)
 	assert(panel != NULL);
 	assert(window != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
 	return tuiPanelDrawWindow_Opengl33(panel, window, 0, panel->PixelWidth, 0, panel->PixelHeight);
 }
 
@@ -163,6 +311,10 @@ TuiResult tuiPanelDrawWindowTransformed(TuiPanel panel, TuiWindow window, int le
 	assert(panel != NULL);
 	assert(window != NULL);
 	
+	if (tui_is_software_backend())
+	{
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
 	return tuiPanelDrawWindow_Opengl33(panel, window, left_x, right_x, top_y, bottom_y);
 }
 
@@ -0,0 +1,131 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "parallel.h"
+#include "math_inline.h"
+
+#include <assert.h>
+#include <stddef.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+
+typedef struct TuiParallelThread
+{
+	tuiParallelJobFunction JobFunction;
+
+	void* UserData;
+
+	int FirstJobIndex;
+
+	int JobStride;
+
+	int JobCount;
+} TuiParallelThread;
+
+static void _tuiParallelThreadRunJobs(const TuiParallelThread* const thread)
+{
+	for (int job_i = thread->FirstJobIndex; job_i < thread->JobCount; job_i += thread->JobStride)
+	{
+		thread->JobFunction(thread->UserData, job_i);
+	}
+}
+
+#ifdef _WIN32
+static DWORD WINAPI _tuiParallelThreadMain(LPVOID thread)
+{
+	_tuiParallelThreadRunJobs((const TuiParallelThread*)thread);
+	return 0;
+}
+#else
+static void* _tuiParallelThreadMain(void* thread)
+{
+	_tuiParallelThreadRunJobs((const TuiParallelThread*)thread);
+	return NULL;
+}
+#endif
+
+int tui_get_hardware_thread_count()
+{
+#ifdef _WIN32
+	SYSTEM_INFO system_info;
+	GetSystemInfo(&system_info);
+	const int hardware_thread_count = (int)system_info.dwNumberOfProcessors;
+#else
+	const int hardware_thread_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	return MAX(hardware_thread_count, 1);
+}
+
+void tui_parallel_for(const int job_count, int thread_count, const tuiParallelJobFunction job_function, void* const user_data)
+{
+	assert(job_function != NULL);
+	if (job_count <= 0) return;
+	if (thread_count < 1)
+	{
+		thread_count = tui_get_hardware_thread_count();
+	}
+	thread_count = MIN(thread_count, MIN(job_count, TUI_PARALLEL_MAX_THREADS));
+
+	TuiParallelThread threads[TUI_PARALLEL_MAX_THREADS];
+#ifdef _WIN32
+	HANDLE thread_handles[TUI_PARALLEL_MAX_THREADS];
+#else
+	pthread_t thread_handles[TUI_PARALLEL_MAX_THREADS];
+#endif
+	TuiBoolean thread_started[TUI_PARALLEL_MAX_THREADS];
+	for (int thread_i = 0; thread_i < thread_count; thread_i++)
+	{
+		threads[thread_i].JobFunction = job_function;
+		threads[thread_i].UserData = user_data;
+		threads[thread_i].FirstJobIndex = thread_i;
+		threads[thread_i].JobStride = thread_count;
+		threads[thread_i].JobCount = job_count;
+		thread_started[thread_i] = TUI_FALSE;
+	}
+	// thread 0 is the calling thread
+	for (int thread_i = 1; thread_i < thread_count; thread_i++)
+	{
+#ifdef _WIN32
+		thread_handles[thread_i] = CreateThread(NULL, 0, _tuiParallelThreadMain, &threads[thread_i], 0, NULL);
+		thread_started[thread_i] = (thread_handles[thread_i] != NULL);
+#else
+		thread_started[thread_i] = (pthread_create(&thread_handles[thread_i], NULL, _tuiParallelThreadMain, &threads[thread_i]) == 0);
+#endif
+	}
+	_tuiParallelThreadRunJobs(&threads[0]);
+	for (int thread_i = 1; thread_i < thread_count; thread_i++)
+	{
+		if (!thread_started[thread_i])
+		{
+			_tuiParallelThreadRunJobs(&threads[thread_i]);
+			continue;
+		}
+#ifdef _WIN32
+		WaitForSingleObject(thread_handles[thread_i], INFINITE);
+		CloseHandle(thread_handles[thread_i]);
+#else
+		pthread_join(thread_handles[thread_i], NULL);
+#endif
+	}
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef TUIC_PARALLEL_H //header guard
+#define TUIC_PARALLEL_H
+#include <TUIC/boolean.h>
+
+// The most threads a single parallel for can use, including the calling thread.
+#define TUI_PARALLEL_MAX_THREADS 64
+
+// Function run once for each job index of a parallel for.
+typedef void (*tuiParallelJobFunction)(void* user_data, int job_index);
+
+// Get the amount of hardware threads of the device. Returns at least 1.
+int tui_get_hardware_thread_count();
+
+// Run a job function for every job index from 0 to job_count - 1 spread over up to thread_count threads including the calling thread, and return once every job is done. Thread t runs jobs t, t + threads, t + 2 * threads and so on, so the split is deterministic. A thread_count less than 1 uses every hardware thread. If a thread can not be started its jobs are run on the calling thread instead.
+void tui_parallel_for(int job_count, int thread_count, tuiParallelJobFunction job_function, void* user_data);
+
+#endif //header guard
\ No newline at end of file
@@ -0,0 +1,608 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/pathfinder.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "math_inline.h"
+
+#include <assert.h>
+#include <string.h>
+
+#define TUI_PATH_NODE_NONE -1
+// The largest tile cost a tile cost array can hold.
+#define TUI_PATH_MAX_TILE_COST 255
+
+// Neighbour offsets with the four orthogonal directions first, so searches without diagonal steps only use the first four.
+static const int kTuiPathStepX[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+static const int kTuiPathStepY[8] = { -1, 0, 1, 0, -1, 1, 1, -1 };
+
+// The grid a single search walks on.
+typedef struct TuiPathSearch
+{
+	TuiPathfinder Pathfinder;
+
+	const uint8_t* BlockingData;
+
+	const uint8_t* TileCosts;
+
+	int Width;
+
+	int Height;
+
+	int GoalIndex;
+} TuiPathSearch;
+
+static inline TuiBoolean _tuiPathSearchIsWalkable(const TuiPathSearch* search, const int x, const int y)
+{
+	if (x < 0 || y < 0 || x >= search->Width || y >= search->Height)
+	{
+		return TUI_FALSE;
+	}
+	const int index = y * search->Width + x;
+	if (search->BlockingData != NULL && search->BlockingData[index] != 0)
+	{
+		return TUI_FALSE;
+	}
+	return search->TileCosts == NULL || search->TileCosts[index] != 0;
+}
+
+static inline int32_t _tuiPathSearchGetTileCost(const TuiPathSearch* search, const int index)
+{
+	return (search->TileCosts == NULL) ? 1 : (int32_t)search->TileCosts[index];
+}
+
+// A diagonal step is only allowed if both orthogonal tiles it passes between can be walked on.
+static inline TuiBoolean _tuiPathSearchCanStep(const TuiPathSearch* search, const int x, const int y, const int step_x, const int step_y)
+{
+	if (!_tuiPathSearchIsWalkable(search, x + step_x, y + step_y))
+	{
+		return TUI_FALSE;
+	}
+	if (step_x != 0 && step_y != 0)
+	{
+		return _tuiPathSearchIsWalkable(search, x + step_x, y) && _tuiPathSearchIsWalkable(search, x, y + step_y);
+	}
+	return TUI_TRUE;
+}
+
+// The cost of the cheapest walk between two tiles on an open grid where every tile costs 1, which never overestimates the cost of a real path.
+static inline int32_t _tuiPathHeuristic(const int x0, const int y0, const int x1, const int y1, const TuiBoolean allow_diagonal)
+{
+	const int32_t dx = abs(x1 - x0);
+	const int32_t dy = abs(y1 - y0);
+	if (!allow_diagonal)
+	{
+		return (dx + dy) * TUI_PATH_ORTHOGONAL_STEP_COST;
+	}
+	return MIN(dx, dy) * TUI_PATH_DIAGONAL_STEP_COST + (MAX(dx, dy) - MIN(dx, dy)) * TUI_PATH_ORTHOGONAL_STEP_COST;
+}
+
+// Start a new search. Nodes are lazily reset by comparing their generation with the pathfinder's, so starting a search does not touch every tile.
+static void _tuiPathfinderBegin(TuiPathfinder pathfinder, const int32_t start_priority)
+{
+	pathfinder->Generation++;
+	if (pathfinder->Generation == 0)
+	{
+		const size_t tile_count = (size_t)pathfinder->Width * (size_t)pathfinder->Height;
+		for (size_t i = 0; i < tile_count; i++)
+		{
+			pathfinder->Nodes[i].Generation = 0;
+		}
+		pathfinder->Generation = 1;
+	}
+	for (int32_t i = 0; i <= pathfinder->BucketMask; i++)
+	{
+		pathfinder->BucketHeads[i] = TUI_PATH_NODE_NONE;
+	}
+	pathfinder->CurrentPriority = start_priority;
+	pathfinder->QueuedCount = 0;
+	pathfinder->LastPathCost = TUI_PATH_UNREACHABLE;
+}
+
+static inline void _tuiPathfinderUnlink(TuiPathfinder pathfinder, const int32_t index)
+{
+	TuiPathNode* node = &pathfinder->Nodes[index];
+	if (node->Previous != TUI_PATH_NODE_NONE)
+	{
+		pathfinder->Nodes[node->Previous].Next = node->Next;
+	}
+	else
+	{
+		pathfinder->BucketHeads[node->Priority & pathfinder->BucketMask] = node->Next;
+	}
+	if (node->Next != TUI_PATH_NODE_NONE)
+	{
+		pathfinder->Nodes[node->Next].Previous = node->Previous;
+	}
+	pathfinder->QueuedCount--;
+}
+
+// Queue a node with a cost if it was not reached more cheaply yet. Each bucket holds the queued nodes of one priority modulo the bucket count, which is larger than any priority increase of a single step, so the buckets never wrap onto queued priorities.
+static inline void _tuiPathfinderOpen(TuiPathfinder pathfinder, const int32_t index, const int32_t cost, const int32_t priority, const int32_t parent)
+{
+	TuiPathNode* node = &pathfinder->Nodes[index];
+	if (node->Generation != pathfinder->Generation)
+	{
+		node->Generation = pathfinder->Generation;
+		node->Closed = TUI_FALSE;
+	}
+	else if (node->Closed || cost >= node->Cost)
+	{
+		return;
+	}
+	else
+	{
+		_tuiPathfinderUnlink(pathfinder, index);
+	}
+	assert(priority >= pathfinder->CurrentPriority && priority - pathfinder->CurrentPriority <= pathfinder->BucketMask);
+	node->Cost = cost;
+	node->Priority = priority;
+	node->Parent = parent;
+	int32_t* head = &pathfinder->BucketHeads[priority & pathfinder->BucketMask];
+	node->Previous = TUI_PATH_NODE_NONE;
+	node->Next = *head;
+	if (*head != TUI_PATH_NODE_NONE)
+	{
+		pathfinder->Nodes[*head].Previous = index;
+	}
+	*head = index;
+	pathfinder->QueuedCount++;
+}
+
+// Remove and close the queued node with the lowest priority. Nodes of equal priority come out newest first, which favours nodes closer to the goal.
+static inline int32_t _tuiPathfinderClose(TuiPathfinder pathfinder)
+{
+	assert(pathfinder->QueuedCount > 0);
+	while (pathfinder->BucketHeads[pathfinder->CurrentPriority & pathfinder->BucketMask] == TUI_PATH_NODE_NONE)
+	{
+		pathfinder->CurrentPriority++;
+	}
+	const int32_t index = pathfinder->BucketHeads[pathfinder->CurrentPriority & pathfinder->BucketMask];
+	_tuiPathfinderUnlink(pathfinder, index);
+	pathfinder->Nodes[index].Closed = TUI_TRUE;
+	return index;
+}
+
+// Write the path ending at a closed node by walking its parents. Parents may be any amount of straight or diagonal steps away, which fills in the tiles skipped by jump point search.
+static void _tuiPathfinderWritePath(TuiPathfinder pathfinder, const int32_t goal_index, TuiPoint2* path, const int path_capacity, int* path_length)
+{
+	const int width = pathfinder->Width;
+	int length = 1;
+	for (int32_t index = goal_index; pathfinder->Nodes[index].Parent != TUI_PATH_NODE_NONE; index = pathfinder->Nodes[index].Parent)
+	{
+		const int32_t parent = pathfinder->Nodes[index].Parent;
+		length += MAX(abs(index % width - parent % width), abs(index / width - parent / width));
+	}
+	if (path_length != NULL)
+	{
+		*path_length = length;
+	}
+	if (path == NULL)
+	{
+		return;
+	}
+	int path_i = length - 1;
+	int x = goal_index % width;
+	int y = goal_index / width;
+	if (path_i < path_capacity)
+	{
+		path[path_i] = tuiPoint2(x, y);
+	}
+	for (int32_t index = goal_index; pathfinder->Nodes[index].Parent != TUI_PATH_NODE_NONE; index = pathfinder->Nodes[index].Parent)
+	{
+		const int32_t parent = pathfinder->Nodes[index].Parent;
+		const int step_x = SIGN(parent % width - x);
+		const int step_y = SIGN(parent / width - y);
+		while (x != parent % width || y != parent / width)
+		{
+			x += step_x;
+			y += step_y;
+			path_i--;
+			if (path_i < path_capacity)
+			{
+				path[path_i] = tuiPoint2(x, y);
+			}
+		}
+	}
+}
+
+static TuiResult _tuiPathSearchInit(TuiPathSearch* search, TuiPathfinder pathfinder, TuiGridMask blocking_mask, const uint8_t* tile_costs)
+{
+	if (blocking_mask != NULL && (blocking_mask->Width != pathfinder->Width || blocking_mask->Height != pathfinder->Height))
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	search->Pathfinder = pathfinder;
+	search->BlockingData = (blocking_mask != NULL) ? blocking_mask->Data : NULL;
+	search->TileCosts = tile_costs;
+	search->Width = pathfinder->Width;
+	search->Height = pathfinder->Height;
+	search->GoalIndex = TUI_PATH_NODE_NONE;
+	return TUI_RESULT_OK;
+}
+
+// Move in a straight line from a tile until reaching the goal, a blocked tile, or a tile with a neighbour that is only reachable optimally through it.
+static int32_t _tuiPathSearchJumpStraight(const TuiPathSearch* search, int x, int y, const int step_x, const int step_y)
+{
+	while (_tuiPathSearchIsWalkable(search, x, y))
+	{
+		const int32_t index = y * search->Width + x;
+		if (index == search->GoalIndex)
+		{
+			return index;
+		}
+		if (step_x != 0)
+		{
+			if ((_tuiPathSearchIsWalkable(search, x, y - 1) && !_tuiPathSearchIsWalkable(search, x - step_x, y - 1)) ||
+				(_tuiPathSearchIsWalkable(search, x, y + 1) && !_tuiPathSearchIsWalkable(search, x - step_x, y + 1)))
+			{
+				return index;
+			}
+		}
+		else if ((_tuiPathSearchIsWalkable(search, x - 1, y) && !_tuiPathSearchIsWalkable(search, x - 1, y - step_y)) ||
+			(_tuiPathSearchIsWalkable(search, x + 1, y) && !_tuiPathSearchIsWalkable(search, x + 1, y - step_y)))
+		{
+			return index;
+		}
+		x += step_x;
+		y += step_y;
+	}
+	return TUI_PATH_NODE_NONE;
+}
+
+// Move diagonally from a tile until reaching the goal, a tile that a straight jump from finds a jump point, or a step that is blocked.
+static int32_t _tuiPathSearchJumpDiagonal(const TuiPathSearch* search, int x, int y, const int step_x, const int step_y)
+{
+	while (_tuiPathSearchIsWalkable(search, x, y))
+	{
+		const int32_t index = y * search->Width + x;
+		if (index == search->GoalIndex)
+		{
+			return index;
+		}
+		if (_tuiPathSearchJumpStraight(search, x + step_x, y, step_x, 0) != TUI_PATH_NODE_NONE || _tuiPathSearchJumpStraight(search, x, y + step_y, 0, step_y) != TUI_PATH_NODE_NONE)
+		{
+			return index;
+		}
+		if (!_tuiPathSearchIsWalkable(search, x + step_x, y) || !_tuiPathSearchIsWalkable(search, x, y + step_y))
+		{
+			return TUI_PATH_NODE_NONE;
+		}
+		x += step_x;
+		y += step_y;
+	}
+	return TUI_PATH_NODE_NONE;
+}
+
+// Jump from a tile in a direction and queue the jump point found, if any.
+static inline void _tuiPathSearchJump(const TuiPathSearch* search, const int32_t index, const int step_x, const int step_y)
+{
+	const int x = index % search->Width;
+	const int y = index / search->Width;
+	const int32_t jump_index = (step_x != 0 && step_y != 0) ?
+		_tuiPathSearchJumpDiagonal(search, x + step_x, y + step_y, step_x, step_y) :
+		_tuiPathSearchJumpStraight(search, x + step_x, y + step_y, step_x, step_y);
+	if (jump_index == TUI_PATH_NODE_NONE)
+	{
+		return;
+	}
+	const int jump_x = jump_index % search->Width;
+	const int jump_y = jump_index / search->Width;
+	const int32_t cost = search->Pathfinder->Nodes[index].Cost + _tuiPathHeuristic(x, y, jump_x, jump_y, TUI_TRUE);
+	const int goal_x = search->GoalIndex % search->Width;
+	const int goal_y = search->GoalIndex / search->Width;
+	_tuiPathfinderOpen(search->Pathfinder, jump_index, cost, cost + _tuiPathHeuristic(jump_x, jump_y, goal_x, goal_y, TUI_TRUE), index);
+}
+
+TuiResult tuiPathfinderCreate(TuiPathfinder* pathfinder, const int width, const int height)
+{
+	assert(pathfinder != NULL);
+	if (width < 1 || height < 1 || (int64_t)width * (int64_t)height * TUI_PATH_DIAGONAL_STEP_COST * TUI_PATH_MAX_TILE_COST >= (int64_t)TUI_PATH_UNREACHABLE)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	// The most a queued priority can exceed the lowest one is one step onto the most expensive tile plus the heuristic change of that step, or twice the longest jump of jump point search.
+	const int32_t max_priority_range = MAX(2 * TUI_PATH_DIAGONAL_STEP_COST * TUI_PATH_MAX_TILE_COST, 2 * TUI_PATH_DIAGONAL_STEP_COST * MAX(width, height));
+	int32_t bucket_count = 1;
+	while (bucket_count <= max_priority_range)
+	{
+		bucket_count *= 2;
+	}
+	*pathfinder = (TuiPathfinder)tuiAllocate(sizeof(TuiPathfinder_s));
+	if (*pathfinder == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	(*pathfinder)->Width = width;
+	(*pathfinder)->Height = height;
+	(*pathfinder)->Nodes = (TuiPathNode*)tuiAllocate((size_t)width * (size_t)height * sizeof(TuiPathNode));
+	(*pathfinder)->BucketHeads = (int32_t*)tuiAllocate((size_t)bucket_count * sizeof(int32_t));
+	if ((*pathfinder)->Nodes == NULL || (*pathfinder)->BucketHeads == NULL)
+	{
+		tuiFree((*pathfinder)->Nodes);
+		tuiFree((*pathfinder)->BucketHeads);
+		tuiFree(*pathfinder);
+		*pathfinder = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset((*pathfinder)->Nodes, 0, (size_t)width * (size_t)height * sizeof(TuiPathNode));
+	(*pathfinder)->BucketMask = bucket_count - 1;
+	(*pathfinder)->CurrentPriority = 0;
+	(*pathfinder)->QueuedCount = 0;
+	(*pathfinder)->Generation = 0;
+	(*pathfinder)->LastPathCost = TUI_PATH_UNREACHABLE;
+	return TUI_RESULT_OK;
+}
+
+void tuiPathfinderDestroy(TuiPathfinder pathfinder)
+{
+	assert(pathfinder != NULL);
+	tuiFree(pathfinder->Nodes);
+	tuiFree(pathfinder->BucketHeads);
+	tuiFree(pathfinder);
+}
+
+void tuiPathfinderGetDimensions(TuiPathfinder pathfinder, int* width, int* height)
+{
+	assert(pathfinder != NULL);
+	if (width != NULL)
+	{
+		*width = pathfinder->Width;
+	}
+	if (height != NULL)
+	{
+		*height = pathfinder->Height;
+	}
+}
+
+TuiResult tuiPathfinderFindPath(TuiPathfinder pathfinder, TuiGridMask blocking_mask, const uint8_t* tile_costs, const TuiPoint2 start, const TuiPoint2 goal, const TuiBoolean allow_diagonal, TuiPoint2* path, const int path_capacity, int* path_length)
+{
+	assert(pathfinder != NULL);
+	TuiPathSearch search;
+	if (path_capacity < 0 || _tuiPathSearchInit(&search, pathfinder, blocking_mask, tile_costs) != TUI_RESULT_OK)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	_tuiPathfinderBegin(pathfinder, _tuiPathHeuristic(start.x, start.y, goal.x, goal.y, allow_diagonal));
+	if (path_length != NULL)
+	{
+		*path_length = 0;
+	}
+	if (!_tuiPathSearchIsWalkable(&search, start.x, start.y) || !_tuiPathSearchIsWalkable(&search, goal.x, goal.y))
+	{
+		return TUI_RESULT_OK;
+	}
+	search.GoalIndex = goal.y * search.Width + goal.x;
+	_tuiPathfinderOpen(pathfinder, start.y * search.Width + start.x, 0, pathfinder->CurrentPriority, TUI_PATH_NODE_NONE);
+	const int direction_count = (allow_diagonal) ? 8 : 4;
+	while (pathfinder->QueuedCount > 0)
+	{
+		const int32_t index = _tuiPathfinderClose(pathfinder);
+		if (index == search.GoalIndex)
+		{
+			pathfinder->LastPathCost = pathfinder->Nodes[index].Cost;
+			_tuiPathfinderWritePath(pathfinder, index, path, path_capacity, path_length);
+			return TUI_RESULT_OK;
+		}
+		const int x = index % search.Width;
+		const int y = index / search.Width;
+		for (int direction = 0; direction < direction_count; direction++)
+		{
+			const int step_x = kTuiPathStepX[direction];
+			const int step_y = kTuiPathStepY[direction];
+			if (!_tuiPathSearchCanStep(&search, x, y, step_x, step_y))
+			{
+				continue;
+			}
+			const int32_t neighbour_index = index + step_y * search.Width + step_x;
+			const int32_t step_cost = (direction < 4) ? TUI_PATH_ORTHOGONAL_STEP_COST : TUI_PATH_DIAGONAL_STEP_COST;
+			const int32_t cost = pathfinder->Nodes[index].Cost + step_cost * _tuiPathSearchGetTileCost(&search, neighbour_index);
+			_tuiPathfinderOpen(pathfinder, neighbour_index, cost, cost + _tuiPathHeuristic(x + step_x, y + step_y, goal.x, goal.y, allow_diagonal), index);
+		}
+	}
+	return TUI_RESULT_OK;
+}
+
+TuiResult tuiPathfinderJumpPointSearch(TuiPathfinder pathfinder, TuiGridMask blocking_mask, const TuiPoint2 start, const TuiPoint2 goal, TuiPoint2* path, const int path_capacity, int* path_length)
+{
+	assert(pathfinder != NULL);
+	assert(blocking_mask != NULL);
+	TuiPathSearch search;
+	if (path_capacity < 0 || _tuiPathSearchInit(&search, pathfinder, blocking_mask, NULL) != TUI_RESULT_OK)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	_tuiPathfinderBegin(pathfinder, _tuiPathHeuristic(start.x, start.y, goal.x, goal.y, TUI_TRUE));
+	if (path_length != NULL)
+	{
+		*path_length = 0;
+	}
+	if (!_tuiPathSearchIsWalkable(&search, start.x, start.y) || !_tuiPathSearchIsWalkable(&search, goal.x, goal.y))
+	{
+		return TUI_RESULT_OK;
+	}
+	search.GoalIndex = goal.y * search.Width + goal.x;
+	const int32_t start_index = start.y * search.Width + start.x;
+	_tuiPathfinderOpen(pathfinder, start_index, 0, pathfinder->CurrentPriority, TUI_PATH_NODE_NONE);
+	while (pathfinder->QueuedCount > 0)
+	{
+		const int32_t index = _tuiPathfinderClose(pathfinder);
+		if (index == search.GoalIndex)
+		{
+			pathfinder->LastPathCost = pathfinder->Nodes[index].Cost;
+			_tuiPathfinderWritePath(pathfinder, index, path, path_capacity, path_length);
+			return TUI_RESULT_OK;
+		}
+		const int x = index % search.Width;
+		const int y = index / search.Width;
+		const int32_t parent = pathfinder->Nodes[index].Parent;
+		if (parent == TUI_PATH_NODE_NONE)
+		{
+			for (int direction = 0; direction < 8; direction++)
+			{
+				if (_tuiPathSearchCanStep(&search, x, y, kTuiPathStepX[direction], kTuiPathStepY[direction]))
+				{
+					_tuiPathSearchJump(&search, index, kTuiPathStepX[direction], kTuiPathStepY[direction]);
+				}
+			}
+			continue;
+		}
+		// Only search the neighbours that can not be reached as cheaply without passing through this tile.
+		const int step_x = SIGN(x - parent % search.Width);
+		const int step_y = SIGN(y - parent / search.Width);
+		if (step_x != 0 && step_y != 0)
+		{
+			const TuiBoolean vertical_walkable = _tuiPathSearchIsWalkable(&search, x, y + step_y);
+			const TuiBoolean horizontal_walkable = _tuiPathSearchIsWalkable(&search, x + step_x, y);
+			if (vertical_walkable)
+			{
+				_tuiPathSearchJump(&search, index, 0, step_y);
+			}
+			if (horizontal_walkable)
+			{
+				_tuiPathSearchJump(&search, index, step_x, 0);
+			}
+			if (vertical_walkable && horizontal_walkable)
+			{
+				_tuiPathSearchJump(&search, index, step_x, step_y);
+			}
+		}
+		else
+		{
+			// The directions to either side of the straight direction of travel.
+			const int side_x = step_y;
+			const int side_y = step_x;
+			const TuiBoolean next_walkable = _tuiPathSearchIsWalkable(&search, x + step_x, y + step_y);
+			const TuiBoolean side_walkable = _tuiPathSearchIsWalkable(&search, x + side_x, y + side_y);
+			const TuiBoolean other_side_walkable = _tuiPathSearchIsWalkable(&search, x - side_x, y - side_y);
+			if (next_walkable)
+			{
+				_tuiPathSearchJump(&search, index, step_x, step_y);
+				if (side_walkable)
+				{
+					_tuiPathSearchJump(&search, index, step_x + side_x, step_y + side_y);
+				}
+				if (other_side_walkable)
+				{
+					_tuiPathSearchJump(&search, index, step_x - side_x, step_y - side_y);
+				}
+			}
+			if (side_walkable)
+			{
+				_tuiPathSearchJump(&search, index, side_x, side_y);
+			}
+			if (other_side_walkable)
+			{
+				_tuiPathSearchJump(&search, index, -side_x, -side_y);
+			}
+		}
+	}
+	return TUI_RESULT_OK;
+}
+
+int32_t tuiPathfinderGetLastPathCost(TuiPathfinder pathfinder)
+{
+	assert(pathfinder != NULL);
+	return pathfinder->LastPathCost;
+}
+
+TuiResult tuiPathfinderComputeDistanceMap(TuiPathfinder pathfinder, TuiGridMask blocking_mask, const uint8_t* tile_costs, const TuiPoint2* sources, const int source_count, const TuiBoolean allow_diagonal, int32_t* distances)
+{
+	assert(pathfinder != NULL);
+	assert(distances != NULL);
+	TuiPathSearch search;
+	if (source_count < 0 || (sources == NULL && source_count > 0) || _tuiPathSearchInit(&search, pathfinder, blocking_mask, tile_costs) != TUI_RESULT_OK)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	_tuiPathfinderBegin(pathfinder, 0);
+	for (int source_i = 0; source_i < source_count; source_i++)
+	{
+		if (_tuiPathSearchIsWalkable(&search, sources[source_i].x, sources[source_i].y))
+		{
+			_tuiPathfinderOpen(pathfinder, sources[source_i].y * search.Width + sources[source_i].x, 0, 0, TUI_PATH_NODE_NONE);
+		}
+	}
+	// The search walks outwards from the sources, so a step from a neighbour costs entering the tile being expanded.
+	const int direction_count = (allow_diagonal) ? 8 : 4;
+	while (pathfinder->QueuedCount > 0)
+	{
+		const int32_t index = _tuiPathfinderClose(pathfinder);
+		const int x = index % search.Width;
+		const int y = index / search.Width;
+		const int32_t tile_cost = _tuiPathSearchGetTileCost(&search, index);
+		for (int direction = 0; direction < direction_count; direction++)
+		{
+			const int step_x = kTuiPathStepX[direction];
+			const int step_y = kTuiPathStepY[direction];
+			if (!_tuiPathSearchCanStep(&search, x, y, step_x, step_y))
+			{
+				continue;
+			}
+			const int32_t step_cost = (direction < 4) ? TUI_PATH_ORTHOGONAL_STEP_COST : TUI_PATH_DIAGONAL_STEP_COST;
+			const int32_t cost = pathfinder->Nodes[index].Cost + step_cost * tile_cost;
+			_tuiPathfinderOpen(pathfinder, index + step_y * search.Width + step_x, cost, cost, index);
+		}
+	}
+	const size_t tile_count = (size_t)search.Width * (size_t)search.Height;
+	for (size_t i = 0; i < tile_count; i++)
+	{
+		distances[i] = (pathfinder->Nodes[i].Generation == pathfinder->Generation) ? pathfinder->Nodes[i].Cost : TUI_PATH_UNREACHABLE;
+	}
+	return TUI_RESULT_OK;
+}
+
+TuiPoint2 tuiDistanceMapGetNextStep(const int32_t* distances, const uint8_t* tile_costs, const int width, const int height, const TuiPoint2 point, const TuiBoolean allow_diagonal)
+{
+	assert(distances != NULL);
+	if (point.x < 0 || point.y < 0 || point.x >= width || point.y >= height)
+	{
+		return point;
+	}
+	TuiPoint2 next_step = point;
+	int64_t next_distance = distances[point.y * width + point.x];
+	if (next_distance == 0 || next_distance == TUI_PATH_UNREACHABLE)
+	{
+		return point;
+	}
+	// Tiles that can not be walked on are unreachable, so unreachable tiles stop diagonal steps from cutting corners.
+	const int direction_count = (allow_diagonal) ? 8 : 4;
+	for (int direction = 0; direction < direction_count; direction++)
+	{
+		const int x = point.x + kTuiPathStepX[direction];
+		const int y = point.y + kTuiPathStepY[direction];
+		if (x < 0 || y < 0 || x >= width || y >= height || distances[y * width + x] == TUI_PATH_UNREACHABLE)
+		{
+			continue;
+		}
+		if (direction >= 4 && (distances[point.y * width + x] == TUI_PATH_UNREACHABLE || distances[y * width + point.x] == TUI_PATH_UNREACHABLE))
+		{
+			continue;
+		}
+		const int64_t step_cost = (direction < 4) ? TUI_PATH_ORTHOGONAL_STEP_COST : TUI_PATH_DIAGONAL_STEP_COST;
+		const int64_t distance = (int64_t)distances[y * width + x] + step_cost * ((tile_costs == NULL) ? 1 : tile_costs[y * width + x]);
+		if (distance < next_distance || (distance == next_distance && next_step.x == point.x && next_step.y == point.y))
+		{
+			next_step = tuiPoint2(x, y);
+			next_distance = distance;
+		}
+	}
+	return next_step;
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/tuic.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "opengl33.h"
+#include "software.h"
+
+#include <assert.h>
+#include <string.h>
+
+TuiResult tuiPixelReadbackCreate(TuiPixelReadback* pixel_readback)
+{
+	assert(pixel_readback != NULL);
+	if (tui_get_system() == NULL)
+	{
+		return TUI_RESULT_ERROR_NOT_INITIALIZED;
+	}
+	*pixel_readback = (TuiPixelReadback)tuiAllocate(sizeof(TuiPixelReadback_s));
+	if (*pixel_readback == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*pixel_readback, 0, sizeof(TuiPixelReadback_s));
+	TuiResult result = tui_is_software_backend() ? tuiPixelReadbackCreate_Software(*pixel_readback) : tuiPixelReadbackCreate_Opengl33(*pixel_readback);
+	if (result != TUI_RESULT_OK)
+	{
+		tuiFree(*pixel_readback);
+		*pixel_readback = NULL;
+		return result;
+	}
+	return TUI_RESULT_OK;
+}
+
+void tuiPixelReadbackDestroy(TuiPixelReadback pixel_readback)
+{
+	assert(pixel_readback != NULL);
+	tuiPixelReadbackUnmapPixels(pixel_readback);
+	if (tui_is_software_backend())
+	{
+		tuiPixelReadbackDestroy_Software(pixel_readback);
+	}
+	else
+	{
+		tuiPixelReadbackDestroy_Opengl33(pixel_readback);
+	}
+	tuiFree(pixel_readback);
+}
+
+TuiResult tuiPixelReadbackCapturePanel(TuiPixelReadback pixel_readback, TuiPanel panel)
+{
+	assert(pixel_readback != NULL);
+	assert(panel != NULL);
+	if (pixel_readback->Mapped)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	if (tui_is_software_backend())
+	{
+		return tuiPixelReadbackCapturePanel_Software(pixel_readback, panel);
+	}
+	return tuiPixelReadbackCapturePanel_Opengl33(pixel_readback, panel);
+}
+
+TuiResult tuiPixelReadbackCaptureWindow(TuiPixelReadback pixel_readback, TuiWindow window)
+{
+	assert(pixel_readback != NULL);
+	assert(window != NULL);
+	if (pixel_readback->Mapped)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	if (tui_is_software_backend())
+	{
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
+	return tuiPixelReadbackCaptureWindow_Opengl33(pixel_readback, window);
+}
+
+TuiBoolean tuiPixelReadbackIsReady(TuiPixelReadback pixel_readback)
+{
+	assert(pixel_readback != NULL);
+	if (!pixel_readback->Captured)
+	{
+		return TUI_FALSE;
+	}
+	if (!pixel_readback->Pending)
+	{
+		return TUI_TRUE;
+	}
+	return tuiPixelReadbackPoll_Opengl33(pixel_readback, TUI_FALSE);
+}
+
+TuiResult tuiPixelReadbackMapPixels(TuiPixelReadback pixel_readback, const uint8_t** pixels, int* pixel_width, int* pixel_height)
+{
+	assert(pixel_readback != NULL);
+	assert(pixels != NULL);
+	if (!pixel_readback->Captured || pixel_readback->Mapped)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	if (tui_is_software_backend())
+	{
+		*pixels = tuiPixelReadbackMap_Software(pixel_readback);
+	}
+	else
+	{
+		if (pixel_readback->Pending)
+		{
+			tuiPixelReadbackPoll_Opengl33(pixel_readback, TUI_TRUE);
+		}
+		TuiResult result = tuiPixelReadbackMap_Opengl33(pixel_readback, pixels);
+		if (result != TUI_RESULT_OK)
+		{
+			return result;
+		}
+	}
+	pixel_readback->Mapped = TUI_TRUE;
+	if (pixel_width != NULL)
+	{
+		*pixel_width = pixel_readback->PixelWidth;
+	}
+	if (pixel_height != NULL)
+	{
+		*pixel_height = pixel_readback->PixelHeight;
+	}
+	return TUI_RESULT_OK;
+}
+
+void tuiPixelReadbackUnmapPixels(TuiPixelReadback pixel_readback)
+{
+	assert(pixel_readback != NULL);
+	if (pixel_readback->Mapped)
+	{
+		if (!tui_is_software_backend())
+		{
+			tuiPixelReadbackUnmap_Opengl33(pixel_readback);
+		}
+		pixel_readback->Mapped = TUI_FALSE;
+	}
+}
\ No newline at end of file
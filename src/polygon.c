@@ -0,0 +1,249 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/polygon.h>
+#include <TUIC/point2.h>
+#include <TUIC/line.h>
+#include <TUIC/line_it.h>
+#include <TUIC/rect.h>
+#include <TUIC/circle.h>
+#include <TUIC/ellipse.h>
+#include "grid_shapes_inline.h"
+#include "math_inline.h"
+#include <stdlib.h>
+#include <assert.h>
+
+
+TuiPolygon tuiPolygon(const TuiPoint2* const points, const int point_count)
+{
+	TuiPolygon ret = { points, point_count };
+	return ret;
+}
+
+TuiResult tuiPolygonCreate(TuiPolygon* const polygon, const TuiPoint2* const points, const int point_count)
+{
+	assert(polygon != NULL);
+	if (!_tuiPolygonIsValid(points, point_count))
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	*polygon = tuiPolygon(points, point_count);
+	return TUI_RESULT_OK;
+}
+
+int tuiPolygonGetLeftX(const TuiPolygon polygon)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return 0;
+	int left_x = polygon.points[0].x;
+	for (int point_i = 1; point_i < polygon.point_count; point_i++)
+	{
+		left_x = MIN(left_x, polygon.points[point_i].x);
+	}
+	return left_x;
+}
+
+int tuiPolygonGetRightX(const TuiPolygon polygon)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return 0;
+	int right_x = polygon.points[0].x;
+	for (int point_i = 1; point_i < polygon.point_count; point_i++)
+	{
+		right_x = MAX(right_x, polygon.points[point_i].x);
+	}
+	return right_x;
+}
+
+int tuiPolygonGetTopY(const TuiPolygon polygon)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return 0;
+	int top_y = polygon.points[0].y;
+	for (int point_i = 1; point_i < polygon.point_count; point_i++)
+	{
+		top_y = MIN(top_y, polygon.points[point_i].y);
+	}
+	return top_y;
+}
+
+int tuiPolygonGetBottomY(const TuiPolygon polygon)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return 0;
+	int bottom_y = polygon.points[0].y;
+	for (int point_i = 1; point_i < polygon.point_count; point_i++)
+	{
+		bottom_y = MAX(bottom_y, polygon.points[point_i].y);
+	}
+	return bottom_y;
+}
+
+int tuiPolygonGetTileWidth(const TuiPolygon polygon)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return 0;
+	const int tile_width = tuiPolygonGetRightX(polygon) - tuiPolygonGetLeftX(polygon) + 1;
+	return tile_width;
+}
+
+int tuiPolygonGetTileHeight(const TuiPolygon polygon)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return 0;
+	const int tile_height = tuiPolygonGetBottomY(polygon) - tuiPolygonGetTopY(polygon) + 1;
+	return tile_height;
+}
+
+TuiRect tuiPolygonGetBoundingRect(const TuiPolygon polygon)
+{
+	const int left_x = tuiPolygonGetLeftX(polygon);
+	const int top_y = tuiPolygonGetTopY(polygon);
+	const int tile_width = tuiPolygonGetTileWidth(polygon);
+	const int tile_height = tuiPolygonGetTileHeight(polygon);
+	const TuiRect ret = tuiRect(left_x, top_y, tile_width, tile_height);
+	return ret;
+}
+
+TuiBoolean tuiPolygonIsDegenerate(const TuiPolygon polygon)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count) || polygon.point_count < 3) return TUI_TRUE;
+	for (int point_i = 2; point_i < polygon.point_count; point_i++)
+	{
+		if (!_tuiPoint2Collinear(polygon.points[0], polygon.points[1], polygon.points[point_i])) return TUI_FALSE;
+	}
+	return TUI_TRUE;
+}
+
+TuiBoolean tuiPolygonContainsPoint2(const TuiPolygon polygon, const TuiPoint2 point2)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return TUI_FALSE;
+	int span_xs[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	const int span_count = _tuiPolygonGetRowSpans(polygon.points, polygon.point_count, point2.y, span_xs, TUI_POLYGON_IT_MAX_ROW_SPANS);
+	for (int span_i = 0; span_i < span_count; span_i++)
+	{
+		if (point2.x >= span_xs[span_i * 2] && point2.x <= span_xs[span_i * 2 + 1]) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
+
+TuiBoolean tuiPolygonContainsLine(const TuiPolygon polygon, const TuiLine line)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return TUI_FALSE;
+	TUI_LINE_ITERATE(line, it)
+	{
+		if (!tuiPolygonContainsPoint2(polygon, tuiLineItGetPoint2(it))) return TUI_FALSE;
+	}
+	return TUI_TRUE;
+}
+
+TuiBoolean tuiPolygonContainsRect(const TuiPolygon polygon, const TuiRect rect)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count) || tuiRectIsDegenerate(rect)) return TUI_FALSE;
+	const int rect_left_x = tuiRectGetTopLeftCornerPoint2(rect).x;
+	const int rect_right_x = tuiRectGetTopRightCornerPoint2(rect).x;
+	const int rect_top_y = tuiRectGetTopLeftCornerPoint2(rect).y;
+	const int rect_bottom_y = tuiRectGetBottomLeftCornerPoint2(rect).y;
+	int span_xs[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	for (int row_y = rect_top_y; row_y <= rect_bottom_y; row_y++)
+	{
+		const int span_count = _tuiPolygonGetRowSpans(polygon.points, polygon.point_count, row_y, span_xs, TUI_POLYGON_IT_MAX_ROW_SPANS);
+		TuiBoolean row_contained = TUI_FALSE;
+		for (int span_i = 0; span_i < span_count; span_i++)
+		{
+			if (rect_left_x >= span_xs[span_i * 2] && rect_right_x <= span_xs[span_i * 2 + 1])
+			{
+				row_contained = TUI_TRUE;
+				break;
+			}
+		}
+		if (!row_contained) return TUI_FALSE;
+	}
+	return TUI_TRUE;
+}
+
+TuiBoolean tuiPolygonIntersectsLine(const TuiPolygon polygon, const TuiLine line)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count)) return TUI_FALSE;
+	if (tuiPolygonContainsPoint2(polygon, tuiLineGetStartPoint2(line))) return TUI_TRUE;
+	for (int point_i = 0; point_i < polygon.point_count; point_i++)
+	{
+		const TuiPoint2 edge_start = polygon.points[point_i];
+		const TuiPoint2 edge_end = polygon.points[(point_i + 1 == polygon.point_count) ? 0 : point_i + 1];
+		if (tuiLineIntersectsLine(line, tuiLine(edge_start.x, edge_start.y, edge_end.x, edge_end.y))) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
+
+TuiBoolean tuiPolygonIntersectsRect(const TuiPolygon polygon, const TuiRect rect)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count) || tuiRectIsDegenerate(rect)) return TUI_FALSE;
+	const int rect_span_xs[2] = { tuiRectGetTopLeftCornerPoint2(rect).x, tuiRectGetTopRightCornerPoint2(rect).x };
+	const int top_y = MAX(tuiRectGetTopLeftCornerPoint2(rect).y, tuiPolygonGetTopY(polygon));
+	const int bottom_y = MIN(tuiRectGetBottomLeftCornerPoint2(rect).y, tuiPolygonGetBottomY(polygon));
+	int span_xs[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	for (int row_y = top_y; row_y <= bottom_y; row_y++)
+	{
+		const int span_count = _tuiPolygonGetRowSpans(polygon.points, polygon.point_count, row_y, span_xs, TUI_POLYGON_IT_MAX_ROW_SPANS);
+		if (_tuiSpanListsOverlap(span_xs, span_count, rect_span_xs, 1)) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
+
+TuiBoolean tuiPolygonIntersectsCircle(const TuiPolygon polygon, const TuiCircle circle)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count) || tuiCircleIsDegenerate(circle)) return TUI_FALSE;
+	const int top_y = MAX(tuiCircleGetTopY(circle), tuiPolygonGetTopY(polygon));
+	const int bottom_y = MIN(tuiCircleGetBottomY(circle), tuiPolygonGetBottomY(polygon));
+	int span_xs[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	int circle_span_xs[2];
+	for (int row_y = top_y; row_y <= bottom_y; row_y++)
+	{
+		if (!_tuiCircleGetRowSpan(circle.center_x, circle.center_y, circle.radius, row_y, &circle_span_xs[0], &circle_span_xs[1])) continue;
+		const int span_count = _tuiPolygonGetRowSpans(polygon.points, polygon.point_count, row_y, span_xs, TUI_POLYGON_IT_MAX_ROW_SPANS);
+		if (_tuiSpanListsOverlap(span_xs, span_count, circle_span_xs, 1)) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
+
+TuiBoolean tuiPolygonIntersectsEllipse(const TuiPolygon polygon, const TuiEllipse ellipse)
+{
+	if (!_tuiPolygonIsValid(polygon.points, polygon.point_count) || tuiEllipseIsDegenerate(ellipse)) return TUI_FALSE;
+	const int top_y = MAX(tuiEllipseGetTopY(ellipse), tuiPolygonGetTopY(polygon));
+	const int bottom_y = MIN(tuiEllipseGetBottomY(ellipse), tuiPolygonGetBottomY(polygon));
+	int span_xs[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	int ellipse_span_xs[2];
+	for (int row_y = top_y; row_y <= bottom_y; row_y++)
+	{
+		if (!_tuiEllipseGetRowSpan(ellipse.center_x, ellipse.center_y, ellipse.radius_x, ellipse.radius_y, row_y, &ellipse_span_xs[0], &ellipse_span_xs[1])) continue;
+		const int span_count = _tuiPolygonGetRowSpans(polygon.points, polygon.point_count, row_y, span_xs, TUI_POLYGON_IT_MAX_ROW_SPANS);
+		if (_tuiSpanListsOverlap(span_xs, span_count, ellipse_span_xs, 1)) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
+
+TuiBoolean tuiPolygonIntersectsPolygon(const TuiPolygon polygon_1, const TuiPolygon polygon_2)
+{
+	if (!_tuiPolygonIsValid(polygon_1.points, polygon_1.point_count) || !_tuiPolygonIsValid(polygon_2.points, polygon_2.point_count)) return TUI_FALSE;
+	const int top_y = MAX(tuiPolygonGetTopY(polygon_1), tuiPolygonGetTopY(polygon_2));
+	const int bottom_y = MIN(tuiPolygonGetBottomY(polygon_1), tuiPolygonGetBottomY(polygon_2));
+	int span_xs_1[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	int span_xs_2[TUI_POLYGON_IT_MAX_ROW_SPANS * 2];
+	for (int row_y = top_y; row_y <= bottom_y; row_y++)
+	{
+		const int span_count_1 = _tuiPolygonGetRowSpans(polygon_1.points, polygon_1.point_count, row_y, span_xs_1, TUI_POLYGON_IT_MAX_ROW_SPANS);
+		const int span_count_2 = _tuiPolygonGetRowSpans(polygon_2.points, polygon_2.point_count, row_y, span_xs_2, TUI_POLYGON_IT_MAX_ROW_SPANS);
+		if (_tuiSpanListsOverlap(span_xs_1, span_count_1, span_xs_2, span_count_2)) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
\ No newline at end of file
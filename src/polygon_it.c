@@ -0,0 +1,107 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/polygon_it.h>
+#include <TUIC/polygon.h>
+#include "grid_shapes_inline.h"
+#include "math_inline.h"
+
+#include <assert.h>
+
+
+// Load the spans of the first row at or below row_y that has any tiles.
+static inline void _tuiPolygonItLoadRow(TuiPolygonIt* const it, int row_y)
+{
+	it->row_span_count = 0;
+	while (row_y <= it->bottom_y)
+	{
+		it->row_span_count = _tuiPolygonGetRowSpans(it->points, it->point_count, row_y, it->row_span_xs, TUI_POLYGON_IT_MAX_ROW_SPANS);
+		if (it->row_span_count > 0) break;
+		row_y++;
+	}
+	it->cur_y_position = row_y;
+	it->row_span_index = 0;
+	it->cur_x_position = (it->row_span_count > 0) ? it->row_span_xs[0] : 0;
+}
+
+TuiPolygonIt tuiPolygonIt(const TuiPolygon polygon)
+{
+	const TuiBoolean empty = !_tuiPolygonIsValid(polygon.points, polygon.point_count);
+	const int top_y = (empty) ? 0 : tuiPolygonGetTopY(polygon);
+	const int bottom_y = (empty) ? -1 : tuiPolygonGetBottomY(polygon);
+	TuiPolygonIt ret = { polygon.points, polygon.point_count, top_y, bottom_y, 0, 0, { 0 }, 0, top_y };
+	_tuiPolygonItLoadRow(&ret, top_y);
+	return ret;
+}
+
+TuiBoolean tuiPolygonItDone(const TuiPolygonIt it)
+{
+	return (it.cur_y_position > it.bottom_y);
+}
+
+void tuiPolygonItStepForward(TuiPolygonIt* const it)
+{
+	assert(it != NULL);
+	if (it->cur_x_position == it->row_span_xs[it->row_span_index * 2 + 1])
+	{
+		tuiPolygonItStepSpan(it);
+	}
+	else
+	{
+		it->cur_x_position++;
+	}
+}
+
+void tuiPolygonItStepSpan(TuiPolygonIt* const it)
+{
+	assert(it != NULL);
+	it->row_span_index++;
+	if (it->row_span_index < it->row_span_count)
+	{
+		it->cur_x_position = it->row_span_xs[it->row_span_index * 2];
+	}
+	else
+	{
+		_tuiPolygonItLoadRow(it, it->cur_y_position + 1);
+	}
+}
+
+void tuiPolygonItSetStart(TuiPolygonIt* const it)
+{
+	assert(it != NULL);
+	_tuiPolygonItLoadRow(it, it->top_y);
+}
+
+TuiPolygon tuiPolygonItGetPolygon(const TuiPolygonIt it)
+{
+	TuiPolygon ret = { it.points, it.point_count };
+	return ret;
+}
+
+TuiPoint2 tuiPolygonItGetPoint2(const TuiPolygonIt it)
+{
+	TuiPoint2 ret = { it.cur_x_position, it.cur_y_position };
+	return ret;
+}
+
+TuiSpan tuiPolygonItGetSpan(const TuiPolygonIt it)
+{
+	TuiSpan ret = { it.cur_y_position, it.cur_x_position, it.row_span_xs[it.row_span_index * 2 + 1] };
+	return ret;
+}
\ No newline at end of file
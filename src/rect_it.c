@@ -73,6 +73,18 @@ void tuiRectItStepBackward(TuiRectIt* const it)
 	}
 }
 
+void tuiRectItStepSpan(TuiRectIt* const it)
+{
+	if (it == TUI_NULL)
+	{
+		tuiDebugError(TUI_ERROR_NULL_GRID_SHAPE_ITERATOR, __func__);
+		return;
+	}
+
+	it->cur_y_position++;
+	it->cur_x_position = it->left_x;
+}
+
 void tuiRectItSetStart(TuiRectIt* const it)
 {
 	if (it == TUI_NULL)
@@ -96,3 +108,9 @@ TuiPoint2 tuiRectItGetPoint2(const TuiRectIt it)
 	TuiPoint2 point2 = { it.cur_x_position, it.cur_y_position };
 	return point2;
 }
+
+TuiSpan tuiRectItGetSpan(const TuiRectIt it)
+{
+	TuiSpan span = { it.cur_y_position, it.cur_x_position, it.right_x };
+	return span;
+}
@@ -0,0 +1,154 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/shape.h>
+#include <TUIC/circle.h>
+#include <TUIC/polygon.h>
+#include <TUIC/ellipse.h>
+#include "grid_shapes_inline.h"
+#include "math_inline.h"
+
+
+TuiShape tuiShapeRect(const TuiRect rect)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_RECT, .rect = rect };
+	return ret;
+}
+
+TuiShape tuiShapeBox(const TuiBox box)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_BOX, .box = box };
+	return ret;
+}
+
+TuiShape tuiShapeCropBox(const TuiCropBox crop_box)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_CROP_BOX, .crop_box = crop_box };
+	return ret;
+}
+
+TuiShape tuiShapeCircle(const TuiCircle circle)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_CIRCLE, .circle = circle };
+	return ret;
+}
+
+TuiShape tuiShapeCropCircle(const TuiCropCircle crop_circle)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_CROP_CIRCLE, .crop_circle = crop_circle };
+	return ret;
+}
+
+TuiShape tuiShapeRing(const TuiRing ring)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_RING, .ring = ring };
+	return ret;
+}
+
+TuiShape tuiShapeCropRing(const TuiCropRing crop_ring)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_CROP_RING, .crop_ring = crop_ring };
+	return ret;
+}
+
+TuiShape tuiShapePolygon(const TuiPolygon polygon)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_POLYGON, .polygon = polygon };
+	return ret;
+}
+
+TuiShape tuiShapeEllipse(const TuiEllipse ellipse)
+{
+	const TuiShape ret = { .type = TUI_SHAPE_TYPE_ELLIPSE, .ellipse = ellipse };
+	return ret;
+}
+
+// Get the first and last row a shape can cover.
+static inline void _tuiShapeGetRowRange(const TuiShape shape, int* const top_y, int* const bottom_y)
+{
+	switch (shape.type)
+	{
+	case TUI_SHAPE_TYPE_RECT:
+		*top_y = shape.rect.y;
+		*bottom_y = (shape.rect.height == 0) ? shape.rect.y : shape.rect.y + abs(shape.rect.height) - 1;
+		return;
+	case TUI_SHAPE_TYPE_BOX:
+		*top_y = shape.box.y;
+		*bottom_y = (shape.box.height == 0) ? shape.box.y : shape.box.y + abs(shape.box.height) - 1;
+		return;
+	case TUI_SHAPE_TYPE_CROP_BOX:
+		*top_y = MAX(shape.crop_box.y, shape.crop_box.crop_y);
+		*bottom_y = MIN(shape.crop_box.y + abs(shape.crop_box.height) - 1, shape.crop_box.crop_y + abs(shape.crop_box.crop_height) - 1);
+		return;
+	case TUI_SHAPE_TYPE_CIRCLE:
+		*top_y = tuiCircleGetTopY(shape.circle);
+		*bottom_y = tuiCircleGetBottomY(shape.circle);
+		return;
+	case TUI_SHAPE_TYPE_CROP_CIRCLE:
+		*top_y = MAX(shape.crop_circle.center_y - (int)roundf(fabsf(shape.crop_circle.radius)), shape.crop_circle.crop_y);
+		*bottom_y = MIN(shape.crop_circle.center_y + (int)roundf(fabsf(shape.crop_circle.radius)), shape.crop_circle.crop_y + abs(shape.crop_circle.crop_height) - 1);
+		return;
+	case TUI_SHAPE_TYPE_RING:
+		*top_y = shape.ring.center_y - (int)roundf(fabsf(shape.ring.radius));
+		*bottom_y = shape.ring.center_y + (int)roundf(fabsf(shape.ring.radius));
+		return;
+	case TUI_SHAPE_TYPE_CROP_RING:
+		*top_y = MAX(shape.crop_ring.center_y - (int)roundf(fabsf(shape.crop_ring.radius)), shape.crop_ring.crop_y);
+		*bottom_y = MIN(shape.crop_ring.center_y + (int)roundf(fabsf(shape.crop_ring.radius)), shape.crop_ring.crop_y + abs(shape.crop_ring.crop_height) - 1);
+		return;
+	case TUI_SHAPE_TYPE_POLYGON:
+		if (!_tuiPolygonIsValid(shape.polygon.points, shape.polygon.point_count)) break;
+		*top_y = tuiPolygonGetTopY(shape.polygon);
+		*bottom_y = tuiPolygonGetBottomY(shape.polygon);
+		return;
+	case TUI_SHAPE_TYPE_ELLIPSE:
+		*top_y = tuiEllipseGetTopY(shape.ellipse);
+		*bottom_y = tuiEllipseGetBottomY(shape.ellipse);
+		return;
+	default:
+		break;
+	}
+	*top_y = 0;
+	*bottom_y = -1;
+}
+
+int tuiShapeGetTopY(const TuiShape shape)
+{
+	int top_y, bottom_y;
+	_tuiShapeGetRowRange(shape, &top_y, &bottom_y);
+	return top_y;
+}
+
+int tuiShapeGetBottomY(const TuiShape shape)
+{
+	int top_y, bottom_y;
+	_tuiShapeGetRowRange(shape, &top_y, &bottom_y);
+	return bottom_y;
+}
+
+TuiBoolean tuiShapeContainsPoint2(const TuiShape shape, const TuiPoint2 point2)
+{
+	int span_xs[TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS * 2];
+	const int span_count = _tuiShapeGetRowSpans(&shape, point2.y, span_xs, TUI_COMPOSITE_SHAPE_MAX_ROW_SPANS);
+	for (int span_i = 0; span_i < span_count; span_i++)
+	{
+		if (span_xs[span_i * 2] <= point2.x && point2.x <= span_xs[span_i * 2 + 1]) return TUI_TRUE;
+	}
+	return TUI_FALSE;
+}
\ No newline at end of file
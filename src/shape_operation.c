@@ -0,0 +1,79 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/debug.h>
+#include <TUIC/shape_operation.h>
+#include <TUIC/boolean.h>
+#include <TUIC/types.h>
+#include <string.h>
+
+#define TO_STRING(value) #value
+
+const char* kTui_Shape_Operation_Union_Name = TO_STRING(TUI_SHAPE_OPERATION_UNION);
+
+const char* kTui_Shape_Operation_Intersection_Name = TO_STRING(TUI_SHAPE_OPERATION_INTERSECTION);
+
+const char* kTui_Shape_Operation_Difference_Name = TO_STRING(TUI_SHAPE_OPERATION_DIFFERENCE);
+
+const char* kTui_Shape_Operation_Xor_Name = TO_STRING(TUI_SHAPE_OPERATION_XOR);
+
+TuiBoolean tuiShapeOperationIsValid(TuiShapeOperation shape_operation)
+{
+	return
+		(shape_operation >= TUI_SHAPE_OPERATION_FIRST) &&
+		(shape_operation <= TUI_SHAPE_OPERATION_LAST);
+}
+
+const char* tuiShapeOperationToString(TuiShapeOperation shape_operation)
+{
+	switch (shape_operation)
+	{
+	case TUI_SHAPE_OPERATION_UNION:
+		return kTui_Shape_Operation_Union_Name;
+	case TUI_SHAPE_OPERATION_INTERSECTION:
+		return kTui_Shape_Operation_Intersection_Name;
+	case TUI_SHAPE_OPERATION_DIFFERENCE:
+		return kTui_Shape_Operation_Difference_Name;
+	case TUI_SHAPE_OPERATION_XOR:
+		return kTui_Shape_Operation_Xor_Name;
+	default:
+		return TUI_NULL;
+	}
+}
+
+TuiShapeOperation tuiStringToShapeOperation(const char* str)
+{
+	if (strcmp(str, kTui_Shape_Operation_Union_Name) == 0)
+	{
+		return TUI_SHAPE_OPERATION_UNION;
+	}
+	else if (strcmp(str, kTui_Shape_Operation_Intersection_Name) == 0)
+	{
+		return TUI_SHAPE_OPERATION_INTERSECTION;
+	}
+	else if (strcmp(str, kTui_Shape_Operation_Difference_Name) == 0)
+	{
+		return TUI_SHAPE_OPERATION_DIFFERENCE;
+	}
+	else if (strcmp(str, kTui_Shape_Operation_Xor_Name) == 0)
+	{
+		return TUI_SHAPE_OPERATION_XOR;
+	}
+	return TUI_SHAPE_OPERATION_INVALID;
+}
\ No newline at end of file
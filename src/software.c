@@ -0,0 +1,723 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/tuic.h>
+#include "objects.h"
+#include "parallel.h"
+#include "software.h"
+#include "glyph_coordinates_inline.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// Rows of the target rasterized by one parallel job. Jobs own whole rows, so no two threads ever blend into the same pixel and tiles still blend in the order they were pushed.
+#define TUI_SOFTWARE_BAND_HEIGHT 16
+// Pixels of one tile row shaded and blended together. The channels of a span are kept in separate arrays so the shade and blend loops are plain float arithmetic the compiler can vectorize.
+#define TUI_SOFTWARE_SPAN_WIDTH 64
+// Targets with fewer pixels than this are rasterized on the calling thread, where starting threads would cost more than it saves.
+#define TUI_SOFTWARE_PARALLEL_PIXEL_COUNT 16384
+
+typedef struct TuiSoftwareSystemApiData
+{
+	int ThreadCount;
+} TuiSoftwareSystemApiData;
+
+typedef struct TuiSoftwareAtlasApiData
+{
+	// Every page expanded to RGBA with the swizzle the Opengl33 backend samples its channel count with, one page after another.
+	uint8_t* Pixels;
+	// 4 values for every glyph of atlases without a grid, packed like the coordinates buffer of the Opengl33 backend.
+	uint32_t* PackedCoordinates;
+} TuiSoftwareAtlasApiData;
+
+typedef struct TuiSoftwareTextureApiData
+{
+	uint8_t* Pixels;
+} TuiSoftwareTextureApiData;
+
+typedef struct TuiSoftwarePanelApiData
+{
+	uint8_t* Pixels;
+} TuiSoftwarePanelApiData;
+
+typedef struct TuiSoftwarePixelReadbackApiData
+{
+	// The last capture, from the top row down like the pixels of a panel.
+	uint8_t* Pixels;
+} TuiSoftwarePixelReadbackApiData;
+
+typedef struct TuiSoftwareTile
+{
+	// Pixels of the target the tile covers, clipped to the target, from the first inclusive to the last exclusive.
+	int FirstX;
+	int LastX;
+	int FirstY;
+	int LastY;
+	// Edges of the tile in target pixels before clipping, which texture coordinates are interpolated across like vertex outputs.
+	float Left;
+	float Top;
+	float Width;
+	float Height;
+	// Normalized texture coordinates at the left, top, right and bottom edges.
+	float U0;
+	float V0;
+	float U1;
+	float V1;
+	int Page;
+	float Foreground[4];
+	float Background[4];
+} TuiSoftwareTile;
+
+typedef struct TuiSoftwareDraw
+{
+	uint8_t* Target;
+	int TargetWidth;
+	int TargetHeight;
+	const TuiSoftwareTile* Tiles;
+	int TileCount;
+	const uint8_t* Source;
+	int SourceWidth;
+	int SourceHeight;
+	// Console tiles mix their foreground and background with the texel like the batch fragment shaders. Panels and textures are drawn with their texels as they are.
+	TuiBoolean Shade;
+	TuiBoolean DistanceField;
+	TuiBoolean MultiChannel;
+} TuiSoftwareDraw;
+
+typedef struct TuiSoftwareSpan
+{
+	float R[TUI_SOFTWARE_SPAN_WIDTH];
+	float G[TUI_SOFTWARE_SPAN_WIDTH];
+	float B[TUI_SOFTWARE_SPAN_WIDTH];
+	float A[TUI_SOFTWARE_SPAN_WIDTH];
+} TuiSoftwareSpan;
+
+//Copy pixels of an atlas channel count into RGBA pixels, swizzled like _GetAtlasFormat of the Opengl33 backend.
+static inline void _ExpandAtlasPixels(size_t channel_count, const uint8_t* pixels, size_t pixel_count, uint8_t* rgba_pixels)
+{
+	for (size_t pixel_i = 0; pixel_i < pixel_count; pixel_i++)
+	{
+		const uint8_t* pixel = &pixels[pixel_i * channel_count];
+		uint8_t* rgba_pixel = &rgba_pixels[pixel_i * 4];
+		switch (channel_count)
+		{
+		case 1:
+			rgba_pixel[0] = 255;
+			rgba_pixel[1] = 255;
+			rgba_pixel[2] = 255;
+			rgba_pixel[3] = pixel[0];
+			break;
+		case 2:
+			rgba_pixel[0] = pixel[1];
+			rgba_pixel[1] = pixel[1];
+			rgba_pixel[2] = pixel[1];
+			rgba_pixel[3] = pixel[0];
+			break;
+		case 3:
+			rgba_pixel[0] = pixel[0];
+			rgba_pixel[1] = pixel[1];
+			rgba_pixel[2] = pixel[2];
+			rgba_pixel[3] = 255;
+			break;
+		default:
+			memcpy(rgba_pixel, pixel, 4);
+			break;
+		}
+	}
+}
+//Get the pixels of the target an edge range covers. A pixel is covered when its center is inside the range, with the low edge inclusive, like the rasterization rules of OpenGL.
+static inline void _CoveredPixels(float low_edge, float high_edge, int target_size, int* first, int* last)
+{
+	int first_pixel = (int)ceilf(low_edge - 0.5f);
+	int last_pixel = (int)ceilf(high_edge - 0.5f);
+	*first = (first_pixel < 0) ? 0 : first_pixel;
+	*last = (last_pixel > target_size) ? target_size : last_pixel;
+}
+//Place a tile at the given edges in target pixels with the texture coordinates of its edges. Edges given in reverse mirror the tile like a flipped draw rectangle does.
+static inline void _SetTileEdges(TuiSoftwareTile* tile, int target_width, int target_height, float left, float right, float top, float bottom, float u0, float u1, float v0, float v1)
+{
+	if (left > right)
+	{
+		float swap = left;
+		left = right;
+		right = swap;
+		swap = u0;
+		u0 = u1;
+		u1 = swap;
+	}
+	if (top > bottom)
+	{
+		float swap = top;
+		top = bottom;
+		bottom = swap;
+		swap = v0;
+		v0 = v1;
+		v1 = swap;
+	}
+	tile->Left = left;
+	tile->Top = top;
+	tile->Width = right - left;
+	tile->Height = bottom - top;
+	tile->U0 = u0;
+	tile->U1 = u1;
+	tile->V0 = v0;
+	tile->V1 = v1;
+	_CoveredPixels(left, right, target_width, &tile->FirstX, &tile->LastX);
+	_CoveredPixels(top, bottom, target_height, &tile->FirstY, &tile->LastY);
+}
+//Get the texel column or row of a source with the given size sampled at the center of a target pixel, with nearest filtering and edges clamped.
+static inline int _SampleTexel(float pixel, float edge, float extent, float uv0, float uv1, int source_size)
+{
+	const float uv = uv0 + ((pixel + 0.5f - edge) / extent) * (uv1 - uv0);
+	int texel = (int)floorf(uv * (float)source_size);
+	return (texel < 0) ? 0 : ((texel >= source_size) ? source_size - 1 : texel);
+}
+static inline const uint8_t* _SampleSource(const TuiSoftwareDraw* draw, const TuiSoftwareTile* tile, int x, int y)
+{
+	const int column = _SampleTexel((float)x, tile->Left, tile->Width, tile->U0, tile->U1, draw->SourceWidth);
+	const int row = _SampleTexel((float)y, tile->Top, tile->Height, tile->V0, tile->V1, draw->SourceHeight);
+	return &draw->Source[((((size_t)tile->Page * (size_t)draw->SourceHeight) + (size_t)row) * (size_t)draw->SourceWidth + (size_t)column) * 4];
+}
+static inline float _SampleDistance(const TuiSoftwareDraw* draw, const TuiSoftwareTile* tile, int x, int y)
+{
+	const uint8_t* texel = _SampleSource(draw, tile, x, y);
+	if (draw->MultiChannel)
+	{
+		const float r = (float)texel[0] / 255.0f;
+		const float g = (float)texel[1] / 255.0f;
+		const float b = (float)texel[2] / 255.0f;
+		return fmaxf(fminf(r, g), fminf(fmaxf(r, g), b));
+	}
+	return (float)texel[3] / 255.0f;
+}
+//Gather the texels of a span of a tile row.
+static inline void _SampleSpan(const TuiSoftwareDraw* draw, const TuiSoftwareTile* tile, int x, int y, int count, TuiSoftwareSpan* span)
+{
+	const int row = _SampleTexel((float)y, tile->Top, tile->Height, tile->V0, tile->V1, draw->SourceHeight);
+	const uint8_t* row_texels = &draw->Source[(((size_t)tile->Page * (size_t)draw->SourceHeight) + (size_t)row) * (size_t)draw->SourceWidth * 4];
+	for (int i = 0; i < count; i++)
+	{
+		const int column = _SampleTexel((float)(x + i), tile->Left, tile->Width, tile->U0, tile->U1, draw->SourceWidth);
+		const uint8_t* texel = &row_texels[(size_t)column * 4];
+		span->R[i] = (float)texel[0] / 255.0f;
+		span->G[i] = (float)texel[1] / 255.0f;
+		span->B[i] = (float)texel[2] / 255.0f;
+		span->A[i] = (float)texel[3] / 255.0f;
+	}
+}
+//Gather the color and coverage of a span of a distance field tile row into the texel slots, the same as the batch distance field fragment shader.
+static inline void _SampleDistanceFieldSpan(const TuiSoftwareDraw* draw, const TuiSoftwareTile* tile, int x, int y, int count, TuiSoftwareSpan* span)
+{
+	// fwidth is taken across the 2x2 pixel quads of the framebuffer, whose rows count from the bottom.
+	const int quad_y = draw->TargetHeight - 1 - ((draw->TargetHeight - 1 - y) ^ 1);
+	for (int i = 0; i < count; i++)
+	{
+		const int pixel_x = x + i;
+		const uint8_t* texel = _SampleSource(draw, tile, pixel_x, y);
+		const float distance = _SampleDistance(draw, tile, pixel_x, y);
+		const float dx = distance - _SampleDistance(draw, tile, pixel_x ^ 1, y);
+		const float dy = distance - _SampleDistance(draw, tile, pixel_x, quad_y);
+		const float edge_width = fmaxf((fabsf(dx) + fabsf(dy)) * 0.5f, 0.0001f);
+		float t = (distance - (0.5f - edge_width)) / (2.0f * edge_width);
+		t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+		span->R[i] = draw->MultiChannel ? 1.0f : (float)texel[0] / 255.0f;
+		span->G[i] = draw->MultiChannel ? 1.0f : (float)texel[1] / 255.0f;
+		span->B[i] = draw->MultiChannel ? 1.0f : (float)texel[2] / 255.0f;
+		span->A[i] = t * t * (3.0f - 2.0f * t);
+	}
+}
+//Mix the background of a tile with its foreground tinted by the texels: mix(BG, FG * vec4(c.rgb, 1.0), c.a).
+static inline void _ShadeSpan(const TuiSoftwareTile* tile, int count, TuiSoftwareSpan* span)
+{
+	const float fg_r = tile->Foreground[0], fg_g = tile->Foreground[1], fg_b = tile->Foreground[2], fg_a = tile->Foreground[3];
+	const float bg_r = tile->Background[0], bg_g = tile->Background[1], bg_b = tile->Background[2], bg_a = tile->Background[3];
+	for (int i = 0; i < count; i++)
+	{
+		const float a = span->A[i];
+		span->R[i] = bg_r + (fg_r * span->R[i] - bg_r) * a;
+		span->G[i] = bg_g + (fg_g * span->G[i] - bg_g) * a;
+		span->B[i] = bg_b + (fg_b * span->B[i] - bg_b) * a;
+		span->A[i] = bg_a + (fg_a - bg_a) * a;
+	}
+}
+//Blend a span over the target pixels with GL_SRC_ALPHA and GL_ONE_MINUS_SRC_ALPHA for every channel, and store the result rounded to the nearest 8 bit value.
+static inline void _BlendSpan(const TuiSoftwareSpan* span, int count, uint8_t* pixels)
+{
+	TuiSoftwareSpan destination;
+	for (int i = 0; i < count; i++)
+	{
+		destination.R[i] = (float)pixels[i * 4 + 0] / 255.0f;
+		destination.G[i] = (float)pixels[i * 4 + 1] / 255.0f;
+		destination.B[i] = (float)pixels[i * 4 + 2] / 255.0f;
+		destination.A[i] = (float)pixels[i * 4 + 3] / 255.0f;
+	}
+	for (int i = 0; i < count; i++)
+	{
+		const float a = span->A[i];
+		const float inverse_a = 1.0f - a;
+		destination.R[i] = fminf(fmaxf(span->R[i] * a + destination.R[i] * inverse_a, 0.0f), 1.0f) * 255.0f + 0.5f;
+		destination.G[i] = fminf(fmaxf(span->G[i] * a + destination.G[i] * inverse_a, 0.0f), 1.0f) * 255.0f + 0.5f;
+		destination.B[i] = fminf(fmaxf(span->B[i] * a + destination.B[i] * inverse_a, 0.0f), 1.0f) * 255.0f + 0.5f;
+		destination.A[i] = fminf(fmaxf(span->A[i] * a + destination.A[i] * inverse_a, 0.0f), 1.0f) * 255.0f + 0.5f;
+	}
+	for (int i = 0; i < count; i++)
+	{
+		pixels[i * 4 + 0] = (uint8_t)destination.R[i];
+		pixels[i * 4 + 1] = (uint8_t)destination.G[i];
+		pixels[i * 4 + 2] = (uint8_t)destination.B[i];
+		pixels[i * 4 + 3] = (uint8_t)destination.A[i];
+	}
+}
+//Rasterize every tile of a draw over one band of target rows, in the order of the tiles.
+static void _RasterizeBand(void* user_data, int band_index)
+{
+	const TuiSoftwareDraw* draw = (const TuiSoftwareDraw*)user_data;
+	const int band_first_y = band_index * TUI_SOFTWARE_BAND_HEIGHT;
+	const int band_last_y = (band_first_y + TUI_SOFTWARE_BAND_HEIGHT < draw->TargetHeight) ? band_first_y + TUI_SOFTWARE_BAND_HEIGHT : draw->TargetHeight;
+	TuiSoftwareSpan span;
+	for (int tile_i = 0; tile_i < draw->TileCount; tile_i++)
+	{
+		const TuiSoftwareTile* tile = &draw->Tiles[tile_i];
+		const int first_y = (tile->FirstY > band_first_y) ? tile->FirstY : band_first_y;
+		const int last_y = (tile->LastY < band_last_y) ? tile->LastY : band_last_y;
+		for (int y = first_y; y < last_y; y++)
+		{
+			for (int x = tile->FirstX; x < tile->LastX; x += TUI_SOFTWARE_SPAN_WIDTH)
+			{
+				const int count = (tile->LastX - x < TUI_SOFTWARE_SPAN_WIDTH) ? tile->LastX - x : TUI_SOFTWARE_SPAN_WIDTH;
+				if (draw->DistanceField)
+				{
+					_SampleDistanceFieldSpan(draw, tile, x, y, count, &span);
+				}
+				else
+				{
+					_SampleSpan(draw, tile, x, y, count, &span);
+				}
+				if (draw->Shade)
+				{
+					_ShadeSpan(tile, count, &span);
+				}
+				_BlendSpan(&span, count, &draw->Target[((size_t)y * (size_t)draw->TargetWidth + (size_t)x) * 4]);
+			}
+		}
+	}
+}
+static void _RasterizeDraw(TuiSoftwareDraw* draw)
+{
+	TuiSystem system = tui_get_system();
+	TuiSoftwareSystemApiData* system_data = (TuiSoftwareSystemApiData*)system->ApiData;
+	const int band_count = (draw->TargetHeight + TUI_SOFTWARE_BAND_HEIGHT - 1) / TUI_SOFTWARE_BAND_HEIGHT;
+	const size_t pixel_count = (size_t)draw->TargetWidth * (size_t)draw->TargetHeight;
+	tui_parallel_for(band_count, (pixel_count < TUI_SOFTWARE_PARALLEL_PIXEL_COUNT) ? 1 : system_data->ThreadCount, _RasterizeBand, draw);
+}
+//Draw a whole source image stretched over a rectangle of a panel, like _RenderTextureToFramebuffer of the Opengl33 backend.
+static TuiResult _DrawImage(TuiPanel panel, const uint8_t* pixels, int pixel_width, int pixel_height, int left_x, int right_x, int top_y, int bottom_y)
+{
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)panel->ApiData;
+	TuiSoftwareTile tile;
+	memset(&tile, 0, sizeof(TuiSoftwareTile));
+	_SetTileEdges(&tile, (int)panel->PixelWidth, (int)panel->PixelHeight, (float)left_x, (float)right_x, (float)top_y, (float)bottom_y, 0.0f, 1.0f, 0.0f, 1.0f);
+	TuiSoftwareDraw draw;
+	memset(&draw, 0, sizeof(TuiSoftwareDraw));
+	draw.Target = panel_data->Pixels;
+	draw.TargetWidth = (int)panel->PixelWidth;
+	draw.TargetHeight = (int)panel->PixelHeight;
+	draw.Tiles = &tile;
+	draw.TileCount = 1;
+	draw.Source = pixels;
+	draw.SourceWidth = pixel_width;
+	draw.SourceHeight = pixel_height;
+	_RasterizeDraw(&draw);
+	return TUI_RESULT_OK;
+}
+TuiResult tuiSystemCreate_Software()
+{
+	TuiSystem system = tui_get_system();
+	TuiSoftwareSystemApiData* system_data = (TuiSoftwareSystemApiData*)tuiAllocate(sizeof(TuiSoftwareSystemApiData));
+	if (system_data == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	system_data->ThreadCount = tui_get_hardware_thread_count();
+	system->ApiData = system_data;
+	return TUI_RESULT_OK;
+}
+void tuiSystemDestroy_Software()
+{
+	TuiSystem system = tui_get_system();
+	tuiFree(system->ApiData);
+	system->ApiData = TUI_NULL;
+}
+TuiResult tuiAtlasCreate_Software(TuiAtlas atlas, const uint8_t* pixel_data, const float* stpqp_coordinates)
+{
+	TuiSoftwareAtlasApiData* atlas_data = (TuiSoftwareAtlasApiData*)tuiAllocate(sizeof(TuiSoftwareAtlasApiData));
+	if (atlas_data == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(atlas_data, 0, sizeof(TuiSoftwareAtlasApiData));
+	atlas->ApiData = atlas_data;
+	const size_t pixel_count = atlas->Width * atlas->Height * atlas->Pages;
+	atlas_data->Pixels = (uint8_t*)tuiAllocate(pixel_count * 4);
+	if (atlas_data->Pixels == TUI_NULL)
+	{
+		tuiAtlasDestroy_Software(atlas);
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	if (pixel_data != TUI_NULL)
+	{
+		_ExpandAtlasPixels(atlas->Channels, pixel_data, pixel_count, atlas_data->Pixels);
+	}
+	else
+	{
+		memset(atlas_data->Pixels, 0, pixel_count * 4);
+	}
+	if (atlas->GridColumns == 0)
+	{
+		atlas_data->PackedCoordinates = (uint32_t*)tuiAllocate(atlas->GlyphCount * 4 * sizeof(uint32_t));
+		if (atlas_data->PackedCoordinates == TUI_NULL)
+		{
+			tuiAtlasDestroy_Software(atlas);
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		for (size_t glyph_i = 0; glyph_i < atlas->GlyphCount; glyph_i++)
+		{
+			_tuiPackGlyphCoordinates(atlas->Width, atlas->Height, &stpqp_coordinates[glyph_i * TUI_STPQP_COORDINATES_PER_GLYPH], &atlas_data->PackedCoordinates[glyph_i * 4]);
+		}
+	}
+	return TUI_RESULT_OK;
+}
+void tuiAtlasDestroy_Software(TuiAtlas atlas)
+{
+	TuiSoftwareAtlasApiData* atlas_data = (TuiSoftwareAtlasApiData*)atlas->ApiData;
+	if (atlas_data == TUI_NULL)
+	{
+		return;
+	}
+	if (atlas_data->Pixels != TUI_NULL)
+	{
+		tuiFree(atlas_data->Pixels);
+	}
+	if (atlas_data->PackedCoordinates != TUI_NULL)
+	{
+		tuiFree(atlas_data->PackedCoordinates);
+	}
+	tuiFree(atlas_data);
+	atlas->ApiData = TUI_NULL;
+}
+TuiResult tuiAtlasCreateGlyphCache_Software(TuiAtlas atlas, const float* stpqp_coordinates)
+{
+	return tuiAtlasCreate_Software(atlas, TUI_NULL, stpqp_coordinates);
+}
+TuiResult tuiAtlasUpdateGlyph_Software(TuiAtlas atlas, int glyph_index, int page, int x, int y, int cell_width, int cell_height, const uint8_t* pixels, const float* stpqp_coordinates)
+{
+	TuiSoftwareAtlasApiData* atlas_data = (TuiSoftwareAtlasApiData*)atlas->ApiData;
+	for (int row_i = 0; row_i < cell_height; row_i++)
+	{
+		const size_t page_row = (size_t)page * atlas->Height + (size_t)(y + row_i);
+		_ExpandAtlasPixels(atlas->Channels, &pixels[(size_t)row_i * (size_t)cell_width * atlas->Channels], (size_t)cell_width, &atlas_data->Pixels[(page_row * atlas->Width + (size_t)x) * 4]);
+	}
+	_tuiPackGlyphCoordinates(atlas->Width, atlas->Height, stpqp_coordinates, &atlas_data->PackedCoordinates[(size_t)glyph_index * 4]);
+	return TUI_RESULT_OK;
+}
+TuiResult tuiTextureCreate_Software(TuiTexture texture, const uint8_t* pixels)
+{
+	TuiSoftwareTextureApiData* texture_data = (TuiSoftwareTextureApiData*)tuiAllocate(sizeof(TuiSoftwareTextureApiData));
+	if (texture_data == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	const size_t byte_count = texture->PixelWidth * texture->PixelHeight * 4;
+	texture_data->Pixels = (uint8_t*)tuiAllocate(byte_count);
+	if (texture_data->Pixels == TUI_NULL)
+	{
+		tuiFree(texture_data);
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memcpy(texture_data->Pixels, pixels, byte_count);
+	texture->ApiData = texture_data;
+	return TUI_RESULT_OK;
+}
+TuiResult tuiTextureUpdateRegion_Software(TuiTexture texture, const uint8_t* pixels, int x, int y, int width, int height, size_t row_pitch)
+{
+	TuiSoftwareTextureApiData* texture_data = (TuiSoftwareTextureApiData*)texture->ApiData;
+	for (int row_i = 0; row_i < height; row_i++)
+	{
+		memcpy(&texture_data->Pixels[((size_t)(y + row_i) * texture->PixelWidth + (size_t)x) * 4], &pixels[(size_t)row_i * row_pitch], (size_t)width * 4);
+	}
+	return TUI_RESULT_OK;
+}
+void tuiTextureDestroy_Software(TuiTexture texture)
+{
+	TuiSoftwareTextureApiData* texture_data = (TuiSoftwareTextureApiData*)texture->ApiData;
+	tuiFree(texture_data->Pixels);
+	tuiFree(texture_data);
+}
+TuiResult tuiPanelCreate_Software(TuiPanel panel)
+{
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)tuiAllocate(sizeof(TuiSoftwarePanelApiData));
+	if (panel_data == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	const size_t byte_count = panel->PixelWidth * panel->PixelHeight * 4;
+	panel_data->Pixels = (uint8_t*)tuiAllocate(byte_count);
+	if (panel_data->Pixels == TUI_NULL)
+	{
+		tuiFree(panel_data);
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(panel_data->Pixels, 0, byte_count);
+	panel->ApiData = panel_data;
+	return TUI_RESULT_OK;
+}
+void tuiPanelDestroy_Software(TuiPanel panel)
+{
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)panel->ApiData;
+	tuiFree(panel_data->Pixels);
+	tuiFree(panel_data);
+}
+TuiResult tuiPanelGetPixels_Software(TuiPanel panel, uint8_t** pixels, int* pixel_width, int* pixel_height)
+{
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)panel->ApiData;
+	const size_t byte_count = panel->PixelWidth * panel->PixelHeight * 4;
+	if (*pixels == TUI_NULL)
+	{
+		*pixels = (uint8_t*)tuiAllocate(byte_count);
+	}
+	else if (pixel_width == TUI_NULL || pixel_height == TUI_NULL || (size_t)*pixel_width != panel->PixelWidth || (size_t)*pixel_height != panel->PixelHeight)
+	{
+		*pixels = (uint8_t*)tuiReallocate(*pixels, byte_count);
+	}
+	if (*pixels == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	// Panel pixels are already stored from the top row down, so unlike glReadPixels they need no vertical flip.
+	memcpy(*pixels, panel_data->Pixels, byte_count);
+	if (pixel_width != TUI_NULL)
+	{
+		*pixel_width = (int)panel->PixelWidth;
+	}
+	if (pixel_height != TUI_NULL)
+	{
+		*pixel_height = (int)panel->PixelHeight;
+	}
+	return TUI_RESULT_OK;
+}
+TuiResult tuiPanelClearColor_Software(TuiPanel panel, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)panel->ApiData;
+	const size_t row_byte_count = panel->PixelWidth * 4;
+	for (size_t x = 0; x < panel->PixelWidth; x++)
+	{
+		panel_data->Pixels[x * 4 + 0] = r;
+		panel_data->Pixels[x * 4 + 1] = g;
+		panel_data->Pixels[x * 4 + 2] = b;
+		panel_data->Pixels[x * 4 + 3] = a;
+	}
+	for (size_t y = 1; y < panel->PixelHeight; y++)
+	{
+		memcpy(&panel_data->Pixels[y * row_byte_count], panel_data->Pixels, row_byte_count);
+	}
+	return TUI_RESULT_OK;
+}
+TuiResult tuiPanelSetPixelDimensions_Software(TuiPanel panel, int pixel_width, int pixel_height)
+{
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)panel->ApiData;
+	if (panel->PixelWidth == (size_t)pixel_width && panel->PixelHeight == (size_t)pixel_height)
+	{
+		return TUI_RESULT_OK;
+	}
+	const size_t byte_count = (size_t)pixel_width * (size_t)pixel_height * 4;
+	uint8_t* pixels = (uint8_t*)tuiAllocate(byte_count);
+	if (pixels == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(pixels, 0, byte_count);
+	tuiFree(panel_data->Pixels);
+	panel_data->Pixels = pixels;
+	panel->PixelWidth = (size_t)pixel_width;
+	panel->PixelHeight = (size_t)pixel_height;
+	return TUI_RESULT_OK;
+}
+TuiResult tuiPanelDrawConsole_Software(TuiPanel panel, TuiAtlas atlas, TuiConsole console, int left_x, int right_x, int top_y, int bottom_y)
+{
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)panel->ApiData;
+	TuiSoftwareAtlasApiData* atlas_data = (TuiSoftwareAtlasApiData*)atlas->ApiData;
+	if (console->TileDataCount == 0 || console->PixelWidth == 0 || console->PixelHeight == 0)
+	{
+		return TUI_RESULT_OK;
+	}
+	TuiSoftwareTile* tiles = (TuiSoftwareTile*)tuiAllocate(console->TileDataCount * sizeof(TuiSoftwareTile));
+	if (tiles == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	// Console pixels are mapped over the draw rectangle like ConsolePixelUnitSize does in the batch vertex shader.
+	const float scale_x = (float)(right_x - left_x) / (float)console->PixelWidth;
+	const float scale_y = (float)(bottom_y - top_y) / (float)console->PixelHeight;
+	const int cells_per_page = atlas->GridColumns * atlas->GridRows;
+	for (size_t tile_i = 0; tile_i < console->TileDataCount; tile_i++)
+	{
+		const uint8_t* data = &console->TileData[tile_i * TUIC_CONSOLE_DATA_BYTES_PER_TILE];
+		TuiSoftwareTile* tile = &tiles[tile_i];
+		const float pixel_x = (float)((int)(data[0] | (data[1] << 8)) - (int)TUI_CONSOLE_DATA_TILE_POSITION_OFFSET);
+		const float pixel_y = (float)((int)(data[2] | (data[3] << 8)) - (int)TUI_CONSOLE_DATA_TILE_POSITION_OFFSET);
+		const float pixel_w = (float)(data[4] | (data[5] << 8));
+		const float pixel_h = (float)(data[6] | (data[7] << 8));
+		const int glyph = data[8] | (data[9] << 8);
+		float u0 = 0.0f, u1 = 0.0f, v0 = 0.0f, v1 = 0.0f;
+		int page = 0;
+		if (cells_per_page > 0)
+		{
+			const int cell = glyph % cells_per_page;
+			u0 = (float)(cell % atlas->GridColumns) / (float)atlas->GridColumns;
+			u1 = (float)(cell % atlas->GridColumns + 1) / (float)atlas->GridColumns;
+			v0 = (float)(cell / atlas->GridColumns) / (float)atlas->GridRows;
+			v1 = (float)(cell / atlas->GridColumns + 1) / (float)atlas->GridRows;
+			page = glyph / cells_per_page;
+		}
+		else if ((size_t)glyph < atlas->GlyphCount)
+		{
+			// Glyphs past the end of the coordinates buffer read as zero there, so they keep the zero coordinates here.
+			const uint32_t* packed_coordinates = &atlas_data->PackedCoordinates[(size_t)glyph * 4];
+			u0 = (float)(packed_coordinates[0] & 65535u) / (float)atlas->Width;
+			v0 = (float)(packed_coordinates[0] >> 16u) / (float)atlas->Height;
+			u1 = (float)(packed_coordinates[1] & 65535u) / (float)atlas->Width;
+			v1 = (float)(packed_coordinates[1] >> 16u) / (float)atlas->Height;
+			page = (int)packed_coordinates[2];
+		}
+		tile->Page = (page >= (int)atlas->Pages) ? (int)atlas->Pages - 1 : page;
+		for (int channel_i = 0; channel_i < 4; channel_i++)
+		{
+			tile->Foreground[channel_i] = (float)data[10 + channel_i] / 255.0f;
+			tile->Background[channel_i] = (float)data[14 + channel_i] / 255.0f;
+		}
+		const float left = (float)left_x + pixel_x * scale_x;
+		const float top = (float)top_y + pixel_y * scale_y;
+		_SetTileEdges(tile, (int)panel->PixelWidth, (int)panel->PixelHeight, left, left + pixel_w * scale_x, top, top + pixel_h * scale_y, u0, u1, v0, v1);
+	}
+	TuiSoftwareDraw draw;
+	memset(&draw, 0, sizeof(TuiSoftwareDraw));
+	draw.Target = panel_data->Pixels;
+	draw.TargetWidth = (int)panel->PixelWidth;
+	draw.TargetHeight = (int)panel->PixelHeight;
+	draw.Tiles = tiles;
+	draw.TileCount = (int)console->TileDataCount;
+	draw.Source = atlas_data->Pixels;
+	draw.SourceWidth = (int)atlas->Width;
+	draw.SourceHeight = (int)atlas->Height;
+	draw.Shade = TUI_TRUE;
+	draw.DistanceField = atlas->DistanceField;
+	draw.MultiChannel = (atlas->Channels >= 3) ? TUI_TRUE : TUI_FALSE;
+	_RasterizeDraw(&draw);
+	tuiFree(tiles);
+	return TUI_RESULT_OK;
+}
+TuiResult tuiPanelDrawPanel_Software(TuiPanel panel, TuiPanel subject_panel, int left_x, int right_x, int top_y, int bottom_y)
+{
+	TuiSoftwarePanelApiData* subject_panel_data = (TuiSoftwarePanelApiData*)subject_panel->ApiData;
+	if (subject_panel == panel)
+	{
+		// Bands read rows other bands are writing, so a panel can not be its own source.
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	return _DrawImage(panel, subject_panel_data->Pixels, (int)subject_panel->PixelWidth, (int)subject_panel->PixelHeight, left_x, right_x, top_y, bottom_y);
+}
+TuiResult tuiPanelDrawTexture_Software(TuiPanel panel, TuiTexture texture, int left_x, int right_x, int top_y, int bottom_y)
+{
+	TuiSoftwareTextureApiData* texture_data = (TuiSoftwareTextureApiData*)texture->ApiData;
+	return _DrawImage(panel, texture_data->Pixels, (int)texture->PixelWidth, (int)texture->PixelHeight, left_x, right_x, top_y, bottom_y);
+}
+TuiResult tuiPanelDrawCommands_Software(TuiPanel panel, const struct TuiDrawCommand* commands, int command_count)
+{
+	for (int command_i = 0; command_i < command_count; command_i++)
+	{
+		const TuiDrawCommand* command = &commands[command_i];
+		TuiResult result = TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+		switch (command->Type)
+		{
+		case TUI_DRAW_COMMAND_CONSOLE:
+			result = tuiPanelDrawConsole_Software(panel, command->Atlas, command->Console, command->LeftX, command->RightX, command->TopY, command->BottomY);
+			break;
+		case TUI_DRAW_COMMAND_PANEL:
+			result = tuiPanelDrawPanel_Software(panel, command->SubjectPanel, command->LeftX, command->RightX, command->TopY, command->BottomY);
+			break;
+		case TUI_DRAW_COMMAND_TEXTURE:
+			result = tuiPanelDrawTexture_Software(panel, command->Texture, command->LeftX, command->RightX, command->TopY, command->BottomY);
+			break;
+		default:
+			// Windows only exist with the Opengl33 backend.
+			break;
+		}
+		if (result != TUI_RESULT_OK)
+		{
+			return result;
+		}
+	}
+	return TUI_RESULT_OK;
+}
+TuiResult tuiPixelReadbackCreate_Software(TuiPixelReadback pixel_readback)
+{
+	TuiSoftwarePixelReadbackApiData* readback_data = (TuiSoftwarePixelReadbackApiData*)tuiAllocate(sizeof(TuiSoftwarePixelReadbackApiData));
+	if (readback_data == TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(readback_data, 0, sizeof(TuiSoftwarePixelReadbackApiData));
+	pixel_readback->ApiData = readback_data;
+	return TUI_RESULT_OK;
+}
+void tuiPixelReadbackDestroy_Software(TuiPixelReadback pixel_readback)
+{
+	TuiSoftwarePixelReadbackApiData* readback_data = (TuiSoftwarePixelReadbackApiData*)pixel_readback->ApiData;
+	tuiFree(readback_data->Pixels);
+	tuiFree(readback_data);
+}
+TuiResult tuiPixelReadbackCapturePanel_Software(TuiPixelReadback pixel_readback, TuiPanel panel)
+{
+	TuiSoftwarePixelReadbackApiData* readback_data = (TuiSoftwarePixelReadbackApiData*)pixel_readback->ApiData;
+	TuiSoftwarePanelApiData* panel_data = (TuiSoftwarePanelApiData*)panel->ApiData;
+	const size_t byte_count = panel->PixelWidth * panel->PixelHeight * 4;
+	if (readback_data->Pixels == TUI_NULL || pixel_readback->PixelWidth != (int)panel->PixelWidth || pixel_readback->PixelHeight != (int)panel->PixelHeight)
+	{
+		uint8_t* pixels = (uint8_t*)tuiReallocate(readback_data->Pixels, byte_count);
+		if (pixels == TUI_NULL)
+		{
+			return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+		}
+		readback_data->Pixels = pixels;
+		pixel_readback->PixelWidth = (int)panel->PixelWidth;
+		pixel_readback->PixelHeight = (int)panel->PixelHeight;
+	}
+	// Software panels are already in memory, so the capture is finished as soon as it is copied.
+	memcpy(readback_data->Pixels, panel_data->Pixels, byte_count);
+	pixel_readback->Captured = TUI_TRUE;
+	pixel_readback->Pending = TUI_FALSE;
+	return TUI_RESULT_OK;
+}
+const uint8_t* tuiPixelReadbackMap_Software(TuiPixelReadback pixel_readback)
+{
+	TuiSoftwarePixelReadbackApiData* readback_data = (TuiSoftwarePixelReadbackApiData*)pixel_readback->ApiData;
+	return readback_data->Pixels;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*! \file software.h
+ */
+#ifndef TUIC_SOFTWARE_H //header guard
+#define TUIC_SOFTWARE_H
+#ifdef __cplusplus //extern C guard
+extern "C" {
+#endif
+#include <TUIC/types.h>
+TuiResult tuiSystemCreate_Software();
+void tuiSystemDestroy_Software();
+TuiResult tuiAtlasCreate_Software(TuiAtlas atlas, const uint8_t* pixel_data, const float* stpqp_coordinates);
+void tuiAtlasDestroy_Software(TuiAtlas atlas);
+TuiResult tuiAtlasCreateGlyphCache_Software(TuiAtlas atlas, const float* stpqp_coordinates);
+TuiResult tuiAtlasUpdateGlyph_Software(TuiAtlas atlas, int glyph_index, int page, int x, int y, int cell_width, int cell_height, const uint8_t* pixels, const float* stpqp_coordinates);
+TuiResult tuiTextureCreate_Software(TuiTexture texture, const uint8_t* pixels);
+void tuiTextureDestroy_Software(TuiTexture texture);
+TuiResult tuiTextureUpdateRegion_Software(TuiTexture texture, const uint8_t* pixels, int x, int y, int width, int height, size_t row_pitch);
+TuiResult tuiPanelCreate_Software(TuiPanel panel);
+void tuiPanelDestroy_Software(TuiPanel panel);
+TuiResult tuiPanelGetPixels_Software(TuiPanel panel, uint8_t** pixels, int* pixel_width, int* pixel_height);
+TuiResult tuiPanelClearColor_Software(TuiPanel panel, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+TuiResult tuiPanelSetPixelDimensions_Software(TuiPanel panel, int pixel_width, int pixel_height);
+TuiResult tuiPanelDrawConsole_Software(TuiPanel panel, TuiAtlas atlas, TuiConsole console, int left_x, int right_x, int top_y, int bottom_y);
+TuiResult tuiPanelDrawPanel_Software(TuiPanel panel, TuiPanel subject_panel, int left_x, int right_x, int top_y, int bottom_y);
+TuiResult tuiPanelDrawTexture_Software(TuiPanel panel, TuiTexture texture, int left_x, int right_x, int top_y, int bottom_y);
+TuiResult tuiPanelDrawCommands_Software(TuiPanel panel, const struct TuiDrawCommand* commands, int command_count);
+TuiResult tuiPixelReadbackCreate_Software(TuiPixelReadback pixel_readback);
+void tuiPixelReadbackDestroy_Software(TuiPixelReadback pixel_readback);
+TuiResult tuiPixelReadbackCapturePanel_Software(TuiPixelReadback pixel_readback, TuiPanel panel);
+const uint8_t* tuiPixelReadbackMap_Software(TuiPixelReadback pixel_readback);
+#ifdef __cplusplus //extern C guard
+}
+#endif
+#endif //header guard
\ No newline at end of file
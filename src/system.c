@@ -24,14 +24,26 @@
 #include "glfw_error_check.h"
 #include "objects.h"
 #include "opengl33.h"
+#include "software.h"
+
+#include <string.h>
 
 static TuiSystem sSystem;
 
+static TuiGraphicsBackend sGraphicsBackend = TUI_GRAPHICS_BACKEND_OPENGL33;
+
+static TuiBoolean sHeadless = TUI_FALSE;
+
 TuiSystem tui_get_system()
 {
 	return sSystem;
 }
 
+TuiBoolean tui_is_software_backend()
+{
+	return sSystem != TUI_NULL && sSystem->GraphicsBackend == TUI_GRAPHICS_BACKEND_SOFTWARE;
+}
+
 TuiBoolean tuiInit()
 {
 	if (sSystem != TUI_NULL)
@@ -40,6 +52,26 @@ TuiBoolean tuiInit()
 		return TUI_FALSE;
 	}
 
+	if (sGraphicsBackend == TUI_GRAPHICS_BACKEND_SOFTWARE)
+	{
+		// The software backend renders into memory only, so it needs neither GLFW nor a graphics context.
+		sSystem = tuiAllocate(sizeof(TuiSystem_s));
+		memset(sSystem, 0, sizeof(TuiSystem_s));
+		sSystem->GraphicsBackend = TUI_GRAPHICS_BACKEND_SOFTWARE;
+		TuiResult result = tuiSystemCreate_Software();
+		if (result != TUI_RESULT_OK)
+		{
+			tuiFree(sSystem);
+			sSystem = TUI_NULL;
+			return TUI_FALSE;
+		}
+		return TUI_TRUE;
+	}
+
+#ifdef GLFW_PLATFORM_NULL
+	// The null platform of GLFW 3.4 talks to no X11 or Wayland server, so it starts in containers without a display.
+	glfwInitHint(GLFW_PLATFORM, sHeadless ? GLFW_PLATFORM_NULL : GLFW_ANY_PLATFORM);
+#endif
 	int initialized = glfwInit();
 
 	if (initialized != GLFW_TRUE)
@@ -51,6 +83,8 @@ TuiBoolean tuiInit()
 	sSystem->BaseWindow = TUI_NULL;
 	sSystem->WindowIconsSupported = TUI_FALSE;
 	sSystem->MonitorConnectedCallback = TUI_NULL;
+	sSystem->GraphicsBackend = TUI_GRAPHICS_BACKEND_OPENGL33;
+	sSystem->Headless = sHeadless;
 	sSystem->ApiData = TUI_NULL;
 
 	int glfw_version_major = 0;
@@ -72,7 +106,23 @@ TuiBoolean tuiInit()
 #endif
 	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
 	glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_TRUE);
-	sSystem->BaseWindow = glfwCreateWindow(1, 1, "", TUI_NULL, TUI_NULL);
+	glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, (tuiGetGraphicsValidation() != TUI_GRAPHICS_VALIDATION_OFF) ? GLFW_TRUE : GLFW_FALSE);
+	if (sHeadless)
+	{
+		// EGL is tried first, since Mesa serves it surfaceless on llvmpipe, then OSMesa for systems without an EGL driver.
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+		sSystem->BaseWindow = glfwCreateWindow(1, 1, "", TUI_NULL, TUI_NULL);
+		if (sSystem->BaseWindow == TUI_NULL)
+		{
+			_GlfwClearErrors();
+			glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+			sSystem->BaseWindow = glfwCreateWindow(1, 1, "", TUI_NULL, TUI_NULL);
+		}
+	}
+	else
+	{
+		sSystem->BaseWindow = glfwCreateWindow(1, 1, "", TUI_NULL, TUI_NULL);
+	}
 	TuiErrorCode glfw_error = _GlfwErrorCheck();
 	if (glfw_error != TUI_ERROR_NONE)
 	{
@@ -160,6 +210,13 @@ void tuiTerminate()
 		return;
 	}
 
+	if (sSystem->GraphicsBackend == TUI_GRAPHICS_BACKEND_SOFTWARE)
+	{
+		tuiSystemDestroy_Software();
+		tuiFree(sSystem);
+		sSystem = TUI_NULL;
+		return;
+	}
 	TuiErrorCode error_code = tuiSystemDestroy_Opengl33();
 	if (error_code != TUI_ERROR_NONE)
 	{
@@ -242,4 +299,91 @@ void tuiSetClipboardString(const char* string)
 		tuiDebugError(glfw_error, __func__);
 		return;
 	}
+}
+
+void tuiGetGraphicsStateStatistics(size_t* issued_call_count, size_t* skipped_call_count)
+{
+	size_t issued = 0;
+	size_t skipped = 0;
+	if (!tui_is_software_backend())
+	{
+		tuiSystemGetStateStatistics_Opengl33(&issued, &skipped);
+	}
+	if (issued_call_count != TUI_NULL)
+	{
+		*issued_call_count = issued;
+	}
+	if (skipped_call_count != TUI_NULL)
+	{
+		*skipped_call_count = skipped;
+	}
+}
+
+void tuiResetGraphicsStateStatistics()
+{
+	tuiSystemResetStateStatistics_Opengl33();
+}
+
+TuiResult tuiSetGraphicsValidation(TuiGraphicsValidation validation)
+{
+	if (validation < TUI_GRAPHICS_VALIDATION_FIRST || validation > TUI_GRAPHICS_VALIDATION_LAST)
+	{
+		return TUI_RESULT_ERROR_INVALID_ENUM;
+	}
+	if (tui_is_software_backend())
+	{
+		// The software backend makes no graphics calls to validate.
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
+	return tuiSystemSetValidation_Opengl33(validation);
+}
+
+TuiGraphicsValidation tuiGetGraphicsValidation()
+{
+	return tuiSystemGetValidation_Opengl33();
+}
+
+void tuiSetGraphicsDebugMessageCallback(tuiGraphicsDebugMessageFunction callback)
+{
+	tuiSystemSetDebugMessageCallback_Opengl33(callback);
+}
+
+TuiResult tuiSetGraphicsBackend(TuiGraphicsBackend backend)
+{
+	if (backend < TUI_GRAPHICS_BACKEND_FIRST || backend > TUI_GRAPHICS_BACKEND_LAST)
+	{
+		return TUI_RESULT_ERROR_INVALID_ENUM;
+	}
+	if (sSystem != TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
+	sGraphicsBackend = backend;
+	return TUI_RESULT_OK;
+}
+
+TuiGraphicsBackend tuiGetGraphicsBackend()
+{
+	return sGraphicsBackend;
+}
+
+TuiResult tuiSetHeadless(TuiBoolean headless)
+{
+	if (sSystem != TUI_NULL)
+	{
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
+#ifndef GLFW_PLATFORM_NULL
+	if (headless != TUI_FALSE)
+	{
+		return TUI_RESULT_ERROR_UNSUPPORTED_OPERATION;
+	}
+#endif
+	sHeadless = (headless != TUI_FALSE) ? TUI_TRUE : TUI_FALSE;
+	return TUI_RESULT_OK;
+}
+
+TuiBoolean tuiIsHeadless()
+{
+	return sHeadless;
 }
\ No newline at end of file
@@ -0,0 +1,154 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/text_run_cache.h>
+#include <TUIC/atlas.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+
+#include <assert.h>
+#include <string.h>
+
+
+#define TUI_TEXT_RUN_CACHE_MAX_CAPACITY 16777216
+
+// Hash the glyphs of a run with 64 bit FNV-1a, so distinct runs practically never share a hash.
+static inline uint64_t _tuiTextRunHash(const uint16_t* glyphs, const int glyph_count)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (int glyph_i = 0; glyph_i < glyph_count; glyph_i++)
+	{
+		hash = (hash ^ (glyphs[glyph_i] & 0xFF)) * 1099511628211ull;
+		hash = (hash ^ (glyphs[glyph_i] >> 8)) * 1099511628211ull;
+	}
+	return hash;
+}
+
+TuiResult tuiTextRunCacheCreate(TuiTextRunCache* text_run_cache, int capacity)
+{
+	assert(text_run_cache != NULL);
+	if (capacity < 1 || capacity > TUI_TEXT_RUN_CACHE_MAX_CAPACITY)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	int entry_count = 1;
+	while (entry_count < capacity)
+	{
+		entry_count *= 2;
+	}
+	*text_run_cache = (TuiTextRunCache)tuiAllocate(sizeof(TuiTextRunCache_s));
+	if (*text_run_cache == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset(*text_run_cache, 0, sizeof(TuiTextRunCache_s));
+	(*text_run_cache)->Entries = (TuiTextRunCacheEntry*)tuiAllocate((size_t)entry_count * sizeof(TuiTextRunCacheEntry));
+	if ((*text_run_cache)->Entries == NULL)
+	{
+		tuiFree(*text_run_cache);
+		*text_run_cache = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	memset((*text_run_cache)->Entries, 0, (size_t)entry_count * sizeof(TuiTextRunCacheEntry));
+	(*text_run_cache)->EntryMask = entry_count - 1;
+	tuiTextRunCacheClear(*text_run_cache);
+	return TUI_RESULT_OK;
+}
+
+void tuiTextRunCacheDestroy(TuiTextRunCache text_run_cache)
+{
+	assert(text_run_cache != NULL);
+	for (int entry_i = 0; entry_i <= text_run_cache->EntryMask; entry_i++)
+	{
+		tuiFree(text_run_cache->Entries[entry_i].Glyphs);
+	}
+	tuiFree(text_run_cache->Entries);
+	tuiFree(text_run_cache);
+}
+
+int tuiTextRunCacheMeasure(TuiTextRunCache text_run_cache, TuiAtlas atlas, const uint16_t* glyphs, int glyph_count)
+{
+	assert(text_run_cache != NULL);
+	assert(atlas != NULL);
+	assert(glyphs != NULL || glyph_count == 0);
+	const uint64_t hash = _tuiTextRunHash(glyphs, glyph_count);
+	// The atlas address is mixed into the entry index, so the same text measured with two atlases does not keep evicting itself.
+	const uint64_t atlas_hash = (uint64_t)(uintptr_t)atlas * 0x9E3779B97F4A7C15ull;
+	TuiTextRunCacheEntry* entry = &text_run_cache->Entries[(size_t)((hash ^ (atlas_hash >> 17)) & (uint64_t)text_run_cache->EntryMask)];
+	// The stored glyphs are compared as well, so two runs that share a hash can never return each other's width.
+	if (entry->Atlas == atlas && entry->Hash == hash && entry->GlyphCount == glyph_count && entry->MetricsVersion == atlas->MetricsVersion && (glyph_count == 0 || memcmp(entry->Glyphs, glyphs, (size_t)glyph_count * sizeof(uint16_t)) == 0))
+	{
+		text_run_cache->HitCount++;
+		return entry->Width;
+	}
+	text_run_cache->MissCount++;
+	const int width = tuiAtlasMeasureGlyphs(atlas, glyphs, glyph_count);
+	if (glyph_count > entry->GlyphCapacity)
+	{
+		uint16_t* entry_glyphs = (uint16_t*)tuiReallocate(entry->Glyphs, (size_t)glyph_count * sizeof(uint16_t));
+		if (entry_glyphs == NULL)
+		{
+			// The width is still correct; it is just not cached.
+			entry->Atlas = NULL;
+			return width;
+		}
+		entry->Glyphs = entry_glyphs;
+		entry->GlyphCapacity = glyph_count;
+	}
+	if (glyph_count > 0)
+	{
+		memcpy(entry->Glyphs, glyphs, (size_t)glyph_count * sizeof(uint16_t));
+	}
+	entry->Atlas = atlas;
+	entry->Hash = hash;
+	entry->GlyphCount = glyph_count;
+	entry->MetricsVersion = atlas->MetricsVersion;
+	entry->Width = width;
+	return width;
+}
+
+void tuiTextRunCacheClear(TuiTextRunCache text_run_cache)
+{
+	assert(text_run_cache != NULL);
+	// The glyph buffers of the entries are kept for reuse.
+	for (int entry_i = 0; entry_i <= text_run_cache->EntryMask; entry_i++)
+	{
+		TuiTextRunCacheEntry* entry = &text_run_cache->Entries[entry_i];
+		entry->Hash = 0;
+		entry->Atlas = NULL;
+		entry->MetricsVersion = 0;
+		entry->GlyphCount = 0;
+		entry->Width = 0;
+	}
+	text_run_cache->HitCount = 0;
+	text_run_cache->MissCount = 0;
+}
+
+void tuiTextRunCacheGetStatistics(TuiTextRunCache text_run_cache, size_t* hit_count, size_t* miss_count)
+{
+	assert(text_run_cache != NULL);
+	if (hit_count != NULL)
+	{
+		*hit_count = text_run_cache->HitCount;
+	}
+	if (miss_count != NULL)
+	{
+		*miss_count = text_run_cache->MissCount;
+	}
+}
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include <TUIC/tuic.h>
 #include "objects.h"
 #include "opengl33.h"
+#include "software.h"
 
 #include <string.h>
 #include <assert.h>
@@ -43,7 +44,7 @@ TuiResult tuiTextureCreate(TuiTexture* texture, uint8_t* pixel_data, int pixel_w
 	memset(*texture, 0, sizeof(TuiTexture_s));
 	(*texture)->PixelWidth = pixel_width;
 	(*texture)->PixelHeight = pixel_height;
-	TuiResult result = tuiTextureCreate_Opengl33((*texture), pixel_data, pixel_width, pixel_height);
+	TuiResult result = tui_is_software_backend() ? tuiTextureCreate_Software(*texture, pixel_data) : tuiTextureCreate_Opengl33((*texture), pixel_data, pixel_width, pixel_height);
 	if (result != TUI_RESULT_OK)
 	{
 		tuiFree(*texture);
@@ -57,11 +58,42 @@ TuiResult tuiTextureCreate(TuiTexture* texture, uint8_t* pixel_data, int pixel_w
 void tuiTextureDestroy(TuiTexture texture)
 {
 	assert(texture != NULL);
-	tuiTextureDestroy_Opengl33(texture);
+	if (tui_is_software_backend())
+	{
+		tuiTextureDestroy_Software(texture);
+	}
+	else
+	{
+		tuiTextureDestroy_Opengl33(texture);
+	}
 	tuiFree(texture);
 	sTextureCount--;
 }
 
+TuiResult tuiTextureUpdateRegion(TuiTexture texture, const uint8_t* pixels, int x, int y, int width, int height, size_t row_pitch)
+{
+	assert(texture != NULL);
+	assert(pixels != NULL);
+	if (x < 0 || y < 0 || width <= 0 || height <= 0 || (size_t)x + (size_t)width > texture->PixelWidth || (size_t)y + (size_t)height > texture->PixelHeight)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	// A row pitch of 0 means the rows are tightly packed. Other pitches are in bytes and must hold whole pixels.
+	if (row_pitch == 0)
+	{
+		row_pitch = (size_t)width * 4;
+	}
+	if (row_pitch < (size_t)width * 4 || row_pitch % 4 != 0)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	if (tui_is_software_backend())
+	{
+		return tuiTextureUpdateRegion_Software(texture, pixels, x, y, width, height, row_pitch);
+	}
+	return tuiTextureUpdateRegion_Opengl33(texture, pixels, x, y, width, height, row_pitch);
+}
+
 void tuiTextureGetPixelDimensions(TuiTexture texture, int* pixel_width, int* pixel_height)
 {
 	assert(texture != NULL);
@@ -0,0 +1,188 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <TUIC/true_type_font.h>
+#include <TUIC/allocation.h>
+#include "objects.h"
+#include "math_inline.h"
+
+#include <stb_truetype.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+
+// The distance in pixels from the glyph edge at which distance field values stop changing, until it is set.
+#define TUI_TRUE_TYPE_FONT_DEFAULT_DISTANCE_FIELD_SPREAD 4.0f
+
+// Write a glyph pixel with the given coverage or distance value in the layout of the channel count: white with the value as alpha when there is an alpha channel.
+static inline void _tuiTrueTypeFontWritePixel(uint8_t* pixel, const int channel_count, const uint8_t value)
+{
+	switch (channel_count)
+	{
+	case 1:
+		pixel[0] = value;
+		break;
+	case 2:
+		pixel[0] = value;
+		pixel[1] = 255;
+		break;
+	case 3:
+		pixel[0] = value;
+		pixel[1] = value;
+		pixel[2] = value;
+		break;
+	default:
+		pixel[0] = 255;
+		pixel[1] = 255;
+		pixel[2] = 255;
+		pixel[3] = value;
+		break;
+	}
+}
+
+TuiResult tuiTrueTypeFontCreate(TuiTrueTypeFont* font, const uint8_t* font_data, float pixel_height)
+{
+	assert(font != NULL);
+	if (font_data == NULL || pixel_height <= 0.0f)
+	{
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	*font = (TuiTrueTypeFont)tuiAllocate(sizeof(TuiTrueTypeFont_s));
+	if (*font == NULL)
+	{
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	stbtt_fontinfo* font_info = (stbtt_fontinfo*)tuiAllocate(sizeof(stbtt_fontinfo));
+	if (font_info == NULL)
+	{
+		tuiFree(*font);
+		*font = NULL;
+		return TUI_RESULT_ERROR_OUT_OF_MEMORY;
+	}
+	if (!stbtt_InitFont(font_info, font_data, stbtt_GetFontOffsetForIndex(font_data, 0)))
+	{
+		tuiFree(font_info);
+		tuiFree(*font);
+		*font = NULL;
+		return TUI_RESULT_ERROR_INVALID_VALUE;
+	}
+	int ascent = 0;
+	stbtt_GetFontVMetrics(font_info, &ascent, NULL, NULL);
+	(*font)->FontInfo = font_info;
+	(*font)->Scale = stbtt_ScaleForPixelHeight(font_info, pixel_height);
+	(*font)->Ascent = (int)((float)ascent * (*font)->Scale + 0.5f);
+	(*font)->DistanceFieldSpread = TUI_TRUE_TYPE_FONT_DEFAULT_DISTANCE_FIELD_SPREAD;
+	return TUI_RESULT_OK;
+}
+
+void tuiTrueTypeFontDestroy(TuiTrueTypeFont font)
+{
+	assert(font != NULL);
+	tuiFree(font->FontInfo);
+	tuiFree(font);
+}
+
+TuiBoolean tuiTrueTypeFontRasterizeGlyph(void* font, uint32_t codepoint, int max_width, int max_height, int channel_count, uint8_t* pixels, int* width, int* height)
+{
+	assert(font != NULL);
+	assert(pixels != NULL && width != NULL && height != NULL);
+	assert(channel_count >= 1 && channel_count <= 4);
+	TuiTrueTypeFont true_type_font = (TuiTrueTypeFont)font;
+	const stbtt_fontinfo* font_info = (const stbtt_fontinfo*)true_type_font->FontInfo;
+	const int glyph_index = stbtt_FindGlyphIndex(font_info, (int)codepoint);
+	if (glyph_index == 0)
+	{
+		return TUI_FALSE;
+	}
+	int advance = 0;
+	stbtt_GetGlyphHMetrics(font_info, glyph_index, &advance, NULL);
+	int x0, y0, x1, y1;
+	stbtt_GetGlyphBitmapBox(font_info, glyph_index, true_type_font->Scale, true_type_font->Scale, &x0, &y0, &x1, &y1);
+
+	// Render the coverage into the front of the pixels, then clip the glyph box to the cell around the baseline.
+	const int left = MAX(x0, 0);
+	const int top = MAX(true_type_font->Ascent + y0, 0);
+	const int right = MIN(x1, max_width);
+	const int bottom = MIN(true_type_font->Ascent + y1, max_height);
+	if (right > left && bottom > top && channel_count == 1)
+	{
+		// Coverage is already the pixel format, so it is rendered straight into place.
+		stbtt_MakeGlyphBitmap(font_info, &pixels[(size_t)top * max_width + left], right - left, bottom - top, max_width, true_type_font->Scale, true_type_font->Scale, glyph_index);
+	}
+	else if (right > left && bottom > top)
+	{
+		stbtt_MakeGlyphBitmap(font_info, pixels, right - left, bottom - top, max_width, true_type_font->Scale, true_type_font->Scale, glyph_index);
+		// Expand the coverage from the last pixel back, so no coverage is overwritten before it is read.
+		for (int y = bottom - top - 1; y >= 0; y--)
+		{
+			for (int x = right - left - 1; x >= 0; x--)
+			{
+				const uint8_t coverage = pixels[y * max_width + x];
+				pixels[y * max_width + x] = 0;
+				_tuiTrueTypeFontWritePixel(&pixels[((size_t)(top + y) * max_width + left + x) * channel_count], channel_count, coverage);
+			}
+		}
+	}
+	*width = MAX(MIN((int)((float)advance * true_type_font->Scale + 0.5f), max_width), 1);
+	*height = max_height;
+	return TUI_TRUE;
+}
+
+TuiBoolean tuiTrueTypeFontRasterizeGlyphDistanceField(void* font, uint32_t codepoint, int max_width, int max_height, int channel_count, uint8_t* pixels, int* width, int* height)
+{
+	assert(font != NULL);
+	assert(pixels != NULL && width != NULL && height != NULL);
+	assert(channel_count >= 1 && channel_count <= 4);
+	TuiTrueTypeFont true_type_font = (TuiTrueTypeFont)font;
+	const stbtt_fontinfo* font_info = (const stbtt_fontinfo*)true_type_font->FontInfo;
+	const int glyph_index = stbtt_FindGlyphIndex(font_info, (int)codepoint);
+	if (glyph_index == 0)
+	{
+		return TUI_FALSE;
+	}
+	int advance = 0;
+	stbtt_GetGlyphHMetrics(font_info, glyph_index, &advance, NULL);
+
+	// The field is padded by the spread around the glyph box, so distances fade out before the edge of the field. Glyphs with no outline, like spaces, have no field and stay fully outside.
+	const float spread = true_type_font->DistanceFieldSpread;
+	int field_width = 0, field_height = 0, x_offset = 0, y_offset = 0;
+	uint8_t* field = stbtt_GetGlyphSDF(font_info, true_type_font->Scale, glyph_index, (int)ceilf(spread), 128, 127.0f / spread, &field_width, &field_height, &x_offset, &y_offset);
+	if (field != NULL)
+	{
+		const int top = true_type_font->Ascent + y_offset;
+		for (int y = MAX(-top, 0); y < field_height && top + y < max_height; y++)
+		{
+			for (int x = MAX(-x_offset, 0); x < field_width && x_offset + x < max_width; x++)
+			{
+				_tuiTrueTypeFontWritePixel(&pixels[((size_t)(top + y) * max_width + x_offset + x) * channel_count], channel_count, field[y * field_width + x]);
+			}
+		}
+		stbtt_FreeSDF(field, NULL);
+	}
+	*width = MAX(MIN((int)((float)advance * true_type_font->Scale + 0.5f), max_width), 1);
+	*height = max_height;
+	return TUI_TRUE;
+}
+
+void tuiTrueTypeFontSetDistanceFieldSpread(TuiTrueTypeFont font, float spread)
+{
+	assert(font != NULL);
+	assert(spread > 0.0f);
+	font->DistanceFieldSpread = spread;
+}
\ No newline at end of file
@@ -191,6 +191,18 @@ TuiWindow tuiWindowCreate(int viewport_pixel_width, int viewport_pixel_height, c
 		tuiDebugError(TUI_ERROR_NOT_INITIALIZED, __func__);
 		return TUI_NULL;
 	}
+	if (system->GraphicsBackend == TUI_GRAPHICS_BACKEND_SOFTWARE)
+	{
+		// GLFW is never initialized with the software backend.
+		tuiDebugError(TUI_ERROR_GLFW_NOT_INITIALIZED, __func__);
+		return TUI_NULL;
+	}
+	if (system->Headless)
+	{
+		// The null platform has no display to show a window on.
+		tuiDebugError(TUI_ERROR_GLFW_PLATFORM_ERROR, __func__);
+		return TUI_NULL;
+	}
 	if (viewport_pixel_width <= 0 || viewport_pixel_height <= 0)
 	{
 		tuiDebugError(TUI_ERROR_INVALID_WINDOW_VIEWPORT_DIMENSIONS, __func__);
@@ -222,6 +234,7 @@ TuiWindow tuiWindowCreate(int viewport_pixel_width, int viewport_pixel_height, c
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 	glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_TRUE);
+	glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, (tuiGetGraphicsValidation() != TUI_GRAPHICS_VALIDATION_OFF) ? GLFW_TRUE : GLFW_FALSE);
 #ifdef __APPLE__
 	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
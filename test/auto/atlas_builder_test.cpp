@@ -0,0 +1,170 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+
+
+static std::vector<uint8_t> makeGlyphPixels(const int width, const int height, const int glyph_i)
+{
+	std::vector<uint8_t> pixels(width * height * 4);
+	for (size_t i = 0; i < pixels.size(); i++)
+	{
+		pixels[i] = (uint8_t)(1 + (glyph_i * 31 + i) % 255);
+	}
+	return pixels;
+}
+
+TEST_CASE("tuiAtlasBuilderCreate")
+{
+	TuiAtlasBuilder atlas_builder = TUI_NULL;
+	REQUIRE(tuiAtlasBuilderCreate(&atlas_builder, 0, 64, 4, 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasBuilderCreate(&atlas_builder, 64, 64, 5, 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasBuilderCreate(&atlas_builder, 64, 64, 4, -1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasBuilderCreate(&atlas_builder, 64, 32, 4, 1) == TUI_RESULT_OK);
+	int width, height, pages;
+	tuiAtlasBuilderGetDimensions(atlas_builder, &width, &height, &pages);
+	REQUIRE(width == 64);
+	REQUIRE(height == 32);
+	REQUIRE(pages == 0);
+	REQUIRE(tuiAtlasBuilderPack(atlas_builder, 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasBuilderGetPixelData(atlas_builder) == TUI_NULL);
+	REQUIRE(tuiAtlasBuilderGetStpqpCoordinates(atlas_builder) == TUI_NULL);
+
+	const std::vector<uint8_t> pixels = makeGlyphPixels(63, 8, 0);
+	REQUIRE(tuiAtlasBuilderAddGlyph(atlas_builder, 63, 8, pixels.data()) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasBuilderAddGlyph(atlas_builder, 0, 8, pixels.data()) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasBuilderAddGlyph(atlas_builder, 62, 8, pixels.data()) == TUI_RESULT_OK);
+	REQUIRE(tuiAtlasBuilderGetGlyphCount(atlas_builder) == 1);
+	tuiAtlasBuilderDestroy(atlas_builder);
+}
+
+TEST_CASE("tuiAtlasBuilderPack")
+{
+	const int page_width = 128;
+	const int page_height = 96;
+	const int padding = 1;
+	const int glyph_count = 300;
+	TuiAtlasBuilder atlas_builder = TUI_NULL;
+	REQUIRE(tuiAtlasBuilderCreate(&atlas_builder, page_width, page_height, 4, padding) == TUI_RESULT_OK);
+	std::vector<int> widths(glyph_count);
+	std::vector<int> heights(glyph_count);
+	for (int glyph_i = 0; glyph_i < glyph_count; glyph_i++)
+	{
+		widths[glyph_i] = 3 + (glyph_i * 7) % 19;
+		heights[glyph_i] = 4 + (glyph_i * 11) % 23;
+		const std::vector<uint8_t> pixels = makeGlyphPixels(widths[glyph_i], heights[glyph_i], glyph_i);
+		REQUIRE(tuiAtlasBuilderAddGlyph(atlas_builder, widths[glyph_i], heights[glyph_i], pixels.data()) == TUI_RESULT_OK);
+	}
+	REQUIRE(tuiAtlasBuilderPack(atlas_builder, 1) == TUI_RESULT_OK);
+	int pages = 0;
+	tuiAtlasBuilderGetDimensions(atlas_builder, TUI_NULL, TUI_NULL, &pages);
+	REQUIRE(pages > 0);
+	const size_t page_size = (size_t)page_width * page_height * 4;
+	const std::vector<uint8_t> pixel_data(tuiAtlasBuilderGetPixelData(atlas_builder), tuiAtlasBuilderGetPixelData(atlas_builder) + page_size * pages);
+	const std::vector<float> coordinates(tuiAtlasBuilderGetStpqpCoordinates(atlas_builder), tuiAtlasBuilderGetStpqpCoordinates(atlas_builder) + glyph_count * TUI_STPQP_COORDINATES_PER_GLYPH);
+
+	SECTION("glyphs are copied onto non overlapping padded rectangles")
+	{
+		std::vector<int> owners(page_size / 4 * pages, -1);
+		size_t glyph_area = 0;
+		for (int glyph_i = 0; glyph_i < glyph_count; glyph_i++)
+		{
+			const float* glyph_coordinates = &coordinates[glyph_i * TUI_STPQP_COORDINATES_PER_GLYPH];
+			const int x = (int)(glyph_coordinates[0] * page_width + 0.5f);
+			const int y = (int)(glyph_coordinates[1] * page_height + 0.5f);
+			const int page = (int)glyph_coordinates[4];
+			REQUIRE((int)(glyph_coordinates[2] * page_width + 0.5f) == x + widths[glyph_i]);
+			REQUIRE((int)(glyph_coordinates[3] * page_height + 0.5f) == y + heights[glyph_i]);
+			REQUIRE(page >= 0);
+			REQUIRE(page < pages);
+			REQUIRE(x >= padding);
+			REQUIRE(y >= padding);
+			REQUIRE(x + widths[glyph_i] + padding <= page_width);
+			REQUIRE(y + heights[glyph_i] + padding <= page_height);
+			for (int padded_y = y - padding; padded_y < y + heights[glyph_i] + padding; padded_y++)
+			{
+				for (int padded_x = x - padding; padded_x < x + widths[glyph_i] + padding; padded_x++)
+				{
+					int& owner = owners[(size_t)page * page_width * page_height + (size_t)padded_y * page_width + padded_x];
+					REQUIRE(owner == -1);
+					owner = glyph_i;
+				}
+			}
+			const std::vector<uint8_t> pixels = makeGlyphPixels(widths[glyph_i], heights[glyph_i], glyph_i);
+			for (int glyph_y = 0; glyph_y < heights[glyph_i]; glyph_y++)
+			{
+				const uint8_t* row = &pixel_data[page_size * page + ((size_t)(y + glyph_y) * page_width + x) * 4];
+				REQUIRE(std::equal(row, row + widths[glyph_i] * 4, &pixels[glyph_y * widths[glyph_i] * 4]));
+			}
+			glyph_area += (size_t)(widths[glyph_i] + padding * 2) * (heights[glyph_i] + padding * 2);
+		}
+		REQUIRE(pages <= (int)(glyph_area * 3 / 2 / (page_width * page_height)) + 1);
+	}
+	SECTION("packing does not depend on the thread count")
+	{
+		for (const int thread_count : { 2, 4, 0 })
+		{
+			REQUIRE(tuiAtlasBuilderPack(atlas_builder, thread_count) == TUI_RESULT_OK);
+			int thread_pages = 0;
+			tuiAtlasBuilderGetDimensions(atlas_builder, TUI_NULL, TUI_NULL, &thread_pages);
+			REQUIRE(thread_pages == pages);
+			REQUIRE(std::equal(pixel_data.begin(), pixel_data.end(), tuiAtlasBuilderGetPixelData(atlas_builder)));
+			REQUIRE(std::equal(coordinates.begin(), coordinates.end(), tuiAtlasBuilderGetStpqpCoordinates(atlas_builder)));
+		}
+	}
+	SECTION("adding a glyph discards the packed pages")
+	{
+		const std::vector<uint8_t> pixels = makeGlyphPixels(4, 4, glyph_count);
+		REQUIRE(tuiAtlasBuilderAddGlyph(atlas_builder, 4, 4, pixels.data()) == TUI_RESULT_OK);
+		tuiAtlasBuilderGetDimensions(atlas_builder, TUI_NULL, TUI_NULL, &pages);
+		REQUIRE(pages == 0);
+		REQUIRE(tuiAtlasBuilderGetPixelData(atlas_builder) == TUI_NULL);
+	}
+	tuiAtlasBuilderDestroy(atlas_builder);
+}
+
+TEST_CASE("tuiAtlasBuilderCreateAtlas")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	TuiAtlasBuilder atlas_builder = TUI_NULL;
+	REQUIRE(tuiAtlasBuilderCreate(&atlas_builder, 16, 16, 1, 1) == TUI_RESULT_OK);
+	TuiAtlas atlas = TUI_NULL;
+	REQUIRE(tuiAtlasBuilderCreateAtlas(atlas_builder, &atlas) == TUI_RESULT_ERROR_INVALID_VALUE);
+	const std::vector<uint8_t> glyph_pixels(4 * 4, 255);
+	REQUIRE(tuiAtlasBuilderAddGlyph(atlas_builder, 4, 4, glyph_pixels.data()) == TUI_RESULT_OK);
+	REQUIRE(tuiAtlasBuilderPack(atlas_builder, 1) == TUI_RESULT_OK);
+	REQUIRE(tuiAtlasBuilderCreateAtlas(atlas_builder, &atlas) == TUI_RESULT_OK);
+	int width = 0;
+	int height = 0;
+	int pages = 0;
+	tuiAtlasGetDimensions(atlas, &width, &height, &pages);
+	REQUIRE(width == 16);
+	REQUIRE(height == 16);
+	REQUIRE(pages == 1);
+	REQUIRE(tuiAtlasGetGlyphCount(atlas) == 1);
+
+	// The single coverage channel of the glyph shows the foreground over the whole tile.
+	TuiPanel panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&panel, 4, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelClearColor(panel, 0, 0, 0, 255) == TUI_RESULT_OK);
+	TuiConsole console = TUI_NULL;
+	REQUIRE(tuiConsoleCreatePixelDimensions(&console, 4, 4, 1.0f, 4, 4, TUI_TRUE) == TUI_RESULT_OK);
+	REQUIRE(tuiConsolePushTileGrid(console, 0, 0, 0, 0, 255, 0, 255, 0, 0, 255, 255) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelDrawConsole(panel, atlas, console) == TUI_RESULT_OK);
+	uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	REQUIRE(tuiPanelGetPixels(panel, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	REQUIRE(pixels[(2 * 4 + 2) * 4 + 0] == 0);
+	REQUIRE(pixels[(2 * 4 + 2) * 4 + 1] == 255);
+	REQUIRE(pixels[(2 * 4 + 2) * 4 + 2] == 0);
+
+	tuiFree(pixels);
+	tuiConsoleDestroy(console);
+	tuiPanelDestroy(panel);
+	tuiAtlasDestroy(atlas);
+	tuiAtlasBuilderDestroy(atlas_builder);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <TUIC/tuic.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <catch2/catch.hpp>
+
+
+static const char* kAtlasCachePath = "atlas_cache_test.tuicatlas";
+
+typedef struct TestAtlasSource
+{
+	int BuildCount;
+	std::vector<uint8_t> Pixels;
+	std::vector<float> Coordinates;
+} TestAtlasSource;
+
+static TestAtlasSource makeTestAtlasSource()
+{
+	TestAtlasSource source;
+	source.BuildCount = 0;
+	source.Pixels.resize(24 * 16 * 2 * 3);
+	for (size_t i = 0; i < source.Pixels.size(); i++)
+	{
+		source.Pixels[i] = (uint8_t)(i * 7 + 3);
+	}
+	for (int glyph_i = 0; glyph_i < 6; glyph_i++)
+	{
+		const float glyph_coordinates[TUI_STPQP_COORDINATES_PER_GLYPH] = { glyph_i / 8.0f, 0.0f, (glyph_i + 1) / 8.0f, 0.5f, (float)(glyph_i % 2) };
+		source.Coordinates.insert(source.Coordinates.end(), glyph_coordinates, glyph_coordinates + TUI_STPQP_COORDINATES_PER_GLYPH);
+	}
+	return source;
+}
+
+static TuiResult buildTestAtlasCache(void* user_data, const char* path, uint64_t source_hash)
+{
+	TestAtlasSource* source = (TestAtlasSource*)user_data;
+	source->BuildCount++;
+	return tuiAtlasCacheWrite(path, source_hash, 24, 16, 2, 3, source->Pixels.data(), source->Coordinates.data(), 6);
+}
+
+TEST_CASE("tuiAtlasCacheHash")
+{
+	const char* text = "the quick brown fox jumps over the lazy dog";
+	const size_t size = strlen(text);
+	REQUIRE(tuiAtlasCacheHash(text, size, 0) == tuiAtlasCacheHash(text, size, 0));
+	REQUIRE(tuiAtlasCacheHash(text, size, 0) != tuiAtlasCacheHash(text, size, 1));
+	REQUIRE(tuiAtlasCacheHash(text, size, 0) != tuiAtlasCacheHash(text, size - 1, 0));
+	std::vector<char> changed(text, text + size);
+	for (size_t i = 0; i < size; i++)
+	{
+		changed[i] ^= 1;
+		REQUIRE(tuiAtlasCacheHash(changed.data(), size, 0) != tuiAtlasCacheHash(text, size, 0));
+		changed[i] ^= 1;
+	}
+	REQUIRE(tuiAtlasCacheHash(TUI_NULL, 0, 5) == tuiAtlasCacheHash(TUI_NULL, 0, 5));
+}
+
+TEST_CASE("tuiAtlasCacheOpen")
+{
+	TestAtlasSource source = makeTestAtlasSource();
+	const uint64_t source_hash = tuiAtlasCacheHash(source.Pixels.data(), source.Pixels.size(), 0);
+	remove(kAtlasCachePath);
+	TuiAtlasCache atlas_cache = TUI_NULL;
+	REQUIRE(tuiAtlasCacheOpen(&atlas_cache, kAtlasCachePath, source_hash) == TUI_RESULT_ERROR_FILE_NOT_FOUND);
+	REQUIRE(atlas_cache == TUI_NULL);
+	REQUIRE(tuiAtlasCacheWrite(kAtlasCachePath, source_hash, 24, 16, 2, 5, source.Pixels.data(), source.Coordinates.data(), 6) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasCacheWrite(kAtlasCachePath, source_hash, 24, 16, 2, 3, source.Pixels.data(), source.Coordinates.data(), 6) == TUI_RESULT_OK);
+
+	SECTION("the mapped file matches what was written")
+	{
+		REQUIRE(tuiAtlasCacheOpen(&atlas_cache, kAtlasCachePath, source_hash) == TUI_RESULT_OK);
+		int width, height, pages, channel_count;
+		tuiAtlasCacheGetDimensions(atlas_cache, &width, &height, &pages, &channel_count);
+		REQUIRE(width == 24);
+		REQUIRE(height == 16);
+		REQUIRE(pages == 2);
+		REQUIRE(channel_count == 3);
+		REQUIRE(tuiAtlasCacheGetGlyphCount(atlas_cache) == 6);
+		REQUIRE(memcmp(tuiAtlasCacheGetPixelData(atlas_cache), source.Pixels.data(), source.Pixels.size()) == 0);
+		REQUIRE(memcmp(tuiAtlasCacheGetStpqpCoordinates(atlas_cache), source.Coordinates.data(), source.Coordinates.size() * sizeof(float)) == 0);
+		tuiAtlasCacheClose(atlas_cache);
+	}
+	SECTION("a cache with another source hash is stale")
+	{
+		REQUIRE(tuiAtlasCacheOpen(&atlas_cache, kAtlasCachePath, source_hash + 1) == TUI_RESULT_ERROR_FILE_READ_FAILURE);
+		REQUIRE(atlas_cache == TUI_NULL);
+	}
+	SECTION("a truncated cache is rejected")
+	{
+		FILE* file = fopen(kAtlasCachePath, "rb");
+		std::vector<uint8_t> bytes(1 << 16);
+		bytes.resize(fread(bytes.data(), 1, bytes.size(), file));
+		fclose(file);
+		file = fopen(kAtlasCachePath, "wb");
+		fwrite(bytes.data(), 1, bytes.size() - 1, file);
+		fclose(file);
+		REQUIRE(tuiAtlasCacheOpen(&atlas_cache, kAtlasCachePath, source_hash) == TUI_RESULT_ERROR_FILE_READ_FAILURE);
+	}
+	SECTION("a file that is not a cache is rejected")
+	{
+		FILE* file = fopen(kAtlasCachePath, "wb");
+		const std::vector<uint8_t> bytes(8192, 0x5A);
+		fwrite(bytes.data(), 1, bytes.size(), file);
+		fclose(file);
+		REQUIRE(tuiAtlasCacheOpen(&atlas_cache, kAtlasCachePath, source_hash) == TUI_RESULT_ERROR_FILE_READ_FAILURE);
+	}
+	remove(kAtlasCachePath);
+}
+
+TEST_CASE("tuiAtlasCacheOpenOrBuild")
+{
+	TestAtlasSource source = makeTestAtlasSource();
+	remove(kAtlasCachePath);
+	TuiAtlasCache atlas_cache = TUI_NULL;
+	REQUIRE(tuiAtlasCacheOpenOrBuild(&atlas_cache, kAtlasCachePath, 1, buildTestAtlasCache, &source) == TUI_RESULT_OK);
+	REQUIRE(source.BuildCount == 1);
+	tuiAtlasCacheClose(atlas_cache);
+	REQUIRE(tuiAtlasCacheOpenOrBuild(&atlas_cache, kAtlasCachePath, 1, buildTestAtlasCache, &source) == TUI_RESULT_OK);
+	REQUIRE(source.BuildCount == 1);
+	tuiAtlasCacheClose(atlas_cache);
+	REQUIRE(tuiAtlasCacheOpenOrBuild(&atlas_cache, kAtlasCachePath, 2, buildTestAtlasCache, &source) == TUI_RESULT_OK);
+	REQUIRE(source.BuildCount == 2);
+	REQUIRE(memcmp(tuiAtlasCacheGetPixelData(atlas_cache), source.Pixels.data(), source.Pixels.size()) == 0);
+	tuiAtlasCacheClose(atlas_cache);
+	remove(kAtlasCachePath);
+}
\ No newline at end of file
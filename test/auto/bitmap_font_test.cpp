@@ -0,0 +1,210 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+
+
+static void appendLittleEndian32(std::vector<uint8_t>& data, const uint32_t value)
+{
+	for (int byte_i = 0; byte_i < 4; byte_i++)
+	{
+		data.push_back((uint8_t)(value >> (byte_i * 8)));
+	}
+}
+
+// A 10x3 PSF2 font of 3 glyphs where glyph i has row i filled, with a Unicode table.
+static std::vector<uint8_t> testPsf2Font()
+{
+	std::vector<uint8_t> data = { 0x72, 0xB5, 0x4A, 0x86 };
+	appendLittleEndian32(data, 0);
+	appendLittleEndian32(data, 32);
+	appendLittleEndian32(data, 1);
+	appendLittleEndian32(data, 3);
+	appendLittleEndian32(data, 2 * 3);
+	appendLittleEndian32(data, 3);
+	appendLittleEndian32(data, 10);
+	for (int glyph_i = 0; glyph_i < 3; glyph_i++)
+	{
+		for (int y = 0; y < 3; y++)
+		{
+			data.push_back((y == glyph_i) ? 0xFF : 0x00);
+			data.push_back((y == glyph_i) ? 0xC0 : 0x00);
+		}
+	}
+	// Glyph 0 is 'A' and U+00C4, glyph 1 is U+2500 and a skipped sequence, and glyph 2 is 'A' again, which keeps glyph 0.
+	const uint8_t table[] = { 'A', 0xC3, 0x84, 0xFF, 0xE2, 0x94, 0x80, 0xFE, 'x', 'y', 0xFF, 'A', 'B', 0xFF };
+	data.insert(data.end(), table, table + sizeof(table));
+	return data;
+}
+
+TEST_CASE("tuiBitmapFontCreatePsf")
+{
+	TuiBitmapFont font = TUI_NULL;
+	const uint8_t not_a_font[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	REQUIRE(tuiBitmapFontCreatePsf(&font, not_a_font, sizeof(not_a_font)) == TUI_RESULT_ERROR_INVALID_VALUE);
+
+	SECTION("PSF2 with a Unicode table")
+	{
+		std::vector<uint8_t> data = testPsf2Font();
+		REQUIRE(tuiBitmapFontCreatePsf(&font, data.data(), 32 + 10) == TUI_RESULT_ERROR_INVALID_VALUE);
+		REQUIRE(tuiBitmapFontCreatePsf(&font, data.data(), data.size()) == TUI_RESULT_OK);
+		int glyph_width, glyph_height, glyph_count;
+		tuiBitmapFontGetDimensions(font, &glyph_width, &glyph_height, &glyph_count);
+		REQUIRE(glyph_width == 10);
+		REQUIRE(glyph_height == 3);
+		REQUIRE(glyph_count == 3);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 'A') == 0);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 0xC4) == 0);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 0x2500) == 1);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 'B') == 2);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 'x') == -1);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 'C') == -1);
+		const uint32_t* codepoints;
+		const int* glyphs;
+		REQUIRE(tuiBitmapFontGetMappings(font, &codepoints, &glyphs) == 4);
+		REQUIRE(codepoints[0] == 'A');
+		REQUIRE(codepoints[1] == 'B');
+		REQUIRE(codepoints[2] == 0xC4);
+		REQUIRE(codepoints[3] == 0x2500);
+		REQUIRE(glyphs[1] == 2);
+
+		// Two columns of glyphs make a 20x6 page with an empty last cell.
+		std::vector<uint8_t> pixels(20 * 6 * 2, 77);
+		tuiBitmapFontExpandGlyphs(font, 2, 2, pixels.data());
+		for (int y = 0; y < 6; y++)
+		{
+			for (int x = 0; x < 20; x++)
+			{
+				const int glyph = (y / 3) * 2 + x / 10;
+				const uint8_t expected = (glyph < 3 && y % 3 == glyph) ? 255 : 0;
+				REQUIRE(pixels[(y * 20 + x) * 2 + 0] == expected);
+				REQUIRE(pixels[(y * 20 + x) * 2 + 1] == expected);
+			}
+		}
+		tuiBitmapFontDestroy(font);
+	}
+	SECTION("PSF1 without a Unicode table")
+	{
+		std::vector<uint8_t> data = { 0x36, 0x04, 0x00, 2 };
+		for (int glyph_i = 0; glyph_i < 256; glyph_i++)
+		{
+			data.push_back((uint8_t)glyph_i);
+			data.push_back((uint8_t)~glyph_i);
+		}
+		REQUIRE(tuiBitmapFontCreatePsf(&font, data.data(), data.size() - 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+		REQUIRE(tuiBitmapFontCreatePsf(&font, data.data(), data.size()) == TUI_RESULT_OK);
+		int glyph_width, glyph_height, glyph_count;
+		tuiBitmapFontGetDimensions(font, &glyph_width, &glyph_height, &glyph_count);
+		REQUIRE(glyph_width == 8);
+		REQUIRE(glyph_height == 2);
+		REQUIRE(glyph_count == 256);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 0xB3) == 0xB3);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 256) == -1);
+		std::vector<uint8_t> pixels(16 * 8 * 16 * 2);
+		tuiBitmapFontExpandGlyphs(font, 16, 1, pixels.data());
+		for (int glyph_i = 0; glyph_i < 256; glyph_i++)
+		{
+			const uint8_t* cell = &pixels[(glyph_i / 16) * 2 * 128 + (glyph_i % 16) * 8];
+			for (int x = 0; x < 8; x++)
+			{
+				const bool set = (glyph_i & (0x80 >> x)) != 0;
+				REQUIRE(cell[x] == (set ? 255 : 0));
+				REQUIRE(cell[128 + x] == (set ? 0 : 255));
+			}
+		}
+		tuiBitmapFontDestroy(font);
+	}
+	SECTION("PSF1 with a Unicode table")
+	{
+		std::vector<uint8_t> data = { 0x36, 0x04, 0x03, 1 };
+		data.insert(data.end(), 512, 0);
+		for (int glyph_i = 0; glyph_i < 512; glyph_i++)
+		{
+			const uint16_t entries[] = { (uint16_t)(0x100 + glyph_i), 0xFFFE, 'q', 0xFFFF };
+			for (uint16_t entry : entries)
+			{
+				data.push_back((uint8_t)(entry & 0xFF));
+				data.push_back((uint8_t)(entry >> 8));
+			}
+		}
+		REQUIRE(tuiBitmapFontCreatePsf(&font, data.data(), data.size()) == TUI_RESULT_OK);
+		int glyph_count;
+		tuiBitmapFontGetDimensions(font, TUI_NULL, TUI_NULL, &glyph_count);
+		REQUIRE(glyph_count == 512);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 0x100) == 0);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 0x2FF) == 511);
+		REQUIRE(tuiBitmapFontGetGlyph(font, 'q') == -1);
+		tuiBitmapFontDestroy(font);
+	}
+}
+
+TEST_CASE("tuiBitmapFontCreateBdf")
+{
+	TuiBitmapFont font = TUI_NULL;
+	const std::string not_a_font = "FONT -misc-fixed\n";
+	REQUIRE(tuiBitmapFontCreateBdf(&font, not_a_font.c_str(), not_a_font.size()) == TUI_RESULT_ERROR_INVALID_VALUE);
+	// A 6x4 cell with the baseline one row above the bottom, a full 2x2 glyph sitting on the baseline at x 1, and an unencoded glyph that fills the cell.
+	const std::string text =
+		"STARTFONT 2.1\r\n"
+		"FONT -test-fixed\n"
+		"COMMENT a comment longer than the line buffer " + std::string(400, 'c') + "\n"
+		"FONTBOUNDINGBOX 6 4 0 -1\n"
+		"STARTPROPERTIES 1\n"
+		"FONT_ASCENT 3\n"
+		"ENDPROPERTIES\n"
+		"CHARS 2\n"
+		"STARTCHAR square\n"
+		"ENCODING 9633\n"
+		"BBX 2 2 1 0\n"
+		"BITMAP\n"
+		"C0\n"
+		"C0\n"
+		"ENDCHAR\n"
+		"STARTCHAR block\n"
+		"ENCODING -1 200\n"
+		"BBX 6 4 0 -1\n"
+		"BITMAP\n"
+		"FC\n"
+		"FC\n"
+		"FC\n"
+		"FC\n"
+		"ENDCHAR\n"
+		"ENDFONT\n";
+	REQUIRE(tuiBitmapFontCreateBdf(&font, text.c_str(), text.size() - 19) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiBitmapFontCreateBdf(&font, text.c_str(), text.size()) == TUI_RESULT_OK);
+	int glyph_width, glyph_height, glyph_count;
+	tuiBitmapFontGetDimensions(font, &glyph_width, &glyph_height, &glyph_count);
+	REQUIRE(glyph_width == 6);
+	REQUIRE(glyph_height == 4);
+	REQUIRE(glyph_count == 2);
+	REQUIRE(tuiBitmapFontGetGlyph(font, 9633) == 0);
+	REQUIRE(tuiBitmapFontGetGlyph(font, 200) == -1);
+	std::vector<uint8_t> pixels(12 * 4);
+	tuiBitmapFontExpandGlyphs(font, 2, 1, pixels.data());
+	for (int y = 0; y < 4; y++)
+	{
+		for (int x = 0; x < 6; x++)
+		{
+			const bool square = (y == 1 || y == 2) && (x == 1 || x == 2);
+			REQUIRE(pixels[y * 12 + x] == (square ? 255 : 0));
+			REQUIRE(pixels[y * 12 + 6 + x] == 255);
+		}
+	}
+	tuiBitmapFontDestroy(font);
+}
+
+TEST_CASE("tuiBitmapFontLoad")
+{
+	TuiBitmapFont font = TUI_NULL;
+	REQUIRE(tuiBitmapFontLoad(&font, "bitmap_font_test_missing.psf") == TUI_RESULT_ERROR_FILE_NOT_FOUND);
+	const char* path = "bitmap_font_test.psf";
+	std::vector<uint8_t> data = testPsf2Font();
+	FILE* file = fopen(path, "wb");
+	REQUIRE(file != NULL);
+	fwrite(data.data(), 1, data.size(), file);
+	fclose(file);
+	REQUIRE(tuiBitmapFontLoad(&font, path) == TUI_RESULT_OK);
+	REQUIRE(tuiBitmapFontGetGlyph(font, 0x2500) == 1);
+	tuiBitmapFontDestroy(font);
+	remove(path);
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <catch2/catch.hpp>
+
+
+static int countCompositeShapeTiles(const TuiCompositeShape composite_shape)
+{
+	int count = 0;
+	TUI_COMPOSITE_SHAPE_ITERATE(composite_shape, it)
+	{
+		count++;
+	}
+	return count;
+}
+
+TEST_CASE("tuiCompositeShapeIt")
+{
+	const TuiShape shapes[2] = { tuiShapeRect(tuiRect(0, 0, 4, 4)), tuiShapeRect(tuiRect(2, 2, 4, 4)) };
+
+	{
+		const TuiShapeOperation operations[1] = { TUI_SHAPE_OPERATION_UNION };
+		REQUIRE(countCompositeShapeTiles(tuiCompositeShape(shapes, operations, 2)) == 28);
+	}
+
+	{
+		const TuiShapeOperation operations[1] = { TUI_SHAPE_OPERATION_INTERSECTION };
+		REQUIRE(countCompositeShapeTiles(tuiCompositeShape(shapes, operations, 2)) == 4);
+	}
+
+	{
+		const TuiShapeOperation operations[1] = { TUI_SHAPE_OPERATION_DIFFERENCE };
+		REQUIRE(countCompositeShapeTiles(tuiCompositeShape(shapes, operations, 2)) == 12);
+	}
+
+	{
+		const TuiShapeOperation operations[1] = { TUI_SHAPE_OPERATION_XOR };
+		REQUIRE(countCompositeShapeTiles(tuiCompositeShape(shapes, operations, 2)) == 24);
+	}
+
+	REQUIRE(countCompositeShapeTiles(tuiCompositeShape(shapes, TUI_NULL, 1)) == 16);
+	REQUIRE(countCompositeShapeTiles(tuiCompositeShape(TUI_NULL, TUI_NULL, 0)) == 0);
+}
+
+TEST_CASE("tuiCompositeShapeItVisitsEachTileOnce")
+{
+	const TuiShape shapes[3] = { tuiShapeCircle(tuiCircle(0, 0, 6.0f)), tuiShapeCircle(tuiCircle(4, 0, 6.0f)), tuiShapeRect(tuiRect(-2, -1, 8, 3)) };
+	const TuiShapeOperation operations[2] = { TUI_SHAPE_OPERATION_UNION, TUI_SHAPE_OPERATION_DIFFERENCE };
+	const TuiCompositeShape composite_shape = tuiCompositeShape(shapes, operations, 3);
+
+	int previous_y = tuiCompositeShapeGetTopY(composite_shape) - 1;
+	int previous_x = 0;
+	int count = 0;
+	TUI_COMPOSITE_SHAPE_ITERATE(composite_shape, it)
+	{
+		const TuiPoint2 point2 = tuiCompositeShapeItGetPoint2(it);
+		REQUIRE((point2.y > previous_y || (point2.y == previous_y && point2.x > previous_x)));
+		REQUIRE(tuiCompositeShapeContainsPoint2(composite_shape, point2));
+		REQUIRE(!tuiRectContainsPoint2(tuiRect(-2, -1, 8, 3), point2));
+		previous_y = point2.y;
+		previous_x = point2.x;
+		count++;
+	}
+
+	int span_count = 0;
+	TUI_COMPOSITE_SHAPE_ITERATE_SPANS(composite_shape, it)
+	{
+		const TuiSpan span = tuiCompositeShapeItGetSpan(it);
+		span_count += span.right_x - span.left_x + 1;
+	}
+	REQUIRE(count == span_count);
+}
+
+TEST_CASE("tuiCompositeShapeContainsPoint2")
+{
+	const TuiShape shapes[2] = { tuiShapeRing({ 0, 0, 8.0f, 3.0f }), tuiShapeRect(tuiRect(-1, -10, 3, 20)) };
+	const TuiShapeOperation operations[1] = { TUI_SHAPE_OPERATION_DIFFERENCE };
+	const TuiCompositeShape composite_shape = tuiCompositeShape(shapes, operations, 2);
+	REQUIRE(!tuiCompositeShapeContainsPoint2(composite_shape, tuiPoint2(0, 0)));
+	REQUIRE(!tuiCompositeShapeContainsPoint2(composite_shape, tuiPoint2(0, 7)));
+	REQUIRE(tuiCompositeShapeContainsPoint2(composite_shape, tuiPoint2(7, 0)));
+	REQUIRE(tuiCompositeShapeContainsPoint2(composite_shape, tuiPoint2(-7, 0)));
+}
\ No newline at end of file
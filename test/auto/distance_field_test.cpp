@@ -0,0 +1,81 @@
+#include <TUIC/tuic.h>
+#include <vector>
+#include <cmath>
+#include <catch2/catch.hpp>
+
+
+static std::vector<uint8_t> discCoverage(const int size, const float radius)
+{
+	std::vector<uint8_t> coverage(size * size, 0);
+	const float centre = size * 0.5f;
+	for (int y = 0; y < size; y++)
+	{
+		for (int x = 0; x < size; x++)
+		{
+			const float dx = x + 0.5f - centre;
+			const float dy = y + 0.5f - centre;
+			coverage[y * size + x] = (std::sqrt(dx * dx + dy * dy) < radius) ? 255 : 0;
+		}
+	}
+	return coverage;
+}
+
+TEST_CASE("tuiDistanceFieldGenerate")
+{
+	const int size = 64;
+	const int downscale = 4;
+	const int field_size = size / downscale;
+	std::vector<uint8_t> coverage = discCoverage(size, 20.0f);
+	std::vector<uint8_t> distances(field_size * field_size, 77);
+
+	REQUIRE(tuiDistanceFieldGenerate(coverage.data(), 0, size, downscale, 2.0f, distances.data(), 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiDistanceFieldGenerate(coverage.data(), size, size, 0, 2.0f, distances.data(), 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiDistanceFieldGenerate(coverage.data(), size, size - 2, downscale, 2.0f, distances.data(), 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiDistanceFieldGenerate(coverage.data(), size, size, downscale, 0.0f, distances.data(), 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(distances[0] == 77);
+
+	SECTION("inside is above the edge and outside is below it")
+	{
+		REQUIRE(tuiDistanceFieldGenerate(coverage.data(), size, size, downscale, 2.0f, distances.data(), 0) == TUI_RESULT_OK);
+		REQUIRE(distances[(field_size / 2) * field_size + field_size / 2] == 255);
+		REQUIRE(distances[0] == 0);
+		for (int y = 0; y < field_size; y++)
+		{
+			for (int x = 0; x < field_size; x++)
+			{
+				// Each field pixel is expected to encode its distance to the circle in field pixels, within the error of the pixelated disc.
+				const float dx = (x + 0.5f) * downscale - size * 0.5f;
+				const float dy = (y + 0.5f) * downscale - size * 0.5f;
+				const float expected_distance = (std::sqrt(dx * dx + dy * dy) - 20.0f) / downscale;
+				float expected = 0.5f - expected_distance / 4.0f;
+				expected = std::min(std::max(expected, 0.0f), 1.0f) * 255.0f;
+				REQUIRE(std::abs(distances[y * field_size + x] - expected) < 20.0f);
+			}
+		}
+		for (int x = field_size / 2 + 1; x < field_size; x++)
+		{
+			REQUIRE(distances[(field_size / 2) * field_size + x] <= distances[(field_size / 2) * field_size + x - 1]);
+		}
+	}
+	SECTION("empty and full coverage saturate")
+	{
+		std::vector<uint8_t> empty(size * size, 0);
+		REQUIRE(tuiDistanceFieldGenerate(empty.data(), size, size, downscale, 2.0f, distances.data(), 1) == TUI_RESULT_OK);
+		REQUIRE(distances[field_size + 3] == 0);
+		std::vector<uint8_t> full(size * size, 255);
+		REQUIRE(tuiDistanceFieldGenerate(full.data(), size, size, downscale, 2.0f, distances.data(), 1) == TUI_RESULT_OK);
+		REQUIRE(distances[field_size + 3] == 255);
+	}
+	SECTION("a downscale of 1 keeps the resolution")
+	{
+		std::vector<uint8_t> full_distances(size * size);
+		REQUIRE(tuiDistanceFieldGenerate(coverage.data(), size, size, 1, 4.0f, full_distances.data(), 2) == TUI_RESULT_OK);
+		for (int y = 0; y < size; y++)
+		{
+			for (int x = 0; x < size; x++)
+			{
+				REQUIRE((full_distances[y * size + x] >= 128) == (coverage[y * size + x] >= 128));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <catch2/catch.hpp>
+
+
+static std::vector<float> bruteForceDistances(TuiGridMask source_mask, const int width, const int height)
+{
+	std::vector<float> distances(width * height, INFINITY);
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			for (int source_y = 0; source_y < height; source_y++)
+			{
+				for (int source_x = 0; source_x < width; source_x++)
+				{
+					if (tuiGridMaskGet(source_mask, source_x, source_y))
+					{
+						const float distance = std::sqrt((float)((x - source_x) * (x - source_x) + (y - source_y) * (y - source_y)));
+						distances[y * width + x] = std::min(distances[y * width + x], distance);
+					}
+				}
+			}
+		}
+	}
+	return distances;
+}
+
+TEST_CASE("tuiDistanceTransformEuclidean")
+{
+	const int width = 37;
+	const int height = 23;
+	TuiGridMask source_mask = TUI_NULL;
+	REQUIRE(tuiGridMaskCreate(&source_mask, width, height) == TUI_RESULT_OK);
+	std::vector<float> distances(width * height);
+
+	REQUIRE(tuiDistanceTransformEuclidean(source_mask, distances.data(), 1) == TUI_RESULT_OK);
+	REQUIRE(std::isinf(distances[0]));
+	REQUIRE(std::isinf(distances[width * height - 1]));
+
+	unsigned int seed = 7;
+	for (int source_i = 0; source_i < 6; source_i++)
+	{
+		seed = seed * 1103515245u + 12345u;
+		tuiGridMaskSet(source_mask, (seed >> 16) % width, (seed >> 8) % height, TUI_TRUE);
+	}
+	const std::vector<float> expected = bruteForceDistances(source_mask, width, height);
+	for (const int thread_count : { 1, 3, 0 })
+	{
+		REQUIRE(tuiDistanceTransformEuclidean(source_mask, distances.data(), thread_count) == TUI_RESULT_OK);
+		for (int i = 0; i < width * height; i++)
+		{
+			REQUIRE(distances[i] == Approx(expected[i]).margin(0.0001));
+		}
+	}
+	tuiGridMaskDestroy(source_mask);
+}
+
+TEST_CASE("tuiDistanceTransformChamfer")
+{
+	const int width = 30;
+	const int height = 20;
+	TuiGridMask source_mask = TUI_NULL;
+	REQUIRE(tuiGridMaskCreate(&source_mask, width, height) == TUI_RESULT_OK);
+	std::vector<float> distances(width * height);
+
+	tuiDistanceTransformChamfer(source_mask, distances.data());
+	REQUIRE(std::isinf(distances[0]));
+
+	tuiGridMaskSet(source_mask, 4, 5, TUI_TRUE);
+	tuiGridMaskSet(source_mask, 25, 14, TUI_TRUE);
+	tuiDistanceTransformChamfer(source_mask, distances.data());
+	REQUIRE(distances[5 * width + 4] == 0.0f);
+	REQUIRE(distances[5 * width + 10] == Approx(6.0f));
+	REQUIRE(distances[9 * width + 8] == Approx(4.0f * std::sqrt(2.0f)));
+	const std::vector<float> expected = bruteForceDistances(source_mask, width, height);
+	for (int i = 0; i < width * height; i++)
+	{
+		REQUIRE(distances[i] >= expected[i] - 0.0001f);
+		REQUIRE(distances[i] <= expected[i] * 1.09f + 0.0001f);
+	}
+	tuiGridMaskDestroy(source_mask);
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include <TUIC/tuic.h>
+#include <catch2/catch.hpp>
+
+
+static TuiTexture createColorTexture(uint8_t r, uint8_t g, uint8_t b)
+{
+	uint8_t pixel[4] = { r, g, b, 255 };
+	TuiTexture texture = TUI_NULL;
+	REQUIRE(tuiTextureCreate(&texture, pixel, 1, 1) == TUI_RESULT_OK);
+	return texture;
+}
+
+static void requirePixel(const uint8_t* pixels, int pixel_width, int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+	const uint8_t* pixel = &pixels[(y * pixel_width + x) * 4];
+	REQUIRE(pixel[0] == r);
+	REQUIRE(pixel[1] == g);
+	REQUIRE(pixel[2] == b);
+}
+
+TEST_CASE("tuiDrawListSubmit")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	TuiTexture red_texture = createColorTexture(255, 0, 0);
+	TuiTexture green_texture = createColorTexture(0, 255, 0);
+	TuiTexture blue_texture = createColorTexture(0, 0, 255);
+	TuiPanel layer = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&layer, 4, 4) == TUI_RESULT_OK);
+	TuiPanel screen = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&screen, 4, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelClearColor(screen, 0, 0, 0, 255) == TUI_RESULT_OK);
+	TuiDrawList draw_list = TUI_NULL;
+	REQUIRE(tuiDrawListCreate(&draw_list, 0) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiDrawListCreate(&draw_list, 2) == TUI_RESULT_OK);
+
+	// The layer is drawn to the screen, redrawn, and drawn again. Grouping by panel must not move the second layer draw before the first read of the layer, or the second read before it.
+	tuiDrawListBegin(draw_list);
+	REQUIRE(tuiDrawListRecordTexture(draw_list, layer, red_texture, 0, 4, 0, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiDrawListRecordPanel(draw_list, screen, layer, 0, 4, 0, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiDrawListRecordTexture(draw_list, layer, green_texture, 0, 4, 0, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiDrawListRecordTexture(draw_list, screen, blue_texture, 0, 2, 0, 2) == TUI_RESULT_OK);
+	REQUIRE(tuiDrawListRecordPanel(draw_list, screen, layer, 2, 4, 0, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiDrawListRecordPanel(draw_list, screen, screen, 0, 4, 0, 4) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiDrawListGetCommandCount(draw_list) == 5);
+	REQUIRE(tuiDrawListSubmit(draw_list) == TUI_RESULT_OK);
+
+	uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	REQUIRE(tuiPanelGetPixels(screen, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	requirePixel(pixels, pixel_width, 0, 0, 0, 0, 255);
+	requirePixel(pixels, pixel_width, 1, 1, 0, 0, 255);
+	requirePixel(pixels, pixel_width, 0, 3, 255, 0, 0);
+	requirePixel(pixels, pixel_width, 1, 2, 255, 0, 0);
+	requirePixel(pixels, pixel_width, 2, 0, 0, 255, 0);
+	requirePixel(pixels, pixel_width, 3, 3, 0, 255, 0);
+	REQUIRE(tuiPanelGetPixels(layer, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	requirePixel(pixels, pixel_width, 0, 0, 0, 255, 0);
+
+	// The draws stay recorded, so submitting the list again over a cleared screen gives the same result.
+	REQUIRE(tuiPanelClearColor(screen, 0, 0, 0, 255) == TUI_RESULT_OK);
+	REQUIRE(tuiDrawListSubmit(draw_list) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelGetPixels(screen, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	requirePixel(pixels, pixel_width, 0, 0, 0, 0, 255);
+	requirePixel(pixels, pixel_width, 0, 3, 255, 0, 0);
+	requirePixel(pixels, pixel_width, 3, 3, 0, 255, 0);
+
+	tuiDrawListBegin(draw_list);
+	REQUIRE(tuiDrawListGetCommandCount(draw_list) == 0);
+	REQUIRE(tuiDrawListSubmit(draw_list) == TUI_RESULT_OK);
+
+	tuiFree(pixels);
+	tuiDrawListDestroy(draw_list);
+	tuiPanelDestroy(screen);
+	tuiPanelDestroy(layer);
+	tuiTextureDestroy(blue_texture);
+	tuiTextureDestroy(green_texture);
+	tuiTextureDestroy(red_texture);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
+
+TEST_CASE("tuiDrawListSubmit texture orientation")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	// A 1x2 texture with a red top row and a blue bottom row, so a vertically flipped draw is visible.
+	uint8_t texture_pixels[8] = { 255, 0, 0, 255, 0, 0, 255, 255 };
+	TuiTexture texture = TUI_NULL;
+	REQUIRE(tuiTextureCreate(&texture, texture_pixels, 1, 2) == TUI_RESULT_OK);
+	TuiPanel immediate_panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&immediate_panel, 2, 4) == TUI_RESULT_OK);
+	TuiPanel recorded_panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&recorded_panel, 2, 4) == TUI_RESULT_OK);
+	TuiDrawList draw_list = TUI_NULL;
+	REQUIRE(tuiDrawListCreate(&draw_list, 1) == TUI_RESULT_OK);
+
+	REQUIRE(tuiPanelDrawTexture(immediate_panel, texture) == TUI_RESULT_OK);
+	tuiDrawListBegin(draw_list);
+	REQUIRE(tuiDrawListRecordTexture(draw_list, recorded_panel, texture, 0, 2, 0, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiDrawListSubmit(draw_list) == TUI_RESULT_OK);
+
+	// A recorded texture draw lands the same way up as the immediate one.
+	uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	const TuiPanel panels[2] = { immediate_panel, recorded_panel };
+	for (int panel_i = 0; panel_i < 2; panel_i++)
+	{
+		REQUIRE(tuiPanelGetPixels(panels[panel_i], &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+		requirePixel(pixels, pixel_width, 0, 0, 255, 0, 0);
+		requirePixel(pixels, pixel_width, 1, 1, 255, 0, 0);
+		requirePixel(pixels, pixel_width, 0, 2, 0, 0, 255);
+		requirePixel(pixels, pixel_width, 1, 3, 0, 0, 255);
+	}
+
+	tuiFree(pixels);
+	tuiDrawListDestroy(draw_list);
+	tuiPanelDestroy(recorded_panel);
+	tuiPanelDestroy(immediate_panel);
+	tuiTextureDestroy(texture);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
\ No newline at end of file
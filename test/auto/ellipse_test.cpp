@@ -0,0 +1,84 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <catch2/catch.hpp>
+
+
+TEST_CASE("tuiEllipseGetBounds")
+{
+	REQUIRE(tuiEllipseGetLeftX(tuiEllipse(10, 10, 6.0f, 3.0f)) == 4);
+	REQUIRE(tuiEllipseGetRightX(tuiEllipse(10, 10, 6.0f, 3.0f)) == 16);
+	REQUIRE(tuiEllipseGetTopY(tuiEllipse(10, 10, 6.0f, 3.0f)) == 7);
+	REQUIRE(tuiEllipseGetBottomY(tuiEllipse(10, 10, 6.0f, 3.0f)) == 13);
+	REQUIRE(tuiEllipseGetTileWidth(tuiEllipse(10, 10, -6.0f, 3.0f)) == 13);
+	REQUIRE(tuiEllipseGetTileHeight(tuiEllipse(10, 10, 6.0f, -3.0f)) == 7);
+}
+
+TEST_CASE("tuiEllipseIsDegenerate")
+{
+	REQUIRE(tuiEllipseIsDegenerate(tuiEllipse(0, 0, 0.0f, 0.0f)));
+	REQUIRE(tuiEllipseIsDegenerate(tuiEllipse(0, 0, 5.0f, 0.0f)));
+	REQUIRE(!tuiEllipseIsDegenerate(tuiEllipse(0, 0, 5.0f, 1.0f)));
+}
+
+TEST_CASE("tuiEllipseContainsPoint2")
+{
+	REQUIRE(!tuiEllipseContainsPoint2(tuiEllipse(0, 0, 0.0f, 0.0f), tuiPoint2(0, 0)));
+	REQUIRE(tuiEllipseContainsPoint2(tuiEllipse(0, 0, 6.0f, 3.0f), tuiPoint2(0, 0)));
+	REQUIRE(tuiEllipseContainsPoint2(tuiEllipse(0, 0, 6.0f, 3.0f), tuiPoint2(6, 0)));
+	REQUIRE(tuiEllipseContainsPoint2(tuiEllipse(0, 0, 6.0f, 3.0f), tuiPoint2(0, -3)));
+	REQUIRE(!tuiEllipseContainsPoint2(tuiEllipse(0, 0, 6.0f, 3.0f), tuiPoint2(5, 3)));
+	REQUIRE(!tuiEllipseContainsPoint2(tuiEllipse(0, 0, 6.0f, 3.0f), tuiPoint2(0, 4)));
+}
+
+TEST_CASE("tuiEllipseIntersects")
+{
+	REQUIRE(tuiEllipseIntersectsLine(tuiEllipse(0, 0, 6.0f, 3.0f), tuiLine(-10, 0, 10, 0)));
+	REQUIRE(!tuiEllipseIntersectsLine(tuiEllipse(0, 0, 6.0f, 3.0f), tuiLine(-10, 5, 10, 5)));
+	REQUIRE(tuiEllipseIntersectsRect(tuiEllipse(0, 0, 6.0f, 3.0f), tuiRect(5, -1, 4, 2)));
+	REQUIRE(!tuiEllipseIntersectsRect(tuiEllipse(0, 0, 6.0f, 3.0f), tuiRect(5, 2, 4, 4)));
+	REQUIRE(tuiEllipseIntersectsCircle(tuiEllipse(0, 0, 6.0f, 3.0f), tuiCircle(8, 0, 3.0f)));
+	REQUIRE(!tuiEllipseIntersectsEllipse(tuiEllipse(0, 0, 6.0f, 3.0f), tuiEllipse(0, 10, 6.0f, 3.0f)));
+}
+
+TEST_CASE("tuiEllipseIt")
+{
+	{
+		const TuiEllipse ellipse = tuiEllipse(3, -2, 6.0f, 3.0f);
+		int count = 0;
+		TUI_ELLIPSE_ITERATE(ellipse, it)
+		{
+			REQUIRE(tuiEllipseContainsPoint2(ellipse, tuiEllipseItGetPoint2(it)));
+			count++;
+		}
+
+		int contained_count = 0;
+		TUI_RECT_ITERATE(tuiEllipseGetBoundingRect(ellipse), it)
+		{
+			if (tuiEllipseContainsPoint2(ellipse, tuiRectItGetPoint2(it)))
+			{
+				contained_count++;
+			}
+		}
+		REQUIRE(count == contained_count);
+	}
+
+	{
+		int row_count = 0;
+		TUI_ELLIPSE_ITERATE_SPANS(tuiEllipse(0, 0, 6.0f, 3.0f), it)
+		{
+			const TuiSpan span = tuiEllipseItGetSpan(it);
+			REQUIRE(span.left_x == -span.right_x);
+			row_count++;
+		}
+		REQUIRE(row_count == 7);
+	}
+
+	{
+		int count = 0;
+		TUI_ELLIPSE_ITERATE(tuiEllipse(0, 0, 0.0f, 4.0f), it)
+		{
+			count++;
+		}
+		REQUIRE(count == 0);
+	}
+}
\ No newline at end of file
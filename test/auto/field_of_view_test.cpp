@@ -0,0 +1,92 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <catch2/catch.hpp>
+
+
+static int countSetTiles(TuiGridMask grid_mask)
+{
+	int width, height;
+	tuiGridMaskGetDimensions(grid_mask, &width, &height);
+	int count = 0;
+	for (int tile_i = 0; tile_i < width * height; tile_i++)
+	{
+		count += tuiGridMaskGetData(grid_mask)[tile_i];
+	}
+	return count;
+}
+
+TEST_CASE("tuiFieldOfViewCompute")
+{
+	TuiGridMask blocking_mask = TUI_NULL;
+	TuiGridMask visible_mask = TUI_NULL;
+	REQUIRE(tuiGridMaskCreate(&blocking_mask, 21, 21) == TUI_RESULT_OK);
+	REQUIRE(tuiGridMaskCreate(&visible_mask, 21, 21) == TUI_RESULT_OK);
+
+	{
+		REQUIRE(tuiFieldOfViewCompute(blocking_mask, tuiCircle(10, 10, 5.0f), visible_mask) == TUI_RESULT_OK);
+		int disc_count = 0;
+		for (int y = 0; y < 21; y++)
+		{
+			for (int x = 0; x < 21; x++)
+			{
+				const TuiBoolean in_disc = ((x - 10) * (x - 10) + (y - 10) * (y - 10) <= 25);
+				REQUIRE(tuiGridMaskGet(visible_mask, x, y) == in_disc);
+				disc_count += in_disc;
+			}
+		}
+		REQUIRE(countSetTiles(visible_mask) == disc_count);
+	}
+
+	{
+		for (int y = 0; y < 21; y++)
+		{
+			tuiGridMaskSet(blocking_mask, 12, y, TUI_TRUE);
+		}
+		tuiGridMaskClear(visible_mask, TUI_FALSE);
+		REQUIRE(tuiFieldOfViewCompute(blocking_mask, tuiCircle(10, 10, 8.0f), visible_mask) == TUI_RESULT_OK);
+		REQUIRE(tuiGridMaskGet(visible_mask, 10, 10));
+		REQUIRE(tuiGridMaskGet(visible_mask, 12, 10));
+		REQUIRE(!tuiGridMaskGet(visible_mask, 13, 10));
+		REQUIRE(!tuiGridMaskGet(visible_mask, 16, 12));
+	}
+
+	REQUIRE(tuiFieldOfViewCompute(blocking_mask, tuiCircle(10, 10, 8.0f), blocking_mask) == TUI_RESULT_ERROR_INVALID_VALUE);
+	tuiGridMaskDestroy(visible_mask);
+	tuiGridMaskDestroy(blocking_mask);
+}
+
+TEST_CASE("tuiFieldOfViewComputeIsSymmetric")
+{
+	TuiGridMask blocking_mask = TUI_NULL;
+	REQUIRE(tuiGridMaskCreate(&blocking_mask, 16, 16) == TUI_RESULT_OK);
+	const TuiPoint2 walls[] = { { 5, 5 }, { 6, 5 }, { 9, 3 }, { 3, 9 }, { 10, 10 }, { 11, 7 }, { 7, 12 }, { 4, 4 } };
+	for (const TuiPoint2 wall : walls)
+	{
+		tuiGridMaskSet(blocking_mask, wall.x, wall.y, TUI_TRUE);
+	}
+
+	TuiCircle view_circles[16 * 16];
+	TuiGridMask visible_masks[16 * 16];
+	for (int tile_i = 0; tile_i < 16 * 16; tile_i++)
+	{
+		view_circles[tile_i] = tuiCircle(tile_i % 16, tile_i / 16, 20.0f);
+		REQUIRE(tuiGridMaskCreate(&visible_masks[tile_i], 16, 16) == TUI_RESULT_OK);
+	}
+	REQUIRE(tuiFieldOfViewComputeMany(blocking_mask, view_circles, visible_masks, 16 * 16, 4) == TUI_RESULT_OK);
+
+	for (int tile_a = 0; tile_a < 16 * 16; tile_a++)
+	{
+		if (tuiGridMaskGet(blocking_mask, tile_a % 16, tile_a / 16)) continue;
+		for (int tile_b = 0; tile_b < 16 * 16; tile_b++)
+		{
+			if (tuiGridMaskGet(blocking_mask, tile_b % 16, tile_b / 16)) continue;
+			REQUIRE(tuiGridMaskGet(visible_masks[tile_a], tile_b % 16, tile_b / 16) == tuiGridMaskGet(visible_masks[tile_b], tile_a % 16, tile_a / 16));
+		}
+	}
+
+	for (int tile_i = 0; tile_i < 16 * 16; tile_i++)
+	{
+		tuiGridMaskDestroy(visible_masks[tile_i]);
+	}
+	tuiGridMaskDestroy(blocking_mask);
+}
\ No newline at end of file
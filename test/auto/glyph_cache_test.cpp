@@ -0,0 +1,255 @@
+#include <TUIC/tuic.h>
+#include <vector>
+#include <catch2/catch.hpp>
+
+
+typedef struct TestRasterizer
+{
+	int CallCount;
+	uint32_t MissingCodepoint;
+	uint32_t EmptyCodepoint;
+} TestRasterizer;
+
+static TuiBoolean rasterizeTestGlyph(void* user_data, uint32_t codepoint, int max_width, int max_height, int channel_count, uint8_t* pixels, int* width, int* height)
+{
+	TestRasterizer* rasterizer = (TestRasterizer*)user_data;
+	rasterizer->CallCount++;
+	if (codepoint == rasterizer->MissingCodepoint)
+	{
+		return TUI_FALSE;
+	}
+	for (int i = 0; i < max_width * max_height; i++)
+	{
+		pixels[i * channel_count + 0] = (uint8_t)codepoint;
+		pixels[i * channel_count + channel_count - 1] = (uint8_t)(i + 1);
+	}
+	*width = (int)(codepoint % max_width) + 1;
+	*height = max_height;
+	if (codepoint == rasterizer->EmptyCodepoint || codepoint == rasterizer->EmptyCodepoint + 1)
+	{
+		// Zero the width of one empty codepoint and the height of the other, leaving the pixels drawn.
+		*((codepoint == rasterizer->EmptyCodepoint) ? width : height) = 0;
+	}
+	return TUI_TRUE;
+}
+
+TEST_CASE("tuiGlyphCacheCreate")
+{
+	TestRasterizer rasterizer = { 0, 0xFFFFFFFF, 0xFFFFFFFF };
+	TuiGlyphCache glyph_cache = TUI_NULL;
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 0, 32, 1, 8, 16, 4, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 32, 32, 0, 8, 16, 4, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 32, 32, 1, 64, 16, 4, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 32, 32, 1, 8, 16, 0, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 32, 32, 1, 8, 16, 5, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 32, 32, 1, 8, 16, 4, TUI_NULL, &rasterizer) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 36, 40, 3, 8, 16, 4, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_OK);
+	int page_width, page_height, page_count;
+	tuiGlyphCacheGetDimensions(glyph_cache, &page_width, &page_height, &page_count);
+	REQUIRE(page_width == 36);
+	REQUIRE(page_height == 40);
+	REQUIRE(page_count == 3);
+	REQUIRE(tuiGlyphCacheGetSlotCount(glyph_cache) == 4 * 2 * 3);
+	int dirty_count = -1;
+	tuiGlyphCacheGetDirtyGlyphs(glyph_cache, &dirty_count);
+	REQUIRE(dirty_count == 0);
+	tuiGlyphCacheDestroy(glyph_cache);
+}
+
+TEST_CASE("tuiGlyphCacheGetGlyph")
+{
+	const int cell_width = 4;
+	const int cell_height = 8;
+	TestRasterizer rasterizer = { 0, 'X', 0x3000 };
+	TuiGlyphCache glyph_cache = TUI_NULL;
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 16, 16, 2, cell_width, cell_height, 4, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_OK);
+	const int slot_count = tuiGlyphCacheGetSlotCount(glyph_cache);
+	REQUIRE(slot_count == 16);
+
+	SECTION("hits reuse slots and misses are dirty until cleared")
+	{
+		const int a = tuiGlyphCacheGetGlyph(glyph_cache, 'a');
+		const int b = tuiGlyphCacheGetGlyph(glyph_cache, 'b');
+		REQUIRE(a >= 0);
+		REQUIRE(b >= 0);
+		REQUIRE(a != b);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 'a') == a);
+		REQUIRE(rasterizer.CallCount == 2);
+		int dirty_count = 0;
+		const int* dirty_glyphs = tuiGlyphCacheGetDirtyGlyphs(glyph_cache, &dirty_count);
+		REQUIRE(dirty_count == 2);
+		REQUIRE(dirty_glyphs[0] == a);
+		REQUIRE(dirty_glyphs[1] == b);
+		const uint8_t* dirty_pixels = tuiGlyphCacheGetDirtyGlyphPixels(glyph_cache);
+		const size_t cell_size = cell_width * cell_height * 4;
+		for (int i = 0; i < cell_width * cell_height; i++)
+		{
+			REQUIRE(dirty_pixels[i * 4 + 0] == 'a');
+			REQUIRE(dirty_pixels[cell_size + i * 4 + 0] == 'b');
+			REQUIRE(dirty_pixels[cell_size + i * 4 + 3] == i + 1);
+		}
+		tuiGlyphCacheClearDirtyGlyphs(glyph_cache);
+		tuiGlyphCacheGetDirtyGlyphs(glyph_cache, &dirty_count);
+		REQUIRE(dirty_count == 0);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 'b') == b);
+		tuiGlyphCacheGetDirtyGlyphs(glyph_cache, &dirty_count);
+		REQUIRE(dirty_count == 0);
+		size_t hit_count, miss_count, eviction_count;
+		tuiGlyphCacheGetStatistics(glyph_cache, &hit_count, &miss_count, &eviction_count);
+		REQUIRE(hit_count == 2);
+		REQUIRE(miss_count == 2);
+		REQUIRE(eviction_count == 0);
+		tuiGlyphCacheResetStatistics(glyph_cache);
+		tuiGlyphCacheGetStatistics(glyph_cache, &hit_count, TUI_NULL, TUI_NULL);
+		REQUIRE(hit_count == 0);
+	}
+	SECTION("coordinates cover the drawn part of the cell")
+	{
+		const int glyph = tuiGlyphCacheGetGlyph(glyph_cache, 'b');
+		const float* coordinates = &tuiGlyphCacheGetStpqpCoordinates(glyph_cache)[glyph * TUI_STPQP_COORDINATES_PER_GLYPH];
+		const int cells_per_page = (16 / cell_width) * (16 / cell_height);
+		const int cell = glyph % cells_per_page;
+		const int x = (cell % (16 / cell_width)) * cell_width;
+		const int y = (cell / (16 / cell_width)) * cell_height;
+		REQUIRE(coordinates[0] == Approx(x / 16.0f));
+		REQUIRE(coordinates[1] == Approx(y / 16.0f));
+		REQUIRE(coordinates[2] == Approx((x + 'b' % cell_width + 1) / 16.0f));
+		REQUIRE(coordinates[3] == Approx((y + cell_height) / 16.0f));
+		REQUIRE(coordinates[4] == (float)(glyph / cells_per_page));
+	}
+	SECTION("missing glyphs are not cached")
+	{
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 'X') == -1);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 'X') == -1);
+		REQUIRE(rasterizer.CallCount == 2);
+		int dirty_count = 0;
+		tuiGlyphCacheGetDirtyGlyphs(glyph_cache, &dirty_count);
+		REQUIRE(dirty_count == 0);
+	}
+	SECTION("empty glyphs share one blank slot")
+	{
+		const int space = tuiGlyphCacheGetGlyph(glyph_cache, 0x3000);
+		REQUIRE(space >= 0);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 0x3001) == space);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 0x3000) == space);
+		REQUIRE(rasterizer.CallCount == 2);
+		const int a = tuiGlyphCacheGetGlyph(glyph_cache, 'a');
+		REQUIRE(a != space);
+		int dirty_count = 0;
+		const int* dirty_glyphs = tuiGlyphCacheGetDirtyGlyphs(glyph_cache, &dirty_count);
+		REQUIRE(dirty_count == 2);
+		REQUIRE(dirty_glyphs[0] == space);
+		const uint8_t* dirty_pixels = tuiGlyphCacheGetDirtyGlyphPixels(glyph_cache);
+		for (int i = 0; i < cell_width * cell_height * 4; i++)
+		{
+			REQUIRE(dirty_pixels[i] == 0);
+		}
+		const float* coordinates = &tuiGlyphCacheGetStpqpCoordinates(glyph_cache)[space * TUI_STPQP_COORDINATES_PER_GLYPH];
+		REQUIRE(coordinates[2] - coordinates[0] == Approx((float)cell_width / 16.0f));
+		REQUIRE(coordinates[3] - coordinates[1] == Approx((float)cell_height / 16.0f));
+		tuiGlyphCacheClearDirtyGlyphs(glyph_cache);
+		// The blank slot is never evicted, so every other glyph fits in the remaining slots.
+		for (int i = 0; i < slot_count * 2; i++)
+		{
+			const int glyph = tuiGlyphCacheGetGlyph(glyph_cache, 100 + i);
+			REQUIRE(glyph >= 0);
+			REQUIRE(glyph != space);
+			tuiGlyphCacheClearDirtyGlyphs(glyph_cache);
+		}
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 0x3001) == space);
+	}
+	SECTION("the least recently used glyph is evicted")
+	{
+		std::vector<int> slots(slot_count);
+		for (int i = 0; i < slot_count; i++)
+		{
+			slots[i] = tuiGlyphCacheGetGlyph(glyph_cache, 100 + i);
+			REQUIRE(slots[i] == i);
+		}
+		tuiGlyphCacheClearDirtyGlyphs(glyph_cache);
+		// Touch the first glyph so the second becomes the least recently used.
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 100) == slots[0]);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 500) == slots[1]);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 501) == slots[2]);
+		size_t eviction_count = 0;
+		tuiGlyphCacheGetStatistics(glyph_cache, TUI_NULL, TUI_NULL, &eviction_count);
+		REQUIRE(eviction_count == 2);
+		const int call_count = rasterizer.CallCount;
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 100) == slots[0]);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 103) == slots[3]);
+		REQUIRE(rasterizer.CallCount == call_count);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 101) == slots[4]);
+		int dirty_count = 0;
+		const int* dirty_glyphs = tuiGlyphCacheGetDirtyGlyphs(glyph_cache, &dirty_count);
+		REQUIRE(dirty_count == 3);
+		REQUIRE(dirty_glyphs[0] == slots[1]);
+		REQUIRE(dirty_glyphs[1] == slots[2]);
+		REQUIRE(dirty_glyphs[2] == slots[4]);
+	}
+	SECTION("glyphs used since the last clear are never evicted")
+	{
+		for (int i = 0; i < slot_count; i++)
+		{
+			REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 100 + i) == i);
+		}
+		const int call_count = rasterizer.CallCount;
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 999) == -1);
+		REQUIRE(rasterizer.CallCount == call_count);
+		tuiGlyphCacheClearDirtyGlyphs(glyph_cache);
+		for (int i = 1; i < slot_count; i++)
+		{
+			REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 100 + i) == i);
+		}
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 999) == 0);
+		REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 998) == -1);
+	}
+	SECTION("lookups stay consistent through many evictions")
+	{
+		std::vector<uint32_t> slot_codepoints(slot_count, 0);
+		uint32_t state = 7;
+		for (int frame = 0; frame < 200; frame++)
+		{
+			for (int i = 0; i < 6; i++)
+			{
+				state = state * 1103515245u + 12345u;
+				const uint32_t codepoint = 1 + (state >> 16) % 40;
+				const int slot = tuiGlyphCacheGetGlyph(glyph_cache, codepoint);
+				REQUIRE(slot >= 0);
+				REQUIRE(slot < slot_count);
+				if (slot_codepoints[slot] != codepoint)
+				{
+					for (int other = 0; other < slot_count; other++)
+					{
+						REQUIRE((other == slot || slot_codepoints[other] != codepoint));
+					}
+					slot_codepoints[slot] = codepoint;
+				}
+			}
+			tuiGlyphCacheClearDirtyGlyphs(glyph_cache);
+		}
+		size_t hit_count, miss_count, eviction_count;
+		tuiGlyphCacheGetStatistics(glyph_cache, &hit_count, &miss_count, &eviction_count);
+		REQUIRE(hit_count + miss_count == 1200);
+		REQUIRE(miss_count == (size_t)rasterizer.CallCount);
+		REQUIRE(eviction_count == miss_count - slot_count);
+	}
+	tuiGlyphCacheDestroy(glyph_cache);
+}
+TEST_CASE("tuiGlyphCacheGetDirtyGlyphPixels single channel")
+{
+	const int cell_width = 4;
+	const int cell_height = 8;
+	TestRasterizer rasterizer = { 0, 0xFFFFFFFF, 0xFFFFFFFF };
+	TuiGlyphCache glyph_cache = TUI_NULL;
+	REQUIRE(tuiGlyphCacheCreate(&glyph_cache, 16, 16, 1, cell_width, cell_height, 1, rasterizeTestGlyph, &rasterizer) == TUI_RESULT_OK);
+	REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 'a') >= 0);
+	REQUIRE(tuiGlyphCacheGetGlyph(glyph_cache, 'b') >= 0);
+	const uint8_t* dirty_pixels = tuiGlyphCacheGetDirtyGlyphPixels(glyph_cache);
+	const size_t cell_size = cell_width * cell_height;
+	for (int i = 0; i < cell_width * cell_height; i++)
+	{
+		REQUIRE(dirty_pixels[i] == i + 1);
+		REQUIRE(dirty_pixels[cell_size + i] == i + 1);
+	}
+	tuiGlyphCacheDestroy(glyph_cache);
+}
\ No newline at end of file
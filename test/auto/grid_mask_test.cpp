@@ -0,0 +1,62 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <catch2/catch.hpp>
+
+
+TEST_CASE("tuiGridMaskCreate")
+{
+	TuiGridMask grid_mask = TUI_NULL;
+	REQUIRE(tuiGridMaskCreate(&grid_mask, 0, 10) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGridMaskCreate(&grid_mask, 10, -1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiGridMaskCreate(&grid_mask, 10, 5) == TUI_RESULT_OK);
+
+	int width = 0;
+	int height = 0;
+	tuiGridMaskGetDimensions(grid_mask, &width, &height);
+	REQUIRE(width == 10);
+	REQUIRE(height == 5);
+	REQUIRE(!tuiGridMaskGet(grid_mask, 0, 0));
+	tuiGridMaskDestroy(grid_mask);
+}
+
+TEST_CASE("tuiGridMaskSet")
+{
+	TuiGridMask grid_mask = TUI_NULL;
+	REQUIRE(tuiGridMaskCreate(&grid_mask, 4, 4) == TUI_RESULT_OK);
+	tuiGridMaskSet(grid_mask, 1, 2, TUI_TRUE);
+	tuiGridMaskSet(grid_mask, -1, 2, TUI_TRUE);
+	tuiGridMaskSet(grid_mask, 4, 0, TUI_TRUE);
+	REQUIRE(tuiGridMaskGet(grid_mask, 1, 2));
+	REQUIRE(tuiGridMaskGetData(grid_mask)[2 * 4 + 1] == 1);
+	REQUIRE(!tuiGridMaskGet(grid_mask, -1, 2));
+	REQUIRE(!tuiGridMaskGet(grid_mask, 4, 0));
+
+	tuiGridMaskClear(grid_mask, TUI_TRUE);
+	REQUIRE(tuiGridMaskGet(grid_mask, 3, 3));
+	tuiGridMaskClear(grid_mask, TUI_FALSE);
+	REQUIRE(!tuiGridMaskGet(grid_mask, 1, 2));
+	tuiGridMaskDestroy(grid_mask);
+}
+
+TEST_CASE("tuiGridMaskSetCompositeShape")
+{
+	TuiGridMask grid_mask = TUI_NULL;
+	REQUIRE(tuiGridMaskCreate(&grid_mask, 8, 8) == TUI_RESULT_OK);
+	const TuiShape shapes[2] = { tuiShapeRect(tuiRect(-2, -2, 6, 6)), tuiShapeRect(tuiRect(1, 1, 2, 2)) };
+	const TuiShapeOperation operations[1] = { TUI_SHAPE_OPERATION_DIFFERENCE };
+	tuiGridMaskSetCompositeShape(grid_mask, tuiCompositeShape(shapes, operations, 2), TUI_TRUE);
+
+	int set_count = 0;
+	for (int y = 0; y < 8; y++)
+	{
+		for (int x = 0; x < 8; x++)
+		{
+			set_count += tuiGridMaskGet(grid_mask, x, y);
+		}
+	}
+	REQUIRE(set_count == 12);
+	REQUIRE(tuiGridMaskGet(grid_mask, 0, 0));
+	REQUIRE(!tuiGridMaskGet(grid_mask, 1, 1));
+	REQUIRE(!tuiGridMaskGet(grid_mask, 4, 0));
+	tuiGridMaskDestroy(grid_mask);
+}
\ No newline at end of file
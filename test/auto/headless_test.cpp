@@ -0,0 +1,49 @@
+#include <TUIC/tuic.h>
+#include <catch2/catch.hpp>
+
+
+TEST_CASE("tuiSetHeadless")
+{
+	REQUIRE(tuiIsHeadless() == TUI_FALSE);
+	const TuiResult result = tuiSetHeadless(TUI_TRUE);
+	if (result == TUI_RESULT_ERROR_UNSUPPORTED_OPERATION)
+	{
+		// Built against a GLFW without the null platform, so the setting is left off.
+		REQUIRE(tuiIsHeadless() == TUI_FALSE);
+		return;
+	}
+	REQUIRE(result == TUI_RESULT_OK);
+	// The setting is reported as requested, before TUIC is initialized.
+	REQUIRE(tuiIsHeadless() == TUI_TRUE);
+
+	if (tuiInit() == TUI_TRUE)
+	{
+		REQUIRE(tuiIsHeadless() == TUI_TRUE);
+		REQUIRE(tuiSetHeadless(TUI_FALSE) == TUI_RESULT_ERROR_UNSUPPORTED_OPERATION);
+		// Panels draw and read back through the offscreen context.
+		TuiPanel panel = TUI_NULL;
+		REQUIRE(tuiPanelCreate(&panel, 4, 4) == TUI_RESULT_OK);
+		REQUIRE(tuiPanelClearColor(panel, 255, 0, 0, 255) == TUI_RESULT_OK);
+		uint8_t* pixels = TUI_NULL;
+		int pixel_width = 0;
+		int pixel_height = 0;
+		REQUIRE(tuiPanelGetPixels(panel, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+		REQUIRE(pixel_width == 4);
+		REQUIRE(pixel_height == 4);
+		REQUIRE(pixels[0] == 255);
+		REQUIRE(pixels[1] == 0);
+		REQUIRE(pixels[2] == 0);
+		tuiFree(pixels);
+		tuiPanelDestroy(panel);
+		tuiTerminate();
+	}
+	else
+	{
+		// Without an EGL or OSMesa driver the headless context can not be created, and the failed initialization leaves the setting as it was.
+		WARN("Headless initialization failed, no EGL or OSMesa driver is available.");
+		REQUIRE(tuiIsHeadless() == TUI_TRUE);
+	}
+
+	REQUIRE(tuiSetHeadless(TUI_FALSE) == TUI_RESULT_OK);
+	REQUIRE(tuiIsHeadless() == TUI_FALSE);
+}
\ No newline at end of file
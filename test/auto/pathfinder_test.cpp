@@ -0,0 +1,237 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+
+
+static void fillRandomWalls(TuiGridMask blocking_mask, const int width, const int height, unsigned int seed, const int wall_chance)
+{
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			seed = seed * 1103515245u + 12345u;
+			tuiGridMaskSet(blocking_mask, x, y, (int)((seed >> 16) % 100) < wall_chance);
+		}
+	}
+}
+
+static bool isConnectedPath(const std::vector<TuiPoint2>& path, TuiGridMask blocking_mask, const bool allow_diagonal)
+{
+	for (size_t i = 0; i < path.size(); i++)
+	{
+		if (tuiGridMaskGet(blocking_mask, path[i].x, path[i].y))
+		{
+			return false;
+		}
+		if (i == 0)
+		{
+			continue;
+		}
+		const int dx = path[i].x - path[i - 1].x;
+		const int dy = path[i].y - path[i - 1].y;
+		if (abs(dx) > 1 || abs(dy) > 1 || (dx == 0 && dy == 0) || (!allow_diagonal && dx != 0 && dy != 0))
+		{
+			return false;
+		}
+		if (dx != 0 && dy != 0 && (tuiGridMaskGet(blocking_mask, path[i - 1].x + dx, path[i - 1].y) || tuiGridMaskGet(blocking_mask, path[i - 1].x, path[i - 1].y + dy)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("tuiPathfinderCreate")
+{
+	TuiPathfinder pathfinder = TUI_NULL;
+	REQUIRE(tuiPathfinderCreate(&pathfinder, 0, 10) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiPathfinderCreate(&pathfinder, 100000, 100000) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiPathfinderCreate(&pathfinder, 12, 7) == TUI_RESULT_OK);
+	int width = 0;
+	int height = 0;
+	tuiPathfinderGetDimensions(pathfinder, &width, &height);
+	REQUIRE(width == 12);
+	REQUIRE(height == 7);
+	REQUIRE(tuiPathfinderGetLastPathCost(pathfinder) == TUI_PATH_UNREACHABLE);
+	tuiPathfinderDestroy(pathfinder);
+}
+
+TEST_CASE("tuiPathfinderFindPath")
+{
+	TuiPathfinder pathfinder = TUI_NULL;
+	TuiGridMask blocking_mask = TUI_NULL;
+	REQUIRE(tuiPathfinderCreate(&pathfinder, 10, 10) == TUI_RESULT_OK);
+	REQUIRE(tuiGridMaskCreate(&blocking_mask, 10, 10) == TUI_RESULT_OK);
+	TuiPoint2 path[64];
+	int path_length = -1;
+
+	SECTION("open grid")
+	{
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(1, 1), tuiPoint2(6, 3), TUI_TRUE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 6);
+		REQUIRE(tuiPathfinderGetLastPathCost(pathfinder) == 2 * TUI_PATH_DIAGONAL_STEP_COST + 3 * TUI_PATH_ORTHOGONAL_STEP_COST);
+		REQUIRE(path[0].x == 1);
+		REQUIRE(path[0].y == 1);
+		REQUIRE(path[5].x == 6);
+		REQUIRE(path[5].y == 3);
+
+		REQUIRE(tuiPathfinderFindPath(pathfinder, TUI_NULL, TUI_NULL, tuiPoint2(1, 1), tuiPoint2(6, 3), TUI_FALSE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 8);
+		REQUIRE(tuiPathfinderGetLastPathCost(pathfinder) == 7 * TUI_PATH_ORTHOGONAL_STEP_COST);
+
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(4, 4), tuiPoint2(4, 4), TUI_TRUE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 1);
+		REQUIRE(tuiPathfinderGetLastPathCost(pathfinder) == 0);
+	}
+	SECTION("walls")
+	{
+		for (int y = 0; y < 9; y++)
+		{
+			tuiGridMaskSet(blocking_mask, 5, y, TUI_TRUE);
+		}
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(0, 0), tuiPoint2(9, 0), TUI_TRUE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length > 0);
+		REQUIRE(isConnectedPath(std::vector<TuiPoint2>(path, path + path_length), blocking_mask, true));
+
+		tuiGridMaskSet(blocking_mask, 5, 9, TUI_TRUE);
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(0, 0), tuiPoint2(9, 0), TUI_TRUE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 0);
+		REQUIRE(tuiPathfinderGetLastPathCost(pathfinder) == TUI_PATH_UNREACHABLE);
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(5, 5), tuiPoint2(9, 0), TUI_TRUE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 0);
+	}
+	SECTION("corners")
+	{
+		tuiGridMaskSet(blocking_mask, 1, 0, TUI_TRUE);
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(0, 0), tuiPoint2(1, 1), TUI_TRUE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 3);
+	}
+	SECTION("tile costs")
+	{
+		std::vector<uint8_t> tile_costs(100, 1);
+		for (int y = 0; y < 9; y++)
+		{
+			tile_costs[y * 10 + 5] = 9;
+		}
+		tile_costs[9 * 10 + 5] = 0;
+		REQUIRE(tuiPathfinderFindPath(pathfinder, TUI_NULL, tile_costs.data(), tuiPoint2(3, 9), tuiPoint2(7, 9), TUI_FALSE, path, 64, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 7);
+		REQUIRE(tuiPathfinderGetLastPathCost(pathfinder) == 14 * TUI_PATH_ORTHOGONAL_STEP_COST);
+	}
+	SECTION("capacity")
+	{
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(0, 0), tuiPoint2(9, 0), TUI_TRUE, TUI_NULL, 0, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 10);
+		path[3] = tuiPoint2(-1, -1);
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(0, 0), tuiPoint2(9, 0), TUI_TRUE, path, 3, &path_length) == TUI_RESULT_OK);
+		REQUIRE(path_length == 10);
+		REQUIRE(path[2].x == 2);
+		REQUIRE(path[3].x == -1);
+		REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, tuiPoint2(0, 0), tuiPoint2(9, 0), TUI_TRUE, path, -1, &path_length) == TUI_RESULT_ERROR_INVALID_VALUE);
+	}
+
+	tuiGridMaskDestroy(blocking_mask);
+	tuiPathfinderDestroy(pathfinder);
+}
+
+TEST_CASE("tuiPathfinderJumpPointSearch")
+{
+	const int width = 40;
+	const int height = 25;
+	TuiPathfinder pathfinder = TUI_NULL;
+	TuiGridMask blocking_mask = TUI_NULL;
+	REQUIRE(tuiPathfinderCreate(&pathfinder, width, height) == TUI_RESULT_OK);
+	REQUIRE(tuiGridMaskCreate(&blocking_mask, width, height) == TUI_RESULT_OK);
+	std::vector<TuiPoint2> path(width * height);
+	for (unsigned int seed = 1; seed <= 20; seed++)
+	{
+		fillRandomWalls(blocking_mask, width, height, seed, 30);
+		for (int query = 0; query < 20; query++)
+		{
+			const TuiPoint2 start = tuiPoint2((seed * 7 + query * 13) % width, (seed * 3 + query * 5) % height);
+			const TuiPoint2 goal = tuiPoint2((seed * 11 + query * 17) % width, (seed * 19 + query * 23) % height);
+			int a_star_length = 0;
+			REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, start, goal, TUI_TRUE, TUI_NULL, 0, &a_star_length) == TUI_RESULT_OK);
+			const int32_t a_star_cost = tuiPathfinderGetLastPathCost(pathfinder);
+			int jump_length = 0;
+			REQUIRE(tuiPathfinderJumpPointSearch(pathfinder, blocking_mask, start, goal, path.data(), (int)path.size(), &jump_length) == TUI_RESULT_OK);
+			REQUIRE(tuiPathfinderGetLastPathCost(pathfinder) == a_star_cost);
+			REQUIRE((jump_length == 0) == (a_star_length == 0));
+			if (jump_length > 0)
+			{
+				path.resize(jump_length);
+				REQUIRE(isConnectedPath(path, blocking_mask, true));
+				REQUIRE(path.front().x == start.x);
+				REQUIRE(path.front().y == start.y);
+				REQUIRE(path.back().x == goal.x);
+				REQUIRE(path.back().y == goal.y);
+				path.resize(width * height);
+			}
+		}
+	}
+	tuiGridMaskDestroy(blocking_mask);
+	tuiPathfinderDestroy(pathfinder);
+}
+
+TEST_CASE("tuiPathfinderComputeDistanceMap")
+{
+	const int width = 30;
+	const int height = 20;
+	TuiPathfinder pathfinder = TUI_NULL;
+	TuiGridMask blocking_mask = TUI_NULL;
+	REQUIRE(tuiPathfinderCreate(&pathfinder, width, height) == TUI_RESULT_OK);
+	REQUIRE(tuiGridMaskCreate(&blocking_mask, width, height) == TUI_RESULT_OK);
+	fillRandomWalls(blocking_mask, width, height, 42, 25);
+	std::vector<uint8_t> tile_costs(width * height);
+	for (int i = 0; i < width * height; i++)
+	{
+		tile_costs[i] = (uint8_t)(1 + (i * 7) % 5);
+	}
+	const TuiPoint2 sources[2] = { tuiPoint2(3, 4), tuiPoint2(25, 15) };
+	tuiGridMaskSet(blocking_mask, sources[0].x, sources[0].y, TUI_FALSE);
+	tuiGridMaskSet(blocking_mask, sources[1].x, sources[1].y, TUI_FALSE);
+	std::vector<int32_t> distances(width * height);
+	REQUIRE(tuiPathfinderComputeDistanceMap(pathfinder, blocking_mask, tile_costs.data(), sources, 2, TUI_TRUE, distances.data()) == TUI_RESULT_OK);
+	REQUIRE(distances[sources[0].y * width + sources[0].x] == 0);
+	REQUIRE(distances[sources[1].y * width + sources[1].x] == 0);
+
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			const int32_t distance = distances[y * width + x];
+			if (tuiGridMaskGet(blocking_mask, x, y))
+			{
+				REQUIRE(distance == TUI_PATH_UNREACHABLE);
+				continue;
+			}
+			int32_t nearest_cost = TUI_PATH_UNREACHABLE;
+			for (const TuiPoint2 source : sources)
+			{
+				REQUIRE(tuiPathfinderFindPath(pathfinder, blocking_mask, tile_costs.data(), tuiPoint2(x, y), source, TUI_TRUE, TUI_NULL, 0, TUI_NULL) == TUI_RESULT_OK);
+				nearest_cost = std::min(nearest_cost, tuiPathfinderGetLastPathCost(pathfinder));
+			}
+			REQUIRE(distance == nearest_cost);
+			if (distance == TUI_PATH_UNREACHABLE)
+			{
+				continue;
+			}
+			TuiPoint2 point = tuiPoint2(x, y);
+			int32_t walked_cost = 0;
+			while (distances[point.y * width + point.x] != 0)
+			{
+				const TuiPoint2 next = tuiDistanceMapGetNextStep(distances.data(), tile_costs.data(), width, height, point, TUI_TRUE);
+				REQUIRE((next.x != point.x || next.y != point.y));
+				const int32_t step_cost = (next.x != point.x && next.y != point.y) ? TUI_PATH_DIAGONAL_STEP_COST : TUI_PATH_ORTHOGONAL_STEP_COST;
+				walked_cost += step_cost * tile_costs[next.y * width + next.x];
+				point = next;
+			}
+			REQUIRE(walked_cost == distance);
+		}
+	}
+
+	REQUIRE(tuiPathfinderComputeDistanceMap(pathfinder, blocking_mask, TUI_NULL, TUI_NULL, 1, TUI_TRUE, distances.data()) == TUI_RESULT_ERROR_INVALID_VALUE);
+	tuiGridMaskDestroy(blocking_mask);
+	tuiPathfinderDestroy(pathfinder);
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+
+
+static const TuiPoint2 kSquare[] = { { 0, 0 }, { 4, 0 }, { 4, 4 }, { 0, 4 } };
+static const TuiPoint2 kTriangle[] = { { 0, 0 }, { 8, 0 }, { 0, 8 } };
+static const TuiPoint2 kNotch[] = { { 0, 0 }, { 6, 0 }, { 6, 4 }, { 4, 4 }, { 3, 1 }, { 2, 4 }, { 0, 4 } };
+
+TEST_CASE("tuiPolygonGetBounds")
+{
+	{
+		const TuiPolygon polygon = tuiPolygon(kSquare, 4);
+		REQUIRE(tuiPolygonGetLeftX(polygon) == 0);
+		REQUIRE(tuiPolygonGetRightX(polygon) == 4);
+		REQUIRE(tuiPolygonGetTopY(polygon) == 0);
+		REQUIRE(tuiPolygonGetBottomY(polygon) == 4);
+		REQUIRE(tuiPolygonGetTileWidth(polygon) == 5);
+		REQUIRE(tuiPolygonGetTileHeight(polygon) == 5);
+	}
+
+	{
+		const TuiPolygon polygon = tuiPolygon(TUI_NULL, 0);
+		REQUIRE(tuiPolygonGetTileWidth(polygon) == 0);
+		REQUIRE(tuiPolygonGetTileHeight(polygon) == 0);
+	}
+}
+
+TEST_CASE("tuiPolygonIsDegenerate")
+{
+	REQUIRE(tuiPolygonIsDegenerate(tuiPolygon(TUI_NULL, 0)));
+	REQUIRE(tuiPolygonIsDegenerate(tuiPolygon(kSquare, 2)));
+	REQUIRE(!tuiPolygonIsDegenerate(tuiPolygon(kSquare, 4)));
+}
+
+TEST_CASE("tuiPolygonContainsPoint2")
+{
+	const TuiPolygon square = tuiPolygon(kSquare, 4);
+	REQUIRE(tuiPolygonContainsPoint2(square, tuiPoint2(0, 0)));
+	REQUIRE(tuiPolygonContainsPoint2(square, tuiPoint2(2, 2)));
+	REQUIRE(tuiPolygonContainsPoint2(square, tuiPoint2(4, 4)));
+	REQUIRE(!tuiPolygonContainsPoint2(square, tuiPoint2(5, 2)));
+	REQUIRE(!tuiPolygonContainsPoint2(square, tuiPoint2(-1, 0)));
+
+	const TuiPolygon notch = tuiPolygon(kNotch, 7);
+	REQUIRE(tuiPolygonContainsPoint2(notch, tuiPoint2(3, 0)));
+	REQUIRE(tuiPolygonContainsPoint2(notch, tuiPoint2(3, 1)));
+	REQUIRE(!tuiPolygonContainsPoint2(notch, tuiPoint2(3, 3)));
+	REQUIRE(tuiPolygonContainsPoint2(notch, tuiPoint2(1, 3)));
+	REQUIRE(tuiPolygonContainsPoint2(notch, tuiPoint2(5, 3)));
+}
+
+TEST_CASE("tuiPolygonContainsPoint2 with many edge crossings")
+{
+	// A comb of 40 teeth has 40 disjoint spans on the rows through its teeth.
+	const int tooth_count = 40;
+	std::vector<TuiPoint2> points;
+	for (int tooth_i = 0; tooth_i < tooth_count; tooth_i++)
+	{
+		points.push_back(tuiPoint2(tooth_i * 4, 0));
+		points.push_back(tuiPoint2(tooth_i * 4 + 2, 0));
+		points.push_back(tuiPoint2(tooth_i * 4 + 2, 5));
+		points.push_back(tuiPoint2(tooth_i * 4 + 4, 5));
+	}
+	points.push_back(tuiPoint2(tooth_count * 4, 10));
+	points.push_back(tuiPoint2(0, 10));
+	const TuiPolygon comb = tuiPolygon(points.data(), (int)points.size());
+	REQUIRE(tuiPolygonContainsPoint2(comb, tuiPoint2(1, 2)));
+	REQUIRE(tuiPolygonContainsPoint2(comb, tuiPoint2(tooth_count * 4 - 3, 2)));
+	REQUIRE(!tuiPolygonContainsPoint2(comb, tuiPoint2(tooth_count * 4 + 1, 2)));
+	REQUIRE(tuiPolygonContainsPoint2(comb, tuiPoint2(tooth_count * 4 - 1, 8)));
+	for (int tooth_i = 0; tooth_i + 1 < tooth_count; tooth_i++)
+	{
+		REQUIRE(!tuiPolygonContainsPoint2(comb, tuiPoint2(tooth_i * 4 + 3, 2)));
+	}
+	int span_count = 0;
+	TUI_POLYGON_ITERATE_SPANS(comb, it)
+	{
+		if (tuiPolygonItGetSpan(it).y == 2)
+		{
+			span_count++;
+		}
+	}
+	REQUIRE(span_count == tooth_count);
+}
+
+TEST_CASE("tuiPolygonCreate")
+{
+	std::vector<TuiPoint2> points(TUI_POLYGON_MAX_POINT_COUNT + 1, tuiPoint2(0, 0));
+	TuiPolygon polygon = tuiPolygon(TUI_NULL, 0);
+	REQUIRE(tuiPolygonCreate(&polygon, kSquare, 4) == TUI_RESULT_OK);
+	REQUIRE(polygon.points == kSquare);
+	REQUIRE(polygon.point_count == 4);
+	REQUIRE(tuiPolygonCreate(&polygon, TUI_NULL, 4) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiPolygonCreate(&polygon, kSquare, 0) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiPolygonCreate(&polygon, points.data(), (int)points.size()) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiPolygonCreate(&polygon, points.data(), TUI_POLYGON_MAX_POINT_COUNT) == TUI_RESULT_OK);
+	REQUIRE(!tuiPolygonContainsPoint2(tuiPolygon(points.data(), (int)points.size()), tuiPoint2(0, 0)));
+}
+
+TEST_CASE("tuiPolygonContainsRect")
+{
+	const TuiPolygon triangle = tuiPolygon(kTriangle, 3);
+	REQUIRE(tuiPolygonContainsRect(triangle, tuiRect(0, 0, 4, 4)));
+	REQUIRE(!tuiPolygonContainsRect(triangle, tuiRect(4, 4, 4, 4)));
+}
+
+TEST_CASE("tuiPolygonIntersects")
+{
+	const TuiPolygon square = tuiPolygon(kSquare, 4);
+	const TuiPolygon triangle = tuiPolygon(kTriangle, 3);
+	REQUIRE(tuiPolygonIntersectsRect(square, tuiRect(3, 3, 4, 4)));
+	REQUIRE(!tuiPolygonIntersectsRect(square, tuiRect(10, 10, 4, 4)));
+	REQUIRE(tuiPolygonIntersectsLine(square, tuiLine(-5, 2, 10, 2)));
+	REQUIRE(!tuiPolygonIntersectsLine(square, tuiLine(-5, 8, 10, 8)));
+	REQUIRE(tuiPolygonIntersectsCircle(triangle, tuiCircle(10, 0, 3.0f)));
+	REQUIRE(!tuiPolygonIntersectsCircle(triangle, tuiCircle(20, 20, 3.0f)));
+	REQUIRE(tuiPolygonIntersectsPolygon(square, triangle));
+}
+
+TEST_CASE("tuiPolygonIt")
+{
+	{
+		int count = 0;
+		TUI_POLYGON_ITERATE(tuiPolygon(kSquare, 4), it)
+		{
+			REQUIRE(tuiPolygonContainsPoint2(tuiPolygon(kSquare, 4), tuiPolygonItGetPoint2(it)));
+			count++;
+		}
+		REQUIRE(count == 25);
+	}
+
+	{
+		int count = 0;
+		int previous_y = -1;
+		TUI_POLYGON_ITERATE_SPANS(tuiPolygon(kNotch, 7), it)
+		{
+			const TuiSpan span = tuiPolygonItGetSpan(it);
+			REQUIRE(span.y >= previous_y);
+			REQUIRE(span.left_x <= span.right_x);
+			previous_y = span.y;
+			count += span.right_x - span.left_x + 1;
+		}
+
+		int point_count = 0;
+		TUI_POLYGON_ITERATE(tuiPolygon(kNotch, 7), it)
+		{
+			point_count++;
+		}
+		REQUIRE(count == point_count);
+	}
+
+	{
+		int count = 0;
+		TUI_POLYGON_ITERATE(tuiPolygon(TUI_NULL, 0), it)
+		{
+			count++;
+		}
+		REQUIRE(count == 0);
+	}
+}
\ No newline at end of file
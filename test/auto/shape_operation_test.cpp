@@ -0,0 +1,18 @@
+#include <TUIC/tuic.h>
+#include <string>
+#include <catch2/catch.hpp>
+#define TO_STRING(value) #value
+
+TEST_CASE("tuiShapeOperationToString") {
+    REQUIRE(std::string(tuiShapeOperationToString(TUI_SHAPE_OPERATION_UNION)) == std::string(TO_STRING(TUI_SHAPE_OPERATION_UNION)));
+    REQUIRE(std::string(tuiShapeOperationToString(TUI_SHAPE_OPERATION_INTERSECTION)) == std::string(TO_STRING(TUI_SHAPE_OPERATION_INTERSECTION)));
+    REQUIRE(std::string(tuiShapeOperationToString(TUI_SHAPE_OPERATION_DIFFERENCE)) == std::string(TO_STRING(TUI_SHAPE_OPERATION_DIFFERENCE)));
+    REQUIRE(std::string(tuiShapeOperationToString(TUI_SHAPE_OPERATION_XOR)) == std::string(TO_STRING(TUI_SHAPE_OPERATION_XOR)));
+}
+
+TEST_CASE("tuiStringToShapeOperation") {
+    REQUIRE(tuiStringToShapeOperation(TO_STRING(TUI_SHAPE_OPERATION_UNION)) == TUI_SHAPE_OPERATION_UNION);
+    REQUIRE(tuiStringToShapeOperation(TO_STRING(TUI_SHAPE_OPERATION_INTERSECTION)) == TUI_SHAPE_OPERATION_INTERSECTION);
+    REQUIRE(tuiStringToShapeOperation(TO_STRING(TUI_SHAPE_OPERATION_DIFFERENCE)) == TUI_SHAPE_OPERATION_DIFFERENCE);
+    REQUIRE(tuiStringToShapeOperation(TO_STRING(TUI_SHAPE_OPERATION_XOR)) == TUI_SHAPE_OPERATION_XOR);
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include <TUIC/tuic.h>
+#include <catch2/catch.hpp>
+
+TEST_CASE("tuiSetGraphicsBackend")
+{
+	REQUIRE(tuiGetGraphicsBackend() == TUI_GRAPHICS_BACKEND_OPENGL33);
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_INVALID) == TUI_RESULT_ERROR_INVALID_ENUM);
+	REQUIRE(tuiSetGraphicsBackend((TuiGraphicsBackend)(TUI_GRAPHICS_BACKEND_LAST + 1)) == TUI_RESULT_ERROR_INVALID_ENUM);
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiGetGraphicsBackend() == TUI_GRAPHICS_BACKEND_SOFTWARE);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_ERROR_UNSUPPORTED_OPERATION);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
+
+TEST_CASE("Software backend panel drawing")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	// A 4x4 coverage image of 2x2 cells, where every pixel of cell k has coverage 60 * k + 10.
+	uint8_t atlas_pixels[16];
+	for (int y = 0; y < 4; y++)
+	{
+		for (int x = 0; x < 4; x++)
+		{
+			atlas_pixels[y * 4 + x] = (uint8_t)(((y / 2) * 2 + x / 2) * 60 + 10);
+		}
+	}
+	TuiAtlas atlas = TUI_NULL;
+	REQUIRE(tuiAtlasCreateGridFromImage(&atlas, 4, 4, 1, atlas_pixels, 2, 2) == TUI_RESULT_OK);
+	TuiPanel panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&panel, 8, 8) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelClearColor(panel, 0, 0, 0, 255) == TUI_RESULT_OK);
+	TuiConsole console = TUI_NULL;
+	REQUIRE(tuiConsoleCreatePixelDimensions(&console, 4, 4, 1.0f, 2, 2, TUI_TRUE) == TUI_RESULT_OK);
+	REQUIRE(tuiConsolePushTileGrid(console, 3, 1, 1, 255, 0, 0, 255, 0, 0, 255, 255) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelDrawConsole(panel, atlas, console) == TUI_RESULT_OK);
+
+	uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	REQUIRE(tuiPanelGetPixels(panel, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	REQUIRE(pixel_width == 8);
+	REQUIRE(pixel_height == 8);
+	// The tile covers the bottom right quarter, mixing its red foreground over its blue background by the coverage of cell 3.
+	const uint8_t* tile_pixel = &pixels[(6 * 8 + 6) * 4];
+	REQUIRE(tile_pixel[0] == 190);
+	REQUIRE(tile_pixel[1] == 0);
+	REQUIRE(tile_pixel[2] == 65);
+	REQUIRE(tile_pixel[3] == 255);
+	const uint8_t* clear_pixel = &pixels[0];
+	REQUIRE(clear_pixel[0] == 0);
+	REQUIRE(clear_pixel[2] == 0);
+	REQUIRE(clear_pixel[3] == 255);
+
+	// A texture drawn with its rectangle reversed is mirrored, and blends by its alpha.
+	uint8_t texture_pixels[8] = { 255, 0, 0, 255, 255, 255, 255, 128 };
+	TuiTexture texture = TUI_NULL;
+	REQUIRE(tuiTextureCreate(&texture, texture_pixels, 2, 1) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelClearColor(panel, 0, 0, 0, 255) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelDrawTextureTransformed(panel, texture, 8, 0, 0, 8) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelGetPixels(panel, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	REQUIRE(pixels[0] == 128);
+	REQUIRE(pixels[1] == 128);
+	REQUIRE(pixels[(7 * 8 + 7) * 4 + 0] == 255);
+	REQUIRE(pixels[(7 * 8 + 7) * 4 + 1] == 0);
+
+	tuiFree(pixels);
+	tuiTextureDestroy(texture);
+	tuiConsoleDestroy(console);
+	tuiPanelDestroy(panel);
+	tuiAtlasDestroy(atlas);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
+
+TEST_CASE("tuiPanelDrawConsoles")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	uint8_t atlas_pixels[16];
+	for (int pixel_i = 0; pixel_i < 16; pixel_i++)
+	{
+		atlas_pixels[pixel_i] = 255;
+	}
+	TuiAtlas atlas = TUI_NULL;
+	REQUIRE(tuiAtlasCreateGridFromImage(&atlas, 4, 4, 1, atlas_pixels, 2, 2) == TUI_RESULT_OK);
+	TuiPanel panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&panel, 8, 4) == TUI_RESULT_OK);
+	TuiConsole red_console = TUI_NULL;
+	REQUIRE(tuiConsoleCreatePixelDimensions(&red_console, 2, 2, 1.0f, 2, 2, TUI_TRUE) == TUI_RESULT_OK);
+	REQUIRE(tuiConsolePushTileGrid(red_console, 0, 0, 0, 255, 0, 0, 255, 0, 0, 0, 255) == TUI_RESULT_OK);
+	TuiConsole green_console = TUI_NULL;
+	REQUIRE(tuiConsoleCreatePixelDimensions(&green_console, 2, 2, 1.0f, 2, 2, TUI_TRUE) == TUI_RESULT_OK);
+	REQUIRE(tuiConsolePushTileGrid(green_console, 0, 0, 0, 0, 255, 0, 255, 0, 0, 0, 255) == TUI_RESULT_OK);
+
+	REQUIRE(tuiPanelDrawConsoles(panel, TUI_NULL, -1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiPanelDrawConsoles(panel, TUI_NULL, TUI_PANEL_MAX_CONSOLE_DRAWS + 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiPanelDrawConsoles(panel, TUI_NULL, 0) == TUI_RESULT_OK);
+
+	// Each console fills its own half of the panel, and the later draw covers the earlier one where they overlap.
+	REQUIRE(tuiPanelClearColor(panel, 0, 0, 0, 255) == TUI_RESULT_OK);
+	const TuiConsoleDraw draws[2] = {
+		{ red_console, atlas, 0, 6, 0, 4 },
+		{ green_console, atlas, 4, 8, 0, 4 },
+	};
+	REQUIRE(tuiPanelDrawConsoles(panel, draws, 2) == TUI_RESULT_OK);
+	uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	REQUIRE(tuiPanelGetPixels(panel, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	REQUIRE(pixels[(2 * 8 + 1) * 4 + 0] == 255);
+	REQUIRE(pixels[(2 * 8 + 1) * 4 + 1] == 0);
+	REQUIRE(pixels[(2 * 8 + 5) * 4 + 0] == 0);
+	REQUIRE(pixels[(2 * 8 + 5) * 4 + 1] == 255);
+
+	tuiFree(pixels);
+	tuiConsoleDestroy(green_console);
+	tuiConsoleDestroy(red_console);
+	tuiPanelDestroy(panel);
+	tuiAtlasDestroy(atlas);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
+
+TEST_CASE("tuiTextureUpdateRegion")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	uint8_t texture_pixels[4 * 4 * 4] = { 0 };
+	for (int pixel_i = 0; pixel_i < 16; pixel_i++)
+	{
+		texture_pixels[pixel_i * 4 + 3] = 255;
+	}
+	TuiTexture texture = TUI_NULL;
+	REQUIRE(tuiTextureCreate(&texture, texture_pixels, 4, 4) == TUI_RESULT_OK);
+	// A 2x2 region taken from a source 3 pixels wide, so each row is followed by one pixel that is not uploaded.
+	uint8_t region_pixels[3 * 2 * 4] = { 0 };
+	for (int pixel_i = 0; pixel_i < 6; pixel_i++)
+	{
+		region_pixels[pixel_i * 4 + 0] = (pixel_i % 3 == 2) ? 0 : 255;
+		region_pixels[pixel_i * 4 + 1] = (pixel_i % 3 == 2) ? 255 : 0;
+		region_pixels[pixel_i * 4 + 3] = 255;
+	}
+	REQUIRE(tuiTextureUpdateRegion(texture, region_pixels, 3, 3, 2, 2, 0) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiTextureUpdateRegion(texture, region_pixels, -1, 0, 2, 2, 0) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiTextureUpdateRegion(texture, region_pixels, 1, 1, 2, 2, 4) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiTextureUpdateRegion(texture, region_pixels, 1, 1, 2, 2, 13) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiTextureUpdateRegion(texture, region_pixels, 1, 1, 2, 2, 12) == TUI_RESULT_OK);
+
+	TuiPanel panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&panel, 4, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelClearColor(panel, 0, 0, 0, 255) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelDrawTexture(panel, texture) == TUI_RESULT_OK);
+	uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	REQUIRE(tuiPanelGetPixels(panel, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	for (int y = 0; y < 4; y++)
+	{
+		for (int x = 0; x < 4; x++)
+		{
+			const bool in_region = x >= 1 && x <= 2 && y >= 1 && y <= 2;
+			REQUIRE(pixels[(y * 4 + x) * 4 + 0] == (in_region ? 255 : 0));
+			REQUIRE(pixels[(y * 4 + x) * 4 + 1] == 0);
+		}
+	}
+
+	tuiFree(pixels);
+	tuiPanelDestroy(panel);
+	tuiTextureDestroy(texture);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
+
+TEST_CASE("Software backend pixel readback and unsupported operations")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	TuiPanel panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&panel, 3, 2) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelClearColor(panel, 10, 20, 30, 255) == TUI_RESULT_OK);
+
+	TuiPixelReadback pixel_readback = TUI_NULL;
+	REQUIRE(tuiPixelReadbackCreate(&pixel_readback) == TUI_RESULT_OK);
+	REQUIRE(!tuiPixelReadbackIsReady(pixel_readback));
+	REQUIRE(tuiPixelReadbackCapturePanel(pixel_readback, panel) == TUI_RESULT_OK);
+	REQUIRE(tuiPixelReadbackIsReady(pixel_readback));
+	const uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	REQUIRE(tuiPixelReadbackMapPixels(pixel_readback, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	REQUIRE(pixel_width == 3);
+	REQUIRE(pixel_height == 2);
+	for (int pixel_i = 0; pixel_i < 3 * 2; pixel_i++)
+	{
+		REQUIRE(pixels[pixel_i * 4 + 0] == 10);
+		REQUIRE(pixels[pixel_i * 4 + 1] == 20);
+		REQUIRE(pixels[pixel_i * 4 + 2] == 30);
+	}
+	REQUIRE(tuiPixelReadbackCapturePanel(pixel_readback, panel) == TUI_RESULT_ERROR_INVALID_VALUE);
+	tuiPixelReadbackUnmapPixels(pixel_readback);
+	tuiPixelReadbackDestroy(pixel_readback);
+
+	TuiFrameStats stats;
+	REQUIRE(tuiSetFrameTimingEnabled(TUI_TRUE) == TUI_RESULT_ERROR_UNSUPPORTED_OPERATION);
+	REQUIRE(!tuiIsFrameTimingEnabled());
+	REQUIRE(tuiGetFrameStats(&stats) == TUI_RESULT_ERROR_UNSUPPORTED_OPERATION);
+	REQUIRE(tuiSetGraphicsValidation(TUI_GRAPHICS_VALIDATION_OFF) == TUI_RESULT_ERROR_UNSUPPORTED_OPERATION);
+	size_t issued_call_count = 1;
+	size_t skipped_call_count = 1;
+	tuiGetGraphicsStateStatistics(&issued_call_count, &skipped_call_count);
+	REQUIRE(issued_call_count == 0);
+	REQUIRE(skipped_call_count == 0);
+
+	tuiPanelDestroy(panel);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
\ No newline at end of file
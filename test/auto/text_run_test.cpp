@@ -0,0 +1,171 @@
+#include <TUIC/tuic.h>
+#include <vector>
+#include <catch2/catch.hpp>
+
+
+// A software backend atlas of 4 glyphs in 2x2 cells, with full coverage so every tile shows its foreground.
+static TuiAtlas createTextAtlas()
+{
+	const std::vector<uint8_t> atlas_pixels(4 * 4, 255);
+	TuiAtlas atlas = TUI_NULL;
+	REQUIRE(tuiAtlasCreateGridFromImage(&atlas, 4, 4, 1, atlas_pixels.data(), 2, 2) == TUI_RESULT_OK);
+	return atlas;
+}
+
+static void setTextMetrics(TuiAtlas atlas)
+{
+	TuiGlyphMetrics glyph_metrics[4];
+	for (int glyph_i = 0; glyph_i < 4; glyph_i++)
+	{
+		glyph_metrics[glyph_i].advance = 3 + glyph_i;
+		glyph_metrics[glyph_i].bearing_x = 0;
+		glyph_metrics[glyph_i].bearing_y = 2;
+		glyph_metrics[glyph_i].width = 2;
+		glyph_metrics[glyph_i].height = 2;
+	}
+	// Glyph 3 only advances the pen, like a space.
+	glyph_metrics[3].width = 0;
+	glyph_metrics[3].height = 0;
+	REQUIRE(tuiAtlasSetGlyphMetrics(atlas, glyph_metrics) == TUI_RESULT_OK);
+}
+
+TEST_CASE("tuiAtlasMeasureGlyphs")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	TuiAtlas atlas = createTextAtlas();
+	const uint16_t glyphs[4] = { 0, 1, 2, 3 };
+	// Grid atlases without metrics measure as monospace cells.
+	REQUIRE(tuiAtlasMeasureGlyphs(atlas, glyphs, 4) == 8);
+	REQUIRE(tuiAtlasMeasureGlyphs(atlas, glyphs, 0) == 0);
+
+	setTextMetrics(atlas);
+	REQUIRE(tuiAtlasMeasureGlyphs(atlas, glyphs, 4) == 3 + 4 + 5 + 6);
+
+	// Pairs are given out of order, and a pair given twice keeps its last adjustment.
+	const TuiKerningPair kerning_pairs[4] = {
+		{ 2, 3, 2 },
+		{ 0, 1, -1 },
+		{ 1, 2, 5 },
+		{ 1, 2, -2 },
+	};
+	REQUIRE(tuiAtlasSetKerningPairs(atlas, kerning_pairs, -1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	const TuiKerningPair out_of_range_pair = { 0, 4, 1 };
+	REQUIRE(tuiAtlasSetKerningPairs(atlas, &out_of_range_pair, 1) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiAtlasSetKerningPairs(atlas, kerning_pairs, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiAtlasGetKerning(atlas, 0, 1) == -1);
+	REQUIRE(tuiAtlasGetKerning(atlas, 1, 2) == -2);
+	REQUIRE(tuiAtlasGetKerning(atlas, 2, 3) == 2);
+	REQUIRE(tuiAtlasGetKerning(atlas, 1, 0) == 0);
+	REQUIRE(tuiAtlasGetKerning(atlas, 0, 0) == 0);
+	REQUIRE(tuiAtlasGetKerning(atlas, 3, 3) == 0);
+	REQUIRE(tuiAtlasMeasureGlyphs(atlas, glyphs, 4) == 3 + 4 + 5 + 6 - 1 - 2 + 2);
+	// The kerning after the last glyph of a run is not counted.
+	REQUIRE(tuiAtlasMeasureGlyphs(atlas, glyphs, 2) == 3 + 4 - 1);
+
+	tuiAtlasDestroy(atlas);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
+
+TEST_CASE("tuiTextRunCacheMeasure")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	TuiAtlas atlas = createTextAtlas();
+	setTextMetrics(atlas);
+	TuiTextRunCache text_run_cache = TUI_NULL;
+	REQUIRE(tuiTextRunCacheCreate(&text_run_cache, 0) == TUI_RESULT_ERROR_INVALID_VALUE);
+	REQUIRE(tuiTextRunCacheCreate(&text_run_cache, 8) == TUI_RESULT_OK);
+	const uint16_t glyphs[3] = { 0, 1, 2 };
+	size_t hit_count = 0;
+	size_t miss_count = 0;
+
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 3) == 12);
+	tuiTextRunCacheGetStatistics(text_run_cache, &hit_count, &miss_count);
+	REQUIRE(hit_count == 0);
+	REQUIRE(miss_count == 1);
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 3) == 12);
+	tuiTextRunCacheGetStatistics(text_run_cache, &hit_count, &miss_count);
+	REQUIRE(hit_count == 1);
+	REQUIRE(miss_count == 1);
+
+	// Changing the kerning of the atlas invalidates the runs measured with the old kerning.
+	const TuiKerningPair kerning_pair = { 0, 1, -2 };
+	REQUIRE(tuiAtlasSetKerningPairs(atlas, &kerning_pair, 1) == TUI_RESULT_OK);
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 3) == 10);
+	tuiTextRunCacheGetStatistics(text_run_cache, &hit_count, &miss_count);
+	REQUIRE(hit_count == 1);
+	REQUIRE(miss_count == 2);
+
+	// So does changing its glyph metrics.
+	REQUIRE(tuiAtlasSetGlyphMetrics(atlas, TUI_NULL) == TUI_RESULT_OK);
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 3) == 2 + 2 + 2 - 2);
+	tuiTextRunCacheGetStatistics(text_run_cache, &hit_count, &miss_count);
+	REQUIRE(miss_count == 3);
+
+	tuiTextRunCacheClear(text_run_cache);
+	tuiTextRunCacheGetStatistics(text_run_cache, &hit_count, &miss_count);
+	REQUIRE(hit_count == 0);
+	REQUIRE(miss_count == 0);
+
+	// A new atlas never reuses the runs of a destroyed one, even when it is given the same address.
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 3) == 2 + 2 + 2 - 2);
+	tuiAtlasDestroy(atlas);
+	atlas = createTextAtlas();
+	setTextMetrics(atlas);
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 3) == 12);
+	tuiTextRunCacheGetStatistics(text_run_cache, &hit_count, &miss_count);
+	REQUIRE(hit_count == 0);
+	REQUIRE(miss_count == 2);
+
+	// Runs of the same length with different glyphs are told apart by their glyphs.
+	const uint16_t other_glyphs[3] = { 3, 3, 0 };
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, other_glyphs, 3) == 6 + 6 + 3);
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 3) == 12);
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 0) == 0);
+	REQUIRE(tuiTextRunCacheMeasure(text_run_cache, atlas, glyphs, 0) == 0);
+
+	tuiTextRunCacheDestroy(text_run_cache);
+	tuiAtlasDestroy(atlas);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
+
+TEST_CASE("tuiConsolePushTextRun")
+{
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_SOFTWARE) == TUI_RESULT_OK);
+	REQUIRE(tuiInit() == TUI_TRUE);
+	TuiAtlas atlas = createTextAtlas();
+	setTextMetrics(atlas);
+	const TuiKerningPair kerning_pair = { 0, 1, -1 };
+	REQUIRE(tuiAtlasSetKerningPairs(atlas, &kerning_pair, 1) == TUI_RESULT_OK);
+	TuiConsole console = TUI_NULL;
+	REQUIRE(tuiConsoleCreatePixelDimensions(&console, 8, 4, 1.0f, 2, 2, TUI_TRUE) == TUI_RESULT_OK);
+
+	// Glyph 0 is placed at the pen and glyph 1 after its kerned advance of 2. Glyph 3 has no tile.
+	const TuiGlyph glyphs[3] = { 0, 1, 3 };
+	REQUIRE(tuiConsolePushTextRun(console, atlas, glyphs, 3, 0, 2, 255, 0, 0, 255, 0, 0, 0, 0) == TUI_RESULT_OK);
+	REQUIRE(tuiConsoleGetTileCount(console) == 2);
+
+	TuiPanel panel = TUI_NULL;
+	REQUIRE(tuiPanelCreate(&panel, 8, 4) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelClearColor(panel, 0, 0, 0, 255) == TUI_RESULT_OK);
+	REQUIRE(tuiPanelDrawConsole(panel, atlas, console) == TUI_RESULT_OK);
+	uint8_t* pixels = TUI_NULL;
+	int pixel_width = 0;
+	int pixel_height = 0;
+	REQUIRE(tuiPanelGetPixels(panel, &pixels, &pixel_width, &pixel_height) == TUI_RESULT_OK);
+	for (int x = 0; x < 8; x++)
+	{
+		REQUIRE(pixels[(1 * 8 + x) * 4 + 0] == ((x < 4) ? 255 : 0));
+		REQUIRE(pixels[(2 * 8 + x) * 4 + 0] == 0);
+	}
+
+	tuiFree(pixels);
+	tuiPanelDestroy(panel);
+	tuiConsoleDestroy(console);
+	tuiAtlasDestroy(atlas);
+	tuiTerminate();
+	REQUIRE(tuiSetGraphicsBackend(TUI_GRAPHICS_BACKEND_OPENGL33) == TUI_RESULT_OK);
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+/* Test creating a TuiAtlas from atlases embedded into the binary at build time, with no file I/O or image decoding. */
+
+#include <TUIC/tuic.h>
+
+#include <chrono>
+#include <stdio.h>
+
+extern "C" const TuiEmbeddedAtlas tuiEmbeddedCodepageGreen;
+extern "C" const TuiEmbeddedAtlas tuiEmbeddedCodepageAlpha;
+
+static void createEmbeddedAtlas(const char* name, const TuiEmbeddedAtlas* embedded_atlas)
+{
+	const auto start = std::chrono::steady_clock::now();
+	TuiAtlas atlas = TUI_NULL;
+	const TuiResult result = tuiAtlasCreateFromEmbedded(&atlas, embedded_atlas);
+	const auto end = std::chrono::steady_clock::now();
+	if (result != TUI_RESULT_OK)
+	{
+		printf("%s: creation failed with result %d\n", name, (int)result);
+		return;
+	}
+	int width, height, pages;
+	tuiAtlasGetDimensions(atlas, &width, &height, &pages);
+	printf("%s: %dx%d with %d pages and %d glyphs created in %.3f ms\n", name, width, height, pages, tuiAtlasGetGlyphCount(atlas), std::chrono::duration<double, std::milli>(end - start).count());
+	tuiAtlasDestroy(atlas);
+}
+
+int main()
+{
+	if (tuiInit() == TUI_FALSE)
+	{
+		printf("TUIC could not be initialized.\n");
+		return 1;
+	}
+	createEmbeddedAtlas("cp_8x8_rgb_fg_green grid", &tuiEmbeddedCodepageGreen);
+	createEmbeddedAtlas("cp_8x8_rgba_fg_alpha boxes", &tuiEmbeddedCodepageAlpha);
+	tuiTerminate();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+/* Compare the speed of symmetric shadowcasting field of view against casting one line ray to every tile on the edge of the view. */
+
+#include <TUIC/tuic.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+static const int kMapWidth = 200;
+static const int kMapHeight = 120;
+static const int kViewerCount = 256;
+static const float kViewRadius = 24.0f;
+
+// Reveal every tile along a ray from the circle center to each tile on the edge of its bounding square, stopping each ray at the first wall.
+void ray_per_cell_field_of_view(TuiGridMask blocking_mask, TuiCircle view_circle, TuiGridMask visible_mask)
+{
+    const int radius = (int)kViewRadius;
+    const float radius_squared = view_circle.radius * view_circle.radius;
+    for (int edge_i = 0; edge_i < radius * 8; edge_i++)
+    {
+        const int side = edge_i / (radius * 2);
+        const int offset = edge_i % (radius * 2) - radius;
+        const int edge_x = view_circle.center_x + ((side == 0) ? offset : (side == 1) ? radius : (side == 2) ? -offset : -radius);
+        const int edge_y = view_circle.center_y + ((side == 0) ? -radius : (side == 1) ? offset : (side == 2) ? radius : -offset);
+        TUI_LINE_ITERATE(tuiLine(view_circle.center_x, view_circle.center_y, edge_x, edge_y), it)
+        {
+            const TuiPoint2 point2 = tuiLineItGetPoint2(it);
+            const int x_distance = point2.x - view_circle.center_x;
+            const int y_distance = point2.y - view_circle.center_y;
+            if ((float)(x_distance * x_distance + y_distance * y_distance) > radius_squared)
+            {
+                break;
+            }
+            tuiGridMaskSet(visible_mask, point2.x, point2.y, TUI_TRUE);
+            if (tuiGridMaskGet(blocking_mask, point2.x, point2.y) || point2.x < 0 || point2.y < 0 || point2.x >= kMapWidth || point2.y >= kMapHeight)
+            {
+                break;
+            }
+        }
+    }
+}
+
+int main()
+{
+    TuiGridMask blocking_mask = TUI_NULL;
+    if (tuiGridMaskCreate(&blocking_mask, kMapWidth, kMapHeight) != TUI_RESULT_OK)
+    {
+        printf("Failed to create blocking mask.\n");
+        return 1;
+    }
+    srand(1);
+    for (int y = 0; y < kMapHeight; y++)
+    {
+        for (int x = 0; x < kMapWidth; x++)
+        {
+            tuiGridMaskSet(blocking_mask, x, y, (rand() % 6) == 0);
+        }
+    }
+
+    TuiCircle view_circles[kViewerCount];
+    TuiGridMask visible_masks[kViewerCount];
+    for (int viewer_i = 0; viewer_i < kViewerCount; viewer_i++)
+    {
+        view_circles[viewer_i] = tuiCircle(rand() % kMapWidth, rand() % kMapHeight, kViewRadius);
+        if (tuiGridMaskCreate(&visible_masks[viewer_i], kMapWidth, kMapHeight) != TUI_RESULT_OK)
+        {
+            printf("Failed to create visible mask.\n");
+            return 1;
+        }
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (int viewer_i = 0; viewer_i < kViewerCount; viewer_i++)
+    {
+        ray_per_cell_field_of_view(blocking_mask, view_circles[viewer_i], visible_masks[viewer_i]);
+    }
+    const double ray_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    start_time = std::chrono::steady_clock::now();
+    for (int viewer_i = 0; viewer_i < kViewerCount; viewer_i++)
+    {
+        tuiFieldOfViewCompute(blocking_mask, view_circles[viewer_i], visible_masks[viewer_i]);
+    }
+    const double shadowcast_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    start_time = std::chrono::steady_clock::now();
+    tuiFieldOfViewComputeMany(blocking_mask, view_circles, visible_masks, kViewerCount, 0);
+    const double shadowcast_many_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    printf("%d viewers with radius %.1f on a %dx%d map:\n", kViewerCount, kViewRadius, kMapWidth, kMapHeight);
+    printf("\tray per cell: %.3f ms\n", ray_seconds * 1000.0);
+    printf("\tshadowcasting: %.3f ms\n", shadowcast_seconds * 1000.0);
+    printf("\tshadowcasting on every hardware thread: %.3f ms\n", shadowcast_many_seconds * 1000.0);
+
+    for (int viewer_i = 0; viewer_i < kViewerCount; viewer_i++)
+    {
+        tuiGridMaskDestroy(visible_masks[viewer_i]);
+    }
+    tuiGridMaskDestroy(blocking_mask);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+/* Compare the speed of the pathfinder against a typical A* built on std::priority_queue and hashed node sets. */
+
+#include <TUIC/tuic.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <queue>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+static const int kMapWidth = 200;
+static const int kMapHeight = 120;
+static const int kQueryCount = 1000;
+
+// Find the cost of the cheapest 8 way path with the same rules as the pathfinder, allocating its open list and node sets for every query.
+int32_t priority_queue_a_star(TuiGridMask blocking_mask, TuiPoint2 start, TuiPoint2 goal)
+{
+    auto walkable = [&](int x, int y) { return x >= 0 && y >= 0 && x < kMapWidth && y < kMapHeight && !tuiGridMaskGet(blocking_mask, x, y); };
+    auto heuristic = [&](int x, int y) { const int dx = abs(goal.x - x); const int dy = abs(goal.y - y); return 14 * std::min(dx, dy) + 10 * (std::max(dx, dy) - std::min(dx, dy)); };
+    typedef std::pair<int32_t, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    std::unordered_map<int, int32_t> costs;
+    std::unordered_set<int> closed;
+    if (!walkable(start.x, start.y) || !walkable(goal.x, goal.y))
+    {
+        return TUI_PATH_UNREACHABLE;
+    }
+    const int start_index = start.y * kMapWidth + start.x;
+    costs[start_index] = 0;
+    open.push(Entry(heuristic(start.x, start.y), start_index));
+    while (!open.empty())
+    {
+        const int index = open.top().second;
+        open.pop();
+        if (!closed.insert(index).second)
+        {
+            continue;
+        }
+        const int x = index % kMapWidth;
+        const int y = index / kMapWidth;
+        if (x == goal.x && y == goal.y)
+        {
+            return costs[index];
+        }
+        for (int step_y = -1; step_y <= 1; step_y++)
+        {
+            for (int step_x = -1; step_x <= 1; step_x++)
+            {
+                if ((step_x == 0 && step_y == 0) || !walkable(x + step_x, y + step_y) || (step_x != 0 && step_y != 0 && (!walkable(x + step_x, y) || !walkable(x, y + step_y))))
+                {
+                    continue;
+                }
+                const int neighbour = index + step_y * kMapWidth + step_x;
+                const int32_t cost = costs[index] + ((step_x != 0 && step_y != 0) ? 14 : 10);
+                auto found = costs.find(neighbour);
+                if (found == costs.end() || cost < found->second)
+                {
+                    costs[neighbour] = cost;
+                    open.push(Entry(cost + heuristic(x + step_x, y + step_y), neighbour));
+                }
+            }
+        }
+    }
+    return TUI_PATH_UNREACHABLE;
+}
+
+int main()
+{
+    TuiGridMask blocking_mask = TUI_NULL;
+    TuiPathfinder pathfinder = TUI_NULL;
+    if (tuiGridMaskCreate(&blocking_mask, kMapWidth, kMapHeight) != TUI_RESULT_OK || tuiPathfinderCreate(&pathfinder, kMapWidth, kMapHeight) != TUI_RESULT_OK)
+    {
+        printf("Failed to create the blocking mask or pathfinder.\n");
+        return 1;
+    }
+    srand(1);
+    for (int y = 0; y < kMapHeight; y++)
+    {
+        for (int x = 0; x < kMapWidth; x++)
+        {
+            tuiGridMaskSet(blocking_mask, x, y, (rand() % 4) == 0);
+        }
+    }
+    std::vector<TuiPoint2> starts(kQueryCount);
+    std::vector<TuiPoint2> goals(kQueryCount);
+    for (int query_i = 0; query_i < kQueryCount; query_i++)
+    {
+        starts[query_i] = tuiPoint2(rand() % kMapWidth, rand() % kMapHeight);
+        goals[query_i] = tuiPoint2(rand() % kMapWidth, rand() % kMapHeight);
+    }
+    std::vector<TuiPoint2> path(kMapWidth * kMapHeight);
+    int mismatch_count = 0;
+    int64_t checksum = 0;
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<int32_t> reference_costs(kQueryCount);
+    for (int query_i = 0; query_i < kQueryCount; query_i++)
+    {
+        reference_costs[query_i] = priority_queue_a_star(blocking_mask, starts[query_i], goals[query_i]);
+    }
+    const double reference_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    start_time = std::chrono::steady_clock::now();
+    for (int query_i = 0; query_i < kQueryCount; query_i++)
+    {
+        int path_length = 0;
+        tuiPathfinderFindPath(pathfinder, blocking_mask, TUI_NULL, starts[query_i], goals[query_i], TUI_TRUE, path.data(), (int)path.size(), &path_length);
+        checksum += path_length;
+        mismatch_count += (tuiPathfinderGetLastPathCost(pathfinder) != reference_costs[query_i]);
+    }
+    const double a_star_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    start_time = std::chrono::steady_clock::now();
+    for (int query_i = 0; query_i < kQueryCount; query_i++)
+    {
+        int path_length = 0;
+        tuiPathfinderJumpPointSearch(pathfinder, blocking_mask, starts[query_i], goals[query_i], path.data(), (int)path.size(), &path_length);
+        checksum += path_length;
+        mismatch_count += (tuiPathfinderGetLastPathCost(pathfinder) != reference_costs[query_i]);
+    }
+    const double jump_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    std::vector<int32_t> distances(kMapWidth * kMapHeight);
+    start_time = std::chrono::steady_clock::now();
+    for (int query_i = 0; query_i < 100; query_i++)
+    {
+        tuiPathfinderComputeDistanceMap(pathfinder, blocking_mask, TUI_NULL, &starts[query_i], 1, TUI_TRUE, distances.data());
+    }
+    const double distance_map_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    printf("%d paths on a %dx%d map:\n", kQueryCount, kMapWidth, kMapHeight);
+    printf("\tpriority queue A*: %.3f ms\n", reference_seconds * 1000.0);
+    printf("\tpathfinder A*: %.3f ms\n", a_star_seconds * 1000.0);
+    printf("\tpathfinder jump point search: %.3f ms\n", jump_seconds * 1000.0);
+    printf("\t100 distance maps: %.3f ms\n", distance_map_seconds * 1000.0);
+    printf("\tcost mismatches: %d (checksum %lld)\n", mismatch_count, (long long)checksum);
+
+    tuiPathfinderDestroy(pathfinder);
+    tuiGridMaskDestroy(blocking_mask);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+/*
+	Copyright (c) 2021 Daniel Valcour
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+	the Software, and to permit persons to whom the Software is furnished to do so,
+	subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+	FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+	IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+	CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*
+	Build time tool used by the tuic_embed_atlas CMake function. It decodes an atlas image and writes a C source
+	defining a TuiEmbeddedAtlas with the pixels and glyph coordinates in static storage.
+
+	Usage:
+		atlas_embed <image> <output.c> <symbol> grid <columns> <rows>
+		atlas_embed <image> <output.c> <symbol> boxes <layout file>
+
+	A layout file has one glyph per line, given as the pixel box "x y width height" of the glyph in the image.
+*/
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TUI_STPQP_COORDINATES_PER_GLYPH 5
+
+static int _WritePixels(FILE* file, const unsigned char* pixels, size_t size)
+{
+	fprintf(file, "static const uint8_t kPixelData[%zu] = {", size);
+	for (size_t byte_i = 0; byte_i < size; byte_i++)
+	{
+		fprintf(file, (byte_i % 24 == 0) ? "\n\t%u," : " %u,", (unsigned)pixels[byte_i]);
+	}
+	return fprintf(file, "\n};\n") > 0;
+}
+
+static int _WriteCoordinates(FILE* file, const float* coordinates, int glyph_count)
+{
+	fprintf(file, "static const float kStpqpCoordinates[%d] = {", glyph_count * TUI_STPQP_COORDINATES_PER_GLYPH);
+	for (int glyph_i = 0; glyph_i < glyph_count; glyph_i++)
+	{
+		const float* glyph_coordinates = &coordinates[glyph_i * TUI_STPQP_COORDINATES_PER_GLYPH];
+		fprintf(file, "\n\t%#.9gf, %#.9gf, %#.9gf, %#.9gf, %#.9gf,", glyph_coordinates[0], glyph_coordinates[1], glyph_coordinates[2], glyph_coordinates[3], glyph_coordinates[4]);
+	}
+	return fprintf(file, "\n};\n") > 0;
+}
+
+// Read the pixel boxes of a layout file into stpqp coordinates. Returns the amount of glyphs, or -1 on error.
+static int _ReadLayout(const char* path, int width, int height, float** coordinates)
+{
+	FILE* file = fopen(path, "r");
+	if (file == NULL)
+	{
+		fprintf(stderr, "atlas_embed: can not open layout file %s\n", path);
+		return -1;
+	}
+	int glyph_count = 0;
+	int glyph_capacity = 256;
+	*coordinates = (float*)malloc((size_t)glyph_capacity * TUI_STPQP_COORDINATES_PER_GLYPH * sizeof(float));
+	int x, y, box_width, box_height;
+	int field_count;
+	while (*coordinates != NULL && (field_count = fscanf(file, "%d %d %d %d", &x, &y, &box_width, &box_height)) == 4)
+	{
+		if (x < 0 || y < 0 || box_width < 1 || box_height < 1 || x + box_width > width || y + box_height > height)
+		{
+			fprintf(stderr, "atlas_embed: glyph %d of %s is outside of the image\n", glyph_count, path);
+			fclose(file);
+			return -1;
+		}
+		if (glyph_count == glyph_capacity)
+		{
+			glyph_capacity *= 2;
+			float* grown_coordinates = (float*)realloc(*coordinates, (size_t)glyph_capacity * TUI_STPQP_COORDINATES_PER_GLYPH * sizeof(float));
+			if (grown_coordinates == NULL)
+			{
+				// realloc keeps the old block on failure, so it is freed here instead of leaked.
+				free(*coordinates);
+				*coordinates = NULL;
+				break;
+			}
+			*coordinates = grown_coordinates;
+		}
+		float* glyph_coordinates = &(*coordinates)[glyph_count * TUI_STPQP_COORDINATES_PER_GLYPH];
+		glyph_coordinates[0] = (float)x / (float)width;
+		glyph_coordinates[1] = (float)y / (float)height;
+		glyph_coordinates[2] = (float)(x + box_width) / (float)width;
+		glyph_coordinates[3] = (float)(y + box_height) / (float)height;
+		glyph_coordinates[4] = 0.0f;
+		glyph_count++;
+	}
+	fclose(file);
+	if (*coordinates == NULL)
+	{
+		fprintf(stderr, "atlas_embed: out of memory reading layout file %s\n", path);
+		return -1;
+	}
+	if (field_count != EOF || glyph_count == 0)
+	{
+		fprintf(stderr, "atlas_embed: layout file %s must have one \"x y width height\" box per line\n", path);
+		return -1;
+	}
+	return glyph_count;
+}
+
+int main(int argc, char** argv)
+{
+	const int is_grid = argc == 7 && strcmp(argv[4], "grid") == 0;
+	const int is_boxes = argc == 6 && strcmp(argv[4], "boxes") == 0;
+	if (!is_grid && !is_boxes)
+	{
+		fprintf(stderr, "usage: atlas_embed <image> <output.c> <symbol> grid <columns> <rows>\n       atlas_embed <image> <output.c> <symbol> boxes <layout file>\n");
+		return EXIT_FAILURE;
+	}
+	const char* image_path = argv[1];
+	const char* output_path = argv[2];
+	const char* symbol = argv[3];
+	int width, height, channel_count;
+	// Pixels are embedded with the channels of the image, so greyscale atlases stay a quarter of the size of RGBA.
+	unsigned char* pixels = stbi_load(image_path, &width, &height, &channel_count, 0);
+	if (pixels == NULL)
+	{
+		fprintf(stderr, "atlas_embed: can not decode %s: %s\n", image_path, stbi_failure_reason());
+		return EXIT_FAILURE;
+	}
+	if (channel_count == 2)
+	{
+		// Grey and alpha become coverage and foreground mask, the channel order of a two channel atlas.
+		for (size_t pixel_i = 0; pixel_i < (size_t)width * (size_t)height; pixel_i++)
+		{
+			const unsigned char grey = pixels[pixel_i * 2];
+			pixels[pixel_i * 2] = pixels[pixel_i * 2 + 1];
+			pixels[pixel_i * 2 + 1] = grey;
+		}
+	}
+	int glyph_count = 0;
+	int grid_columns = 0;
+	int grid_rows = 0;
+	float* coordinates = NULL;
+	if (is_grid)
+	{
+		grid_columns = atoi(argv[5]);
+		grid_rows = atoi(argv[6]);
+		if (grid_columns < 1 || grid_rows < 1 || width % grid_columns != 0 || height % grid_rows != 0)
+		{
+			fprintf(stderr, "atlas_embed: a %dx%d image can not be split into %s columns and %s rows of equal cells\n", width, height, argv[5], argv[6]);
+			stbi_image_free(pixels);
+			return EXIT_FAILURE;
+		}
+		glyph_count = grid_columns * grid_rows;
+	}
+	else
+	{
+		glyph_count = _ReadLayout(argv[5], width, height, &coordinates);
+		if (glyph_count < 0)
+		{
+			free(coordinates);
+			stbi_image_free(pixels);
+			return EXIT_FAILURE;
+		}
+	}
+
+	FILE* file = fopen(output_path, "w");
+	if (file == NULL)
+	{
+		fprintf(stderr, "atlas_embed: can not create %s\n", output_path);
+		free(coordinates);
+		stbi_image_free(pixels);
+		return EXIT_FAILURE;
+	}
+	fprintf(file, "/* Generated by atlas_embed from %s. Do not edit. */\n#include <TUIC/embedded_atlas.h>\n#include <stddef.h>\n\n", image_path);
+	int written = _WritePixels(file, pixels, (size_t)width * (size_t)height * (size_t)channel_count);
+	if (coordinates != NULL)
+	{
+		written = written && _WriteCoordinates(file, coordinates, glyph_count);
+	}
+	fprintf(file, "\nconst TuiEmbeddedAtlas %s = { %d, %d, 1, %d, %d, %d, %d, kPixelData, %s };\n", symbol, width, height, channel_count, glyph_count, grid_columns, grid_rows, (coordinates != NULL) ? "kStpqpCoordinates" : "NULL");
+	written = (fclose(file) == 0) && written;
+	free(coordinates);
+	stbi_image_free(pixels);
+	if (!written)
+	{
+		fprintf(stderr, "atlas_embed: can not write %s\n", output_path);
+		remove(output_path);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
\ No newline at end of file